@@ -0,0 +1,38 @@
+/*
+
+File Name: arena.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for arena.c.
+
+    INCLUDES
+    --------
+    bot.h
+
+    MACROS
+    ------
+    1. ARENA_GRACE_MS
+    2. ARENA_MAX_POOL
+
+    FUNCTIONS
+    ---------
+    bool runArena(int games, char *sides[2], int pool, GameMode mode)
+
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <bot.h>
+
+// macros
+#define ARENA_GRACE_MS 50 // time a bot gets on top of the CPU's budget to answer, for starting up and for the pipes
+#define ARENA_MAX_POOL 64 // max no. of games played at the same time
+
+// functions
+
+bool runArena(int games, char *sides[2], int pool, GameMode mode);
+
+#endif
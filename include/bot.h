@@ -0,0 +1,92 @@
+/*
+
+File Name: bot.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for bot.c.
+
+    INCLUDES
+    --------
+    game.h
+
+    MACROS
+    ------
+    1. BOT_PROTOCOL_VERSION
+    2. BOT_LINE_SIZE
+    3. BOT_HANDSHAKE_MS
+    4. BOT_QUIT_MS
+
+    ENUMS
+    -----
+    BotRead
+
+    STRUCTS
+    -------
+    BotProcess
+
+    FUNCTIONS
+    ---------
+    1. bool startBot(struct BotProcess *bot, char *command)
+    2. bool sendBot(struct BotProcess *bot, char *format, ...)
+    3. BotRead readBot(struct BotProcess *bot, char *line)
+    4. void stopBot(struct BotProcess *bot, bool force)
+    5. bool parseCPU(char *name, Difficulty *difficulty, const struct Strategy **strategy)
+    6. bool parseCell(char *text, int *cell)
+    7. int runBot(Difficulty difficulty, const struct Strategy *strategy)
+
+*/
+
+#ifndef BOT_H
+#define BOT_H
+
+#include <game.h>
+
+// macros
+#define BOT_PROTOCOL_VERSION 1 // version of the protocol described in bot.c
+#define BOT_LINE_SIZE 256 // max size of a line sent by a bot, including the newline
+#define BOT_HANDSHAKE_MS 5000 // time a bot that was just started has to answer the handshake
+#define BOT_QUIT_MS 200 // time a bot told to quit has to exit before it is killed
+
+/*
+    What reading a line from a bot came to.
+    - BOT_LINE: a whole line was read.
+    - BOT_WAITING: the bot has not sent a whole line yet.
+    - BOT_CLOSED: the bot closed its output, or sent a line longer than BOT_LINE_SIZE.
+*/
+typedef enum {
+    BOT_LINE,
+    BOT_WAITING,
+    BOT_CLOSED
+} BotRead;
+
+/*
+    BotProcess struct, contains a bot running as a child process. Contains:
+    - long pid: process ID of the bot.
+    - int input: pipe to the bot's standard input.
+    - int output: pipe from the bot's standard output, which never blocks.
+    - char buffer[BOT_LINE_SIZE]: what has been read from output but not yet returned as a line.
+    - int buffered: number of bytes in buffer.
+    - char name[MAX_SIZE]: name the bot gave in the handshake.
+*/
+struct BotProcess {
+    long pid;
+    int input;
+    int output;
+    char buffer[BOT_LINE_SIZE];
+    int buffered;
+    char name[MAX_SIZE];
+};
+
+// functions
+
+bool startBot(struct BotProcess *bot, char *command);
+bool sendBot(struct BotProcess *bot, char *format, ...);
+BotRead readBot(struct BotProcess *bot, char *line);
+void stopBot(struct BotProcess *bot, bool force);
+bool parseCPU(char *name, Difficulty *difficulty, const struct Strategy **strategy);
+bool parseCell(char *text, int *cell);
+int runBot(Difficulty difficulty, const struct Strategy *strategy);
+
+#endif
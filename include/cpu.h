@@ -12,35 +12,137 @@ Scenario:
     INCLUDES
     --------
     1. stdlib.h
-    2. player.h
+    2. layout.h
+    3. strategy.h
+
+    MACROS
+    ------
+    1. DEFAULT_CPU_BUDGET_MS
+    2. CHECKOUT_SIZE
+    3. NEIGHBOUR_ORDERS
 
     ENUM
     ----
     Difficulty
 
+    STRUCTS
+    -------
+    1. HardParameters
+    2. CPUState
+
     FUNCTIONS
     ---------
     1. void setCPUTurn(int turn)
     2. int getCPUTurn(void)
-    3. void cpuPlaceShips(void)
-    4. bool playCPUTurn(char *moveStatus, Difficulty difficulty)
-    5. void resetCPUVariables(void)
+    3. void initCPUState(struct CPUState *cpu, int turn, Difficulty difficulty, unsigned long long seed)
+    4. void cpuPlaceShips(struct Player *cpuPlayer)
+    5. bool playCPUTurn(struct CPUState *cpu, struct Player *self, struct Player *opponent, char *moveStatus)
+    6. bool playCPUSalvo(struct CPUState *cpu, struct Player *self, struct Player *opponent, int shots, struct SalvoResult *result)
+    7. void resetCPUVariables(struct CPUState *cpu)
+    8. void setCPUBudget(int milliseconds)
+    9. int getCPUBudget(void)
+    10. void restoreCPUState(struct CPUState *cpu, struct Player *self, struct Player *opponent)
+    11. void setCPUStrategy(const struct Strategy *strategy)
+    12. int chooseCPUSalvo(struct CPUState *cpu, struct Player *self, int shots, int cells[SHIPS])
+    13. void observeCPUShot(struct CPUState *cpu, struct Player *self, int cell, char moveStatus, char sunk)
+    14. void setHardParameters(struct HardParameters parameters)
+    15. struct HardParameters getHardParameters(void)
 
 */
 
+#ifndef CPU_H
+#define CPU_H
+
 #include <stdlib.h>
-#include <player.h>
+#include <layout.h>
+#include <strategy.h>
 
-// CPU difficulties
+// macros
+#define DEFAULT_CPU_BUDGET_MS 100 // time a CPU may spend on one move unless told otherwise
+#define CHECKOUT_SIZE 20 // max no. of cells the hard CPU can keep to explore
+#define NEIGHBOUR_ORDERS 24 // no. of fixed orders the hard CPU can explore the cells next to a hit in
+
+// CPU difficulties, PLUGIN being a strategy loaded from a shared library and POLICY a table learned by self-play
 typedef enum {
     EASY = 1,
-    HARD
+    HARD,
+    EXPERT,
+    PLUGIN,
+    POLICY
 } Difficulty;
 
+struct Stack;
+struct ExpertState;
+
+/*
+    HardParameters struct, contains the choices the hard CPU plays by, which can be tuned (see tune.c). Contains:
+    - bool huntParity: whether the hunt guesses the odd cells before the even ones, (row + col) being odd.
+    - int neighbourOrder: order in which the cells next to a hit are explored, 0 for a new random order after
+      every hit, else 1 + the number of a fixed order of right, left, down and up, less than NEIGHBOUR_ORDERS.
+    - int checkoutSize: max no. of cells kept to explore, from 1 to CHECKOUT_SIZE; cells found beyond it are
+      dropped.
+    - int flips: no. of times a line of hits is turned back along after a miss before it is given up.
+*/
+struct HardParameters {
+    bool huntParity;
+    int neighbourOrder;
+    int checkoutSize;
+    int flips;
+};
+
+/*
+    CPUState struct, stores everything a CPU player remembers between its turns. Every game owns its own
+    CPUState, so any number of games can be played at the same time. Contains:
+    - int turn: index of the CPU player in the game (0 or 1).
+    - Difficulty difficulty: difficulty with which the CPU plays.
+    - int budget: time, in milliseconds, the CPU may spend on one move.
+    - struct Random random: generator used for the CPU's random choices, so that CPUs playing on different
+      threads never share one.
+    - short lastMove: position of the last successful hit (hard difficulty).
+    - struct Stack *checkout: stack of cells for the CPU to explore (hard difficulty).
+    - int hitCount: how many hits have not been accounted for by a sunk ship (hard difficulty).
+    - int orientationFlips: no. of times guessOrientation has flipped after a miss (hard difficulty).
+    - short guessOrientation: direction in which to guess (hard difficulty), 
+      0 - no saved orientation, 1 - right, -1 - left, 10 - down, -10 - up
+    - struct ExpertState *expert: layouts and guesses remembered by the CPU (expert difficulty).
+    - const struct Strategy *strategy: strategy the CPU plays with (plugin difficulty).
+    - void *strategyState: state created by the strategy, NULL until its first shot (plugin difficulty).
+    - struct CellMask sunkCells: cells of the ships the CPU has sunk, as far as it can tell (policy difficulty).
+    - struct HardParameters hard: choices the CPU plays by (hard difficulty).
+*/
+struct CPUState {
+    int turn;
+    Difficulty difficulty;
+    int budget;
+    struct Random random;
+    short lastMove;
+    struct Stack *checkout;
+    int hitCount;
+    int orientationFlips;
+    short guessOrientation;
+    struct ExpertState *expert;
+    const struct Strategy *strategy;
+    void *strategyState;
+    struct CellMask sunkCells;
+    struct HardParameters hard;
+};
+
 // functions
 
 void setCPUTurn(int turn);
 int getCPUTurn(void);
-void cpuPlaceShips(void);
-bool playCPUTurn(char *moveStatus, Difficulty difficulty);
-void resetCPUVariables(void);
\ No newline at end of file
+void initCPUState(struct CPUState *cpu, int turn, Difficulty difficulty, unsigned long long seed);
+void cpuPlaceShips(struct Player *cpuPlayer);
+bool playCPUTurn(struct CPUState *cpu, struct Player *self, struct Player *opponent, char *moveStatus);
+bool playCPUSalvo(struct CPUState *cpu, struct Player *self, struct Player *opponent, int shots, struct SalvoResult *result);
+void resetCPUVariables(struct CPUState *cpu);
+void setCPUBudget(int milliseconds);
+int getCPUBudget(void);
+void restoreCPUState(struct CPUState *cpu, struct Player *self, struct Player *opponent);
+void setCPUStrategy(const struct Strategy *strategy);
+int chooseCPUSalvo(struct CPUState *cpu, struct Player *self, int shots, int cells[SHIPS]);
+void observeCPUShot(struct CPUState *cpu, struct Player *self, int cell, char moveStatus, char sunk);
+void setHardParameters(struct HardParameters parameters);
+struct HardParameters getHardParameters(void);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*
+
+File Name: defence.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for defence.c.
+
+    INCLUDES
+    --------
+    cpu.h
+
+    MACROS
+    ------
+    1. DEFENCE_CANDIDATES
+    2. DEFENCE_PLAYOUTS
+    3. DEFENCE_FINALISTS
+    4. DEFENCE_TARGET_WEIGHT
+    5. DEFENCE_MAX_THREADS
+
+    FUNCTIONS
+    ---------
+    void placeShipsExpert(struct Player *cpuPlayer, int threads, long long deadline)
+
+*/
+
+#ifndef DEFENCE_H
+#define DEFENCE_H
+
+#include <cpu.h>
+
+// macros
+#define DEFENCE_CANDIDATES 32 // no. of layouts the expert CPU considers for its fleet
+#define DEFENCE_PLAYOUTS 4 // no. of games every attacker plays against every layout still considered, per round
+#define DEFENCE_FINALISTS 4 // no. of hardest layouts the fleet is picked from
+#define DEFENCE_TARGET_WEIGHT 20 // how much more the density attacker counts a placement for every hit it covers
+#define DEFENCE_MAX_THREADS 8 // max no. of threads the games are played on
+
+// functions
+
+void placeShipsExpert(struct Player *cpuPlayer, int threads, long long deadline);
+
+#endif
@@ -22,9 +22,10 @@ ________________________________________________________________________________
     2. ReturnCode takeNInput(void *inputVar, DataType type, int inputSize)
     3. ReturnCode takeInputWithPropmt(char *propmt, void *inputVar, DataType type)
     4. ReturnCode takeNInputWithPropmt(char *propmt, void *inputVar, DataType type, int inputSize)
-    5. void clearInputBuffer(void)
-    6. void clearScreen(void)
-    7. short checkInputValidity(
+    5. ReturnCode takeLine(char *line, int lineSize)
+    6. void clearInputBuffer(void)
+    7. void clearScreen(void)
+    8. short checkInputValidity(
             ReturnCode returnCode, 
             char *cannotReadMessage, 
             char *tooLongMessage, 
@@ -33,6 +34,9 @@ ________________________________________________________________________________
         )
 */
 
+#ifndef EASY_IO_H
+#define EASY_IO_H
+
 #include <stdio.h>
 
 // enum containing all the data types that are supported by the takeInput functions.
@@ -60,6 +64,7 @@ ReturnCode takeInput(void *inputVar, DataType type);
 ReturnCode takeNInput(void *inputVar, DataType type, int inputSize);
 ReturnCode takeInputWithPropmt(char *propmt, void *inputVar, DataType type);
 ReturnCode takeNInputWithPropmt(char *propmt, void *inputVar, DataType type, int inputSize);
+ReturnCode takeLine(char *line, int lineSize);
 void clearInputBuffer(void);
 void clearScreen(void);
 short checkInputValidity(
@@ -68,4 +73,6 @@ short checkInputValidity(
     char *tooLongMessage, 
     char *invalidTypeMessage,
     char *notSupportedMessage
-);
\ No newline at end of file
+);
+
+#endif
\ No newline at end of file
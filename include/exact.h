@@ -0,0 +1,61 @@
+/*
+
+File Name: exact.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for exact.c.
+
+    INCLUDES
+    --------
+    layout.h
+
+    MACROS
+    ------
+    1. EXACT_TABLE_SIZE
+    2. EXACT_MAX_THREADS
+
+    STRUCTS
+    -------
+    ExactResult
+
+    FUNCTIONS
+    ---------
+    1. bool countLayouts(
+            struct CellMask misses, struct CellMask hits, bool sunk[SHIPS],
+            int threads, long long deadline, struct ExactResult *result
+        )
+
+*/
+
+#ifndef EXACT_H
+#define EXACT_H
+
+#include <layout.h>
+
+// macros
+#define EXACT_TABLE_SIZE (1 << 18) // no. of sub-fleets each thread can remember, a power of 2
+#define EXACT_MAX_THREADS 8 // max no. of threads a count runs on
+
+/*
+    ExactResult struct, contains how many fleet layouts are consistent with a set of guesses, in total and per
+    cell. Counts never go beyond 2^53, so they are exact even though they are stored as doubles. Contains:
+    - double total: number of consistent layouts.
+    - double hit[CELLS]: number of them in which each cell is covered by a ship.
+    - double sink[CELLS][SHIPS]: number of them in which each cell is the only cell of a ship not yet hit.
+*/
+struct ExactResult {
+    double total;
+    double hit[CELLS];
+    double sink[CELLS][SHIPS];
+};
+
+// functions
+
+bool countLayouts(
+    struct CellMask misses, struct CellMask hits, bool sunk[SHIPS],
+    int threads, long long deadline, struct ExactResult *result
+);
+
+#endif
@@ -0,0 +1,101 @@
+/*
+
+File Name: expert.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for expert.c.
+
+    INCLUDES
+    --------
+    exact.h
+
+    MACROS
+    ------
+    1. EXPERT_POOL
+    2. EXPERT_REFILL
+    3. EXPERT_MOVES
+
+    STRUCTS
+    -------
+    1. ExpertSample
+    2. ExpertState
+
+    FUNCTIONS
+    ---------
+    1. struct ExpertState *createExpert(unsigned long long seed)
+    2. void resetExpert(struct ExpertState *expert, unsigned long long seed)
+    3. void destroyExpert(struct ExpertState *expert)
+    4. void chooseShotExpert(struct ExpertState *expert, char view[BOARD_SIZE][BOARD_SIZE], long long deadline, int *row, int *col)
+    5. void observeShotExpert(struct ExpertState *expert, int row, int col, char moveStatus, char sunk)
+
+*/
+
+#ifndef EXPERT_H
+#define EXPERT_H
+
+#include <exact.h>
+
+// macros
+#define EXPERT_POOL 4096 // max no. of layouts the expert CPU keeps
+#define EXPERT_REFILL (EXPERT_POOL / 2) // no. of layouts the expert CPU keeps up by moving the ones it already has
+#define EXPERT_MOVES 4 // no. of moves tried on every copied layout
+
+/*
+    ExpertSample struct, contains one fleet layout consistent with everything the expert CPU has seen. Contains:
+    - unsigned char placements[SHIPS]: placement of every ship, an index into getPlacements.
+    - double weight: how many layouts this one stands for, so that the layouts kept stand for all consistent
+      layouts equally.
+*/
+struct ExpertSample {
+    unsigned char placements[SHIPS];
+    double weight;
+};
+
+/*
+    ExpertState struct, stores everything the expert CPU remembers between its turns. Contains:
+    - struct Random random: generator used to draw layouts.
+    - struct CellMask misses: cells the CPU missed.
+    - struct CellMask hits: cells the CPU hit.
+    - bool sunk[SHIPS]: ships the CPU has sunk.
+    - int candidateCounts[SHIPS]: number of placements of each ship that fit what the CPU has seen.
+    - unsigned char candidates[SHIPS][MAX_PLACEMENTS]: those placements, which only shrink as the game goes on.
+    - int sampleCount: number of layouts kept.
+    - struct ExpertSample samples[EXPERT_POOL]: the layouts kept, which carry over to the next turn for as long
+      as they stay consistent.
+    - double total: total weight of the layouts kept.
+    - double hit[CELLS]: weight of the layouts kept in which each cell is a hit.
+    - double sink[CELLS][SHIPS]: weight of the layouts kept in which each cell is the last cell of a ship left
+      to be hit.
+    - int threads: number of threads the exact count runs on.
+    - bool counted: whether exact holds the count for what the CPU has seen so far.
+    - struct ExactResult exact: exact count of the consistent layouts, used instead of the layouts kept whenever
+      it can be done in time.
+*/
+struct ExpertState {
+    struct Random random;
+    struct CellMask misses;
+    struct CellMask hits;
+    bool sunk[SHIPS];
+    int candidateCounts[SHIPS];
+    unsigned char candidates[SHIPS][MAX_PLACEMENTS];
+    int sampleCount;
+    struct ExpertSample samples[EXPERT_POOL];
+    double total;
+    double hit[CELLS];
+    double sink[CELLS][SHIPS];
+    int threads;
+    bool counted;
+    struct ExactResult exact;
+};
+
+// functions
+
+struct ExpertState *createExpert(unsigned long long seed);
+void resetExpert(struct ExpertState *expert, unsigned long long seed);
+void destroyExpert(struct ExpertState *expert);
+void chooseShotExpert(struct ExpertState *expert, char view[BOARD_SIZE][BOARD_SIZE], long long deadline, int *row, int *col);
+void observeShotExpert(struct ExpertState *expert, int row, int col, char moveStatus, char sunk);
+
+#endif
@@ -0,0 +1,40 @@
+/*
+
+File Name: ffa.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for ffa.c.
+
+    INCLUDES
+    --------
+    bot.h
+
+    MACROS
+    ------
+    1. FFA_MAX_PLAYERS
+    2. FFA_MAX_THREADS
+    3. FFA_SWITCH_ODDS
+
+    FUNCTIONS
+    ---------
+    bool runFreeForAll(long long games, int players, char *cpus, int threads)
+
+*/
+
+#ifndef FFA_H
+#define FFA_H
+
+#include <bot.h>
+
+// macros
+#define FFA_MAX_PLAYERS 64 // max no. of players in a free-for-all
+#define FFA_MAX_THREADS 64 // max no. of threads the games are played on
+#define FFA_SWITCH_ODDS 4 // a player with no ship of its target left hit but afloat moves on after a miss once in this many
+
+// functions
+
+bool runFreeForAll(long long games, int players, char *cpus, int threads);
+
+#endif
@@ -3,7 +3,7 @@
 File Name: game.h
 Author: Ishaan Bose
 Date of Creation: 2021-10-12
-____________________________________________________________________________________________________________________________________ 
+____________________________________________________________________________________________________________________________________
 
     Header file for game.c.
 
@@ -12,19 +12,155 @@ ________________________________________________________________________________
     1. easy_io.h
     2. cpu.h
 
+    MACROS
+    ------
+    1. OUTPUT_SIZE
+    2. INPUT_SIZE
+
+    ENUMS
+    -----
+    1. GameMode
+    2. GamePhase
+
+    STRUCTS
+    -------
+    1. Game
+    2. GameOutput
+
     FUNCTIONS
     ---------
     1. void setCPUPlayer(void)
-    2. bool start(int playerTurn, Difficulty difficulty)
-    3. void convertToIndex(char* position, int* row, int* col)
+    2. void setRecordPath(char *path)
+    3. void setSpectatorServer(struct SpectatorServer *server)
+    4. bool start(int playerTurn, Difficulty difficulty, GameMode mode)
+    5. bool resumeGame(bool *playAgain)
+    6. void initGame(
+            struct Game *game, char *playerOneName, char *playerTwoName, 
+            bool cpuPlayer, int cpuTurn, Difficulty difficulty, GameMode mode
+        )
+    7. void gameStep(struct Game *game, char *input, struct GameOutput *output)
+    8. void freeGame(struct Game *game)
+    9. void convertToIndex(char* position, int* row, int* col)
+    10. bool validatePosition(char *position)
 
 */
 
+#ifndef GAME_H
+#define GAME_H
+
 #include <easy_io.h>
 #include <cpu.h>
 
+// macros
+#define OUTPUT_SIZE 8192 // max size of the text produced by a single game step
+#define INPUT_SIZE 64 // max size of a single line of input given to a game step
+
+/*
+    The rules a game can be played with.
+    - CLASSIC: every turn, a player makes one guess.
+    - SALVO: every turn, a player makes one guess for each of their ships that is still afloat, and all the 
+      guesses are resolved together.
+*/
+typedef enum {
+    CLASSIC,
+    SALVO
+} GameMode;
+
+/*
+    The phases a game goes through. Each phase, except for GAME_OVER, waits for one line of input.
+    - PLACE_CHOOSE_SHIP: waiting for the player to pick the ship to place.
+    - PLACE_START: waiting for the starting position of the picked ship.
+    - PLACE_END: waiting for the ending position of the picked ship.
+    - PLACE_DONE: all ships are placed, waiting for ENTER.
+    - TURN_MENU: waiting for the player to choose between playing their turn and viewing their board.
+    - GUESS: waiting for the player's guess.
+    - GUESS_DONE: result of the guess is shown, waiting for ENTER.
+    - PLAY_AGAIN: game has ended, waiting for the players to choose whether to play again.
+    - GAME_OVER: the players have answered, nothing more to do.
+*/
+typedef enum {
+    PLACE_CHOOSE_SHIP,
+    PLACE_START,
+    PLACE_END,
+    PLACE_DONE,
+    TURN_MENU,
+    GUESS,
+    GUESS_DONE,
+    PLAY_AGAIN,
+    GAME_OVER
+} GamePhase;
+
+/*
+    Game struct, contains the complete state of one game so that the game can be advanced one step at a time
+    without ever waiting on input. Contains:
+    - struct Player players[2]: the two players of the game.
+    - struct CPUState cpu: state of the CPU player, if there is one.
+    - bool cpuPlayer: whether or not player cpu.turn is a CPU.
+    - GameMode mode: the rules with which the game is played.
+    - GamePhase phase: the input the game is currently waiting for.
+    - short playerTurn: the player whose input is being waited on (1 or 2).
+    - struct SalvoResult lastSalvo: result of the most recent move made by a player, a classic move being a
+      salvo of one shot. lastSalvo.shots is 0 until the first move is made.
+    - bool shipsAvailable[SHIPS]: ships that are yet to be placed by the player placing their ships.
+    - short shipsPlaced: number of ships placed by the player placing their ships.
+    - Ships chosenShip: ship being placed.
+    - char startPosition[4]: starting position given for the ship being placed.
+    - bool playAgain: whether the players chose to play again, valid once phase is GAME_OVER.
+    - struct GameRecord *record: record into which every move is written, NULL if the game is not recorded.
+    - struct SpectatorServer *spectators: server to which every move is published, NULL if nobody watches.
+    - struct Hint *hints[2]: odds shown to each player when they ask for a hint, NULL for a CPU player and
+      until the odds are first worked out.
+*/
+struct Game {
+    struct Player players[2];
+    struct CPUState cpu;
+    bool cpuPlayer;
+    GameMode mode;
+    GamePhase phase;
+    short playerTurn;
+    struct SalvoResult lastSalvo;
+    bool shipsAvailable[SHIPS];
+    short shipsPlaced;
+    Ships chosenShip;
+    char startPosition[4];
+    bool playAgain;
+    struct GameRecord *record;
+    struct SpectatorServer *spectators;
+    struct Hint *hints[2];
+};
+
+/*
+    GameOutput struct, contains what a single game step produced. Contains:
+    - char text[OUTPUT_SIZE]: the text to show to the players.
+    - int length: length of text.
+    - bool clearScreen: whether the screen should be cleared before the text is shown.
+    - bool finished: whether the game has reached GAME_OVER.
+*/
+struct GameOutput {
+    char text[OUTPUT_SIZE];
+    int length;
+    bool clearScreen;
+    bool finished;
+};
+
+struct GameRecord;
+struct SpectatorServer;
+struct Hint;
+
 // Functions
 
 void setCPUPlayer(void);
-bool start(int playerTurn, Difficulty difficulty);
-void convertToIndex(char* position, int* row, int* col);
\ No newline at end of file
+void setRecordPath(char *path);
+void setSpectatorServer(struct SpectatorServer *server);
+bool start(int playerTurn, Difficulty difficulty, GameMode mode);
+bool resumeGame(bool *playAgain);
+void initGame(
+    struct Game *game, char *playerOneName, char *playerTwoName, 
+    bool cpuPlayer, int cpuTurn, Difficulty difficulty, GameMode mode
+);
+void gameStep(struct Game *game, char *input, struct GameOutput *output);
+void freeGame(struct Game *game);
+void convertToIndex(char* position, int* row, int* col);
+bool validatePosition(char *position);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*
+
+File Name: game_event.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for game_event.c.
+
+    INCLUDES
+    --------
+    game.h
+
+    MACROS
+    ------
+    1. MAX_GAME_OBSERVERS
+    2. EVENT_BIT(kind)
+    3. SHOT_EVENTS
+
+    ENUMS
+    -----
+    GameEventKind
+
+    STRUCTS
+    -------
+    GameEvent
+
+    FUNCTIONS
+    ---------
+    1. bool subscribeGameEvents(void (*observer)(struct GameEvent *event), unsigned int kinds)
+    2. void emitGameEvent(GameEventKind kind, struct Game *game, int player, int cell, char ship)
+    3. void emitSalvoEvents(struct Game *game, int player)
+
+*/
+
+#ifndef GAME_EVENT_H
+#define GAME_EVENT_H
+
+#include <game.h>
+
+// macros
+#define MAX_GAME_OBSERVERS 16 // max no. of observers that can be subscribed to game events
+#define EVENT_BIT(kind) (1u << (kind)) // bit of the given kind of event in a set of kinds
+#define SHOT_EVENTS (EVENT_BIT(EVENT_SHOT_FIRED) | EVENT_BIT(EVENT_HIT) | EVENT_BIT(EVENT_MISS) | EVENT_BIT(EVENT_SUNK)) // kinds of events emitted for every shot
+
+/*
+    The kinds of events a game emits, in the order they happen in a game.
+    - EVENT_SHIP_PLACED: a player placed a ship on their board.
+    - EVENT_GAME_STARTED: both fleets are placed and the first turn is about to begin.
+    - EVENT_SHOT_FIRED: a player fired a shot, emitted before the shot's hit or miss.
+    - EVENT_HIT: the shot hit a ship.
+    - EVENT_MISS: the shot missed.
+    - EVENT_SUNK: the shot sank a ship, emitted after its hit.
+    - EVENT_SALVO_RESOLVED: every shot of a turn has been fired, the turn being in the game's lastSalvo.
+    - EVENT_GAME_OVER: a player sank the last ship of the other.
+*/
+typedef enum {
+    EVENT_SHIP_PLACED,
+    EVENT_GAME_STARTED,
+    EVENT_SHOT_FIRED,
+    EVENT_HIT,
+    EVENT_MISS,
+    EVENT_SUNK,
+    EVENT_SALVO_RESOLVED,
+    EVENT_GAME_OVER,
+    GAME_EVENT_KINDS
+} GameEventKind;
+
+/*
+    GameEvent struct, contains a single event of a game. Contains:
+    - GameEventKind kind: what happened.
+    - struct Game *game: the game it happened in.
+    - int player: the player who placed the ship, fired the shot or won the game (0 or 1), -1 when the game
+      started.
+    - int cell: cell of the shot or first cell of the ship placed, given as (row * 10) + col, -1 otherwise.
+    - char ship: icon of the ship placed, hit or sunk, '\0' otherwise.
+*/
+struct GameEvent {
+    GameEventKind kind;
+    struct Game *game;
+    int player;
+    int cell;
+    char ship;
+};
+
+// functions
+
+bool subscribeGameEvents(void (*observer)(struct GameEvent *event), unsigned int kinds);
+void emitGameEvent(GameEventKind kind, struct Game *game, int player, int cell, char ship);
+void emitSalvoEvents(struct Game *game, int player);
+
+#endif
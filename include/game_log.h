@@ -0,0 +1,77 @@
+/*
+
+File Name: game_log.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for game_log.c.
+
+    INCLUDES
+    --------
+    record.h
+
+    MACROS
+    ------
+    1. LOG_BUFFER_BYTES
+    2. LOG_MAX_STAGES
+    3. LOG_BATCH_BUFFERS
+
+    ENUMS
+    -----
+    LogSync
+
+    FUNCTIONS
+    ---------
+    1. void setLogPath(char *path, LogSync sync)
+    2. char *getLogPath(void)
+    3. bool parseLogSync(char *name, LogSync *sync)
+    4. struct GameLog *openGameLog(void)
+    5. bool closeGameLog(struct GameLog *log)
+    6. struct LogStage *openLogStage(struct GameLog *log)
+    7. void closeLogStage(struct LogStage *stage)
+    8. void logGame(struct LogStage *stage, struct GameRecord *record)
+    9. void logEncodedGame(struct LogStage *stage, unsigned char *bytes, size_t size)
+    10. void flushLogStage(struct LogStage *stage)
+
+*/
+
+#ifndef GAME_LOG_H
+#define GAME_LOG_H
+
+#include <record.h>
+
+// macros
+#define LOG_BUFFER_BYTES (1 << 20) // size of each of the two buffers of a stage, at least MAX_RECORD_BYTES
+#define LOG_MAX_STAGES 128 // max no. of stages open on a log at the same time
+#define LOG_BATCH_BUFFERS 16 // max no. of full buffers the writer writes in one go
+
+/*
+    When the log asks the operating system to put what was written on disk.
+    - LOG_SYNC_NONE: never, leaving it to the operating system.
+    - LOG_SYNC_BATCH: after every batch of buffers written.
+    - LOG_SYNC_CLOSE: once, when the log is closed.
+*/
+typedef enum {
+    LOG_SYNC_NONE,
+    LOG_SYNC_BATCH,
+    LOG_SYNC_CLOSE
+} LogSync;
+
+struct GameLog;
+struct LogStage;
+
+// functions
+
+void setLogPath(char *path, LogSync sync);
+char *getLogPath(void);
+bool parseLogSync(char *name, LogSync *sync);
+struct GameLog *openGameLog(void);
+bool closeGameLog(struct GameLog *log);
+struct LogStage *openLogStage(struct GameLog *log);
+void closeLogStage(struct LogStage *stage);
+void logGame(struct LogStage *stage, struct GameRecord *record);
+void logEncodedGame(struct LogStage *stage, unsigned char *bytes, size_t size);
+void flushLogStage(struct LogStage *stage);
+
+#endif
@@ -0,0 +1,63 @@
+/*
+
+File Name: hint.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for hint.c.
+
+    INCLUDES
+    --------
+    expert.h
+
+    MACROS
+    ------
+    HINT_BUDGET_MS
+
+    STRUCTS
+    -------
+    HintView
+
+    FUNCTIONS
+    ---------
+    1. struct Hint *startHint(char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+    2. void updateHint(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+    3. bool readHint(struct Hint *hint, struct HintView *view)
+    4. void stopHint(struct Hint *hint)
+
+*/
+
+#ifndef HINT_H
+#define HINT_H
+
+#include <expert.h>
+
+// macros
+#define HINT_BUDGET_MS 500 // time the hint takes to work out the odds after every change of the board
+
+/*
+    HintView struct, contains the odds worked out by a hint. Contains:
+    - double odds[CELLS]: chance that each cell not guessed yet holds a ship.
+    - int best: cell not guessed yet most likely to give away where the ships are, -1 if there is none.
+    - bool exact: whether the odds were counted over every layout, rather than estimated from some of them.
+    - bool current: whether the odds take every guess made so far into account, rather than being worked out
+      for the board as it was before the last guesses.
+*/
+struct HintView {
+    double odds[CELLS];
+    int best;
+    bool exact;
+    bool current;
+};
+
+struct Hint;
+
+// functions
+
+struct Hint *startHint(char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS]);
+void updateHint(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS]);
+bool readHint(struct Hint *hint, struct HintView *view);
+void stopHint(struct Hint *hint);
+
+#endif
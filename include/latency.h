@@ -0,0 +1,63 @@
+/*
+
+File Name: latency.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for latency.c.
+
+    INCLUDES
+    --------
+    game.h
+
+    MACROS
+    ------
+    1. LATENCY_BUFFER_BYTES
+    2. LATENCY_TIMEOUT_MS
+    3. LATENCY_PROMPTS
+    4. LATENCY_DIRECTORY
+
+    ENUMS
+    -----
+    LatencyStep
+
+    FUNCTIONS
+    ---------
+    bool runLatencyBenchmark(char *program, int games)
+
+*/
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <game.h>
+
+// macros
+#define LATENCY_BUFFER_BYTES (1 << 16) // size of the buffer the output of the program is gathered in until a prompt
+#define LATENCY_TIMEOUT_MS 10000 // time the program has to show the next prompt before the benchmark gives up
+#define LATENCY_PROMPTS 11 // no. of prompts the benchmark knows how to answer
+#define LATENCY_DIRECTORY "/tmp/battleship-latency-XXXXXX" // template of the directory the program is run in
+
+/*
+    Kinds of lines the benchmark types, each timed on its own.
+    - STEP_MENU: a choice in a menu, a difficulty or an answer to a yes or no question.
+    - STEP_NAME: the name of a player.
+    - STEP_PLACEMENT: a ship to place or one of its ends.
+    - STEP_GUESS: a guess.
+    - STEP_CONTINUE: an empty line, to go on after a message.
+*/
+typedef enum {
+    STEP_MENU,
+    STEP_NAME,
+    STEP_PLACEMENT,
+    STEP_GUESS,
+    STEP_CONTINUE,
+    STEP_KINDS
+} LatencyStep;
+
+// functions
+
+bool runLatencyBenchmark(char *program, int games);
+
+#endif
@@ -0,0 +1,191 @@
+/*
+
+File Name: layout.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for layout.c.
+
+    INCLUDES
+    --------
+    player.h
+
+    MACROS
+    ------
+    1. CELLS
+    2. MAX_PLACEMENTS
+
+    STRUCTS
+    -------
+    1. CellMask
+    2. Placement
+    3. Random
+
+    FUNCTIONS
+    ---------
+    1. void initPlacements(void)
+    2. int getPlacements(Ships ship, const struct Placement **placements)
+    3. int findPlacement(Ships ship, int row, int col, bool vertical)
+    4. void drawFleet(struct Random *random, unsigned char fleet[SHIPS])
+    5. void placeFleet(struct Player *player, unsigned char fleet[SHIPS])
+    6. struct CellMask maskFromBoard(char board[BOARD_SIZE][BOARD_SIZE], char icon)
+    7. void seedRandom(struct Random *random, unsigned long long seed)
+    8. unsigned int nextRandom(struct Random *random, unsigned int bound)
+    9. unsigned long long nextSeed(struct Random *random)
+    10. unsigned long long randomSeed(void)
+    11. bool maskTest(struct CellMask mask, int cell)
+    12. void maskSet(struct CellMask *mask, int cell)
+    13. void maskClear(struct CellMask *mask, int cell)
+    14. bool masksOverlap(struct CellMask first, struct CellMask second)
+    15. bool maskIsSubset(struct CellMask mask, struct CellMask of)
+    16. bool maskIsEmpty(struct CellMask mask)
+    17. struct CellMask maskUnion(struct CellMask first, struct CellMask second)
+    18. struct CellMask maskIntersection(struct CellMask first, struct CellMask second)
+    19. struct CellMask maskDifference(struct CellMask mask, struct CellMask minus)
+    20. int maskCount(struct CellMask mask)
+    21. int maskLowest(struct CellMask mask)
+
+*/
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <player.h>
+
+// macros
+#define CELLS (BOARD_SIZE * BOARD_SIZE) // no. of cells on a board
+#define MAX_PLACEMENTS (2 * BOARD_SIZE * (BOARD_SIZE - 1)) // max no. of ways to place one ship, reached by the shortest
+
+/*
+    CellMask struct, a set of cells of a board. Cell (row * 10) + col is bit (cell % 64) of bits[cell / 64].
+*/
+struct CellMask {
+    unsigned long long bits[2];
+};
+
+/*
+    Placement struct, contains one way of placing a ship on an empty board. Contains:
+    - struct CellMask mask: the cells covered by the ship.
+    - unsigned char first: the top-left cell covered by the ship.
+    - unsigned char length: length of the ship.
+    - bool vertical: whether the ship runs down from first, instead of to the right.
+*/
+struct Placement {
+    struct CellMask mask;
+    unsigned char first;
+    unsigned char length;
+    bool vertical;
+};
+
+/*
+    Random struct, a random number generator owned by whoever uses it, so that threads never share one. Contains:
+    - unsigned long long state: state of the generator, never 0.
+*/
+struct Random {
+    unsigned long long state;
+};
+
+// functions
+
+void initPlacements(void);
+int getPlacements(Ships ship, const struct Placement **placements);
+int findPlacement(Ships ship, int row, int col, bool vertical);
+void drawFleet(struct Random *random, unsigned char fleet[SHIPS]);
+void placeFleet(struct Player *player, unsigned char fleet[SHIPS]);
+struct CellMask maskFromBoard(char board[BOARD_SIZE][BOARD_SIZE], char icon);
+void seedRandom(struct Random *random, unsigned long long seed);
+unsigned int nextRandom(struct Random *random, unsigned int bound);
+unsigned long long nextSeed(struct Random *random);
+unsigned long long randomSeed(void);
+
+// small mask operations, defined here so that the hot loops using them can inline them
+
+static inline bool maskTest(struct CellMask mask, int cell)
+{
+    return (mask.bits[cell >> 6] >> (cell & 63)) & 1;
+}
+
+static inline void maskSet(struct CellMask *mask, int cell)
+{
+    mask->bits[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+static inline void maskClear(struct CellMask *mask, int cell)
+{
+    mask->bits[cell >> 6] &= ~(1ULL << (cell & 63));
+}
+
+static inline bool masksOverlap(struct CellMask first, struct CellMask second)
+{
+    return ((first.bits[0] & second.bits[0]) | (first.bits[1] & second.bits[1])) != 0;
+}
+
+static inline bool maskIsSubset(struct CellMask mask, struct CellMask of)
+{
+    return ((mask.bits[0] & ~of.bits[0]) | (mask.bits[1] & ~of.bits[1])) == 0;
+}
+
+static inline bool maskIsEmpty(struct CellMask mask)
+{
+    return (mask.bits[0] | mask.bits[1]) == 0;
+}
+
+static inline struct CellMask maskUnion(struct CellMask first, struct CellMask second)
+{
+    struct CellMask mask = { { first.bits[0] | second.bits[0], first.bits[1] | second.bits[1] } };
+    return mask;
+}
+
+static inline struct CellMask maskIntersection(struct CellMask first, struct CellMask second)
+{
+    struct CellMask mask = { { first.bits[0] & second.bits[0], first.bits[1] & second.bits[1] } };
+    return mask;
+}
+
+static inline struct CellMask maskDifference(struct CellMask mask, struct CellMask minus)
+{
+    struct CellMask difference = { { mask.bits[0] & ~minus.bits[0], mask.bits[1] & ~minus.bits[1] } };
+    return difference;
+}
+
+static inline int maskCount(struct CellMask mask)
+{
+#ifdef __GNUC__
+    return __builtin_popcountll(mask.bits[0]) + __builtin_popcountll(mask.bits[1]);
+#else
+    int count = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (unsigned long long bits = mask.bits[i]; bits != 0; bits &= bits - 1)
+            count++;
+    }
+
+    return count;
+#endif
+}
+
+// returns the lowest cell in the mask, -1 if the mask is empty
+static inline int maskLowest(struct CellMask mask)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (mask.bits[i] == 0)
+            continue;
+#ifdef __GNUC__
+        return (i << 6) + __builtin_ctzll(mask.bits[i]);
+#else
+        int cell = i << 6;
+
+        for (unsigned long long bits = mask.bits[i]; (bits & 1) == 0; bits >>= 1)
+            cell++;
+
+        return cell;
+#endif
+    }
+
+    return -1;
+}
+
+#endif
@@ -0,0 +1,60 @@
+/*
+
+File Name: match.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for match.c.
+
+    INCLUDES
+    --------
+    bot.h
+
+    MACROS
+    ------
+    1. MATCH_BATCH_GAMES
+    2. MATCH_MAX_THREADS
+    3. MATCH_ALPHA
+    4. MATCH_BETA
+    5. MATCH_WIN_MARGIN
+    6. MATCH_SHOT_MARGIN
+
+    ENUMS
+    -----
+    MatchMetric
+
+    FUNCTIONS
+    ---------
+    bool runMatch(long long games, char *sides[2], MatchMetric metric, int threads, GameMode mode)
+
+*/
+
+#ifndef MATCH_H
+#define MATCH_H
+
+#include <bot.h>
+
+// macros
+#define MATCH_BATCH_GAMES 64 // no. of games every thread plays between two looks at the test, kept even so that both sides move first equally often
+#define MATCH_MAX_THREADS 64 // max no. of threads the games are played on
+#define MATCH_ALPHA 0.05 // chance of the test deciding the first player is stronger when it is not
+#define MATCH_BETA 0.05 // chance of the test deciding the first player is not stronger when it is
+#define MATCH_WIN_MARGIN 0.05 // how far above even the first player's win rate has to be to count as stronger
+#define MATCH_SHOT_MARGIN 1.0 // how many fewer shots the first player has to take to count as stronger
+
+/*
+    What a match tests the two players on.
+    - MATCH_WINS: the share of games the first player wins.
+    - MATCH_SHOTS: how many fewer shots than the second player the first player takes to sink the same fleet.
+*/
+typedef enum {
+    MATCH_WINS,
+    MATCH_SHOTS
+} MatchMetric;
+
+// functions
+
+bool runMatch(long long games, char *sides[2], MatchMetric metric, int threads, GameMode mode);
+
+#endif
@@ -0,0 +1,44 @@
+/*
+
+File Name: notation.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for notation.c.
+
+    INCLUDES
+    --------
+    record.h
+
+    MACROS
+    ------
+    1. NOTATION_BUFFER_BYTES
+    2. MAX_NOTATION_BYTES
+    3. NOTATION_MAX_ERRORS
+
+    FUNCTIONS
+    ---------
+    1. size_t formatNotation(struct GameRecord *record, char *buffer)
+    2. bool exportNotation(char *recordPath, char *textPath)
+    3. bool importNotation(char *textPath, char *recordPath)
+
+*/
+
+#ifndef NOTATION_H
+#define NOTATION_H
+
+#include <record.h>
+
+// macros
+#define NOTATION_BUFFER_BYTES (1 << 20) // size of the buffers text and records are read and written through
+#define MAX_NOTATION_BYTES (128 + 2 * (MAX_SIZE + 16) + 2 * (8 + 9 * SHIPS) + 3 * MAX_TURNS + 7 * MAX_SHOTS) // max no. of bytes a game takes in notation
+#define NOTATION_MAX_ERRORS 10 // no. of games skipped on import whose reason is printed
+
+// functions
+
+size_t formatNotation(struct GameRecord *record, char *buffer);
+bool exportNotation(char *recordPath, char *textPath);
+bool importNotation(char *textPath, char *recordPath);
+
+#endif
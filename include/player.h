@@ -11,7 +11,8 @@ Scenario:
 
     INCLUDES
     --------
-    stdbool.h
+    1. stdbool.h
+    2. stddef.h
 
     MACROS
     ------
@@ -19,13 +20,16 @@ Scenario:
     2. BOARD_SIZE
     3. SHIPS
 
-    ENUM
-    ----
-    Ships
+    ENUMS
+    -----
+    1. Ships
+    2. PlacementError
 
-    STRUCT
-    ------
-    Player
+    STRUCTS
+    -------
+    1. CellIndex
+    2. Player
+    3. SalvoResult
 
     GLOBAL VARIABLE
     ---------------
@@ -34,19 +38,36 @@ Scenario:
     FUNCTIONS
     ---------
     1. void createPlayer(int playerNum, bool createCPU)
-    2. void displayBoard(char board[BOARD_SIZE][BOARD_SIZE])
-    3. bool canPlaceShipOnBoard(int playerNum, char* startingPosition, char* endingPosition, Ships ship)
-    4. bool placeShipOnBoard(int playerNum, int *startArr, int *endArr, Ships ship)
-    5. bool checkWin(int playerTurn)
-    6. void mergeBoards(
+    2. void resetPlayer(struct Player *player)
+    3. void displayBoard(char board[BOARD_SIZE][BOARD_SIZE])
+    4. int formatBoard(char board[BOARD_SIZE][BOARD_SIZE], char *buffer, size_t bufferSize)
+    5. PlacementError canPlaceShipOnBoard(struct Player *player, char* startingPosition, char* endingPosition, Ships ship)
+    6. bool placeShipOnBoard(struct Player *player, int *startArr, int *endArr, Ships ship)
+    7. char resolveShot(struct Player *shooter, struct Player *target, int row, int col, char *sunkShip)
+    8. int fireSalvo(struct Player *shooter, struct Player *target, int *cells, int shots, struct SalvoResult *result)
+    9. bool checkWin(struct Player *opponent)
+    10. int countShipsLeft(struct Player *player)
+    11. char getShipIcon(Ships ship)
+    12. Ships getShipFromIcon(char icon)
+    13. char *getShipName(Ships ship)
+    14. int getShipLength(Ships ship)
+    15. void mergeBoards(
             char playerBoard[BOARD_SIZE][BOARD_SIZE], 
             char opponentActionBoard[BOARD_SIZE][BOARD_SIZE], 
             char merged[BOARD_SIZE][BOARD_SIZE]
         )
+    16. void indexUnguessedCells(struct Player *player)
+    17. void removeUnguessedCell(struct CellIndex *index, int cell)
+    18. int countUnguessedCells(struct CellIndex *index, int parity)
+    19. int pickUnguessedCell(struct CellIndex *index, int parity, unsigned int number)
 
 */
 
+#ifndef PLAYER_H
+#define PLAYER_H
+
 #include <stdbool.h>
+#include <stddef.h>
 
 // macros
 #define MAX_SIZE 50 // max size for name attribute in Player struct
@@ -62,12 +83,39 @@ typedef enum {
     PATROL
 } Ships;
 
+// reasons for which a ship cannot be placed on a board
+typedef enum {
+    PLACEMENT_OK,
+    PLACEMENT_START_OCCUPIED,
+    PLACEMENT_END_OCCUPIED,
+    PLACEMENT_DIAGONAL,
+    PLACEMENT_WRONG_LENGTH,
+    PLACEMENT_OVERLAP
+} PlacementError;
+
+/*
+    CellIndex struct, contains the cells of an action board that have not been guessed yet, split by parity, so
+    that a random one can be picked and a guessed one removed in constant time. Contains:
+    - unsigned char cells[2][BOARD_SIZE * BOARD_SIZE / 2]: the unguessed cells for which (row + col) % 2 is 0 and
+      1, in no particular order.
+    - int counts[2]: number of cells in each list.
+    - unsigned char positions[BOARD_SIZE * BOARD_SIZE]: position of every unguessed cell in its list.
+*/
+struct CellIndex
+{
+    unsigned char cells[2][BOARD_SIZE * BOARD_SIZE / 2];
+    int counts[2];
+    unsigned char positions[BOARD_SIZE * BOARD_SIZE];
+};
+
 /*
     Player struct, contains:
     - char name[MAX_SIZE]: contains the player's name.
     - char board[BOARD_SIZE][BOARD_SIZE]: array which stores the position of the player's ships.
     - char actionBoard[BOARD_SIZE][BOARD_SIZE]: array which stores player's guesses.
     - int shipsHP[SHIPS]: array which specifies the length of a ship.
+    - struct CellIndex unguessed: cells of actionBoard containing ' ', kept up to date by resetPlayer and
+      resolveShot. Code that writes actionBoard directly has to call indexUnguessedCells afterwards.
 */
 struct Player
 {
@@ -75,6 +123,24 @@ struct Player
     char board[BOARD_SIZE][BOARD_SIZE];
     char actionBoard[BOARD_SIZE][BOARD_SIZE];
     int shipsHP[SHIPS];
+    struct CellIndex unguessed;
+};
+
+/*
+    SalvoResult struct, contains the aggregated result of a salvo, i.e., of several shots fired together. Contains:
+    - int shots: number of shots fired.
+    - int hits: number of shots that hit a ship.
+    - int cells[SHIPS]: cell of each shot, given as (row * 10) + col.
+    - char statuses[SHIPS]: status of each shot, either 'H' or 'M', in the order the shots were fired.
+    - char sunkShips[SHIPS]: icon of the ship sunk by each shot, '\0' if the shot did not sink a ship.
+*/
+struct SalvoResult
+{
+    int shots;
+    int hits;
+    int cells[SHIPS];
+    char statuses[SHIPS];
+    char sunkShips[SHIPS];
 };
 
 // array of Player structs, storing the two players playing the game.
@@ -83,12 +149,27 @@ extern struct Player players[2];
 // functions
 
 void createPlayer(int playerNum, bool createCPU);
+void resetPlayer(struct Player *player);
 void displayBoard(char board[BOARD_SIZE][BOARD_SIZE]);
-bool canPlaceShipOnBoard(int playerNum, char* startingPosition, char* endingPosition, Ships ship);
-bool placeShipOnBoard(int playerNum, int *startArr, int *endArr, Ships ship);
-bool checkWin(int playerTurn);
+int formatBoard(char board[BOARD_SIZE][BOARD_SIZE], char *buffer, size_t bufferSize);
+PlacementError canPlaceShipOnBoard(struct Player *player, char* startingPosition, char* endingPosition, Ships ship);
+bool placeShipOnBoard(struct Player *player, int *startArr, int *endArr, Ships ship);
+char resolveShot(struct Player *shooter, struct Player *target, int row, int col, char *sunkShip);
+int fireSalvo(struct Player *shooter, struct Player *target, int *cells, int shots, struct SalvoResult *result);
+bool checkWin(struct Player *opponent);
+int countShipsLeft(struct Player *player);
+char getShipIcon(Ships ship);
+Ships getShipFromIcon(char icon);
+char *getShipName(Ships ship);
+int getShipLength(Ships ship);
 void mergeBoards(
     char playerBoard[BOARD_SIZE][BOARD_SIZE], 
     char opponentActionBoard[BOARD_SIZE][BOARD_SIZE], 
     char merged[BOARD_SIZE][BOARD_SIZE]
-);
\ No newline at end of file
+);
+void indexUnguessedCells(struct Player *player);
+void removeUnguessedCell(struct CellIndex *index, int cell);
+int countUnguessedCells(struct CellIndex *index, int parity);
+int pickUnguessedCell(struct CellIndex *index, int parity, unsigned int number);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+
+File Name: plugin.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for plugin.c.
+
+    INCLUDES
+    --------
+    strategy.h
+
+    MACROS
+    ------
+    1. MAX_STRATEGIES
+    2. STRATEGY_NAME_SIZE
+    3. STRATEGY_DIRECTORY
+    4. STRATEGY_SUFFIX
+
+    FUNCTIONS
+    ---------
+    1. const struct Strategy *loadStrategy(char *name)
+    2. int countStrategies(void)
+    3. const struct Strategy *getStrategy(int index)
+    4. const struct Strategy *findStrategy(const char *name)
+
+*/
+
+#ifndef PLUGIN_H
+#define PLUGIN_H
+
+#include <strategy.h>
+
+// macros
+#define MAX_STRATEGIES 8 // max no. of strategies that can be loaded
+#define STRATEGY_NAME_SIZE 32 // max size of a strategy's name, including the terminating '\0'
+#define STRATEGY_DIRECTORY "strategies" // directory strategies given by name alone are looked for in
+
+#ifdef _WIN32
+    #define STRATEGY_SUFFIX ".dll" // file extension of a strategy given by name alone
+#else
+    #define STRATEGY_SUFFIX ".so" // file extension of a strategy given by name alone
+#endif
+
+// functions
+
+const struct Strategy *loadStrategy(char *name);
+int countStrategies(void);
+const struct Strategy *getStrategy(int index);
+const struct Strategy *findStrategy(const char *name);
+
+#endif
@@ -0,0 +1,65 @@
+/*
+
+File Name: policy.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for policy.c and policy_table.c.
+
+    INCLUDES
+    --------
+    layout.h
+
+    MACROS
+    ------
+    1. POLICY_REACH
+    2. POLICY_PATTERNS
+    3. POLICY_SCALE
+    4. POLICY_TABLE_PATH
+    5. POLICY_GRID
+
+    GLOBAL VARIABLES
+    ----------------
+    1. const short _policyPatterns[POLICY_PATTERNS]
+    2. const short _policyCells[CELLS]
+
+    FUNCTIONS
+    ---------
+    1. void policyStates(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, unsigned char *states)
+    2. int policyPattern(const unsigned char *states, int cell)
+    3. void choosePolicyShot(
+            const short *patterns, const short *cells, char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk,
+            struct CellIndex *unguessed, struct Random *random, int *row, int *col
+        )
+    4. void markPolicySunk(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask *sunk, int row, int col, int length)
+
+*/
+
+#ifndef POLICY_H
+#define POLICY_H
+
+#include <layout.h>
+
+// macros
+#define POLICY_REACH 2 // no. of cells the policy looks at in every direction from the cell it scores
+#define POLICY_PATTERNS 6561 // no. of neighbourhoods the policy tells apart, 3 to the power of 4 * POLICY_REACH
+#define POLICY_SCALE 256 // what a log-odds of 1 is stored as in the policy's tables
+#define POLICY_TABLE_PATH "src/policy_table.c" // file the policy's tables are written to by the trainer
+#define POLICY_GRID (BOARD_SIZE + 2 * POLICY_REACH) // width of the board with the cells the policy looks at beyond it
+
+// tables of the policy CPU, generated by the trainer (see train.c), as log-odds times POLICY_SCALE
+extern const short _policyPatterns[POLICY_PATTERNS];
+extern const short _policyCells[CELLS];
+
+// functions
+
+void policyStates(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, unsigned char *states);
+int policyPattern(const unsigned char *states, int cell);
+void choosePolicyShot(
+    const short *patterns, const short *cells, char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk,
+    struct CellIndex *unguessed, struct Random *random, int *row, int *col
+);
+void markPolicySunk(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask *sunk, int row, int col, int length);
+
+#endif
@@ -0,0 +1,163 @@
+/*
+
+File Name: query.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for query.c.
+
+    INCLUDES
+    --------
+    record.h
+
+    MACROS
+    ------
+    1. INDEX_VERSION
+    2. QUERY_BLOCK
+    3. MAX_CONDITIONS
+    4. OPENING_SHOTS
+
+    ENUMS
+    -----
+    1. Column
+    2. ShotColumn
+    3. Aggregate
+
+    STRUCTS
+    -------
+    1. CorpusIndex
+    2. Condition
+    3. Query
+
+    FUNCTIONS
+    ---------
+    1. bool buildIndex(char *recordPath, char *indexPath)
+    2. bool loadIndex(char *indexPath, struct CorpusIndex *index)
+    3. void freeIndex(struct CorpusIndex *index)
+    4. bool parseQuery(char *text, struct Query *query)
+    5. bool runQuery(char *recordPath, char *text, int threads)
+
+*/
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <record.h>
+
+// macros
+#define INDEX_VERSION 1 // version of the index file format written by buildIndex
+#define QUERY_BLOCK 4096 // no. of games whose columns are scanned together
+#define MAX_CONDITIONS 16 // max no. of conditions in a query
+#define OPENING_SHOTS 8 // no. of shots of each player kept in the opening columns
+
+/*
+    The columns stored for every game, one byte per game.
+    - COLUMN_DIFFICULTY: difficulty of the CPU player, 0 if there was none.
+    - COLUMN_MODE: the GameMode of the game.
+    - COLUMN_CPU: the CPU player (1 or 2), 0 if there was none.
+    - COLUMN_WINNER: the player who won (1 or 2), 0 if the game was not finished.
+    - COLUMN_TURNS: number of turns played.
+    - COLUMN_SHOTS: number of shots fired.
+    - COLUMN_OPENING: two columns, one for each player, bit i is set if the player's (i + 1)th shot hit.
+    - COLUMN_SUNK: one column for every ship of each player's opponent, holding the turn (starting from 1) on
+      which the player sank the ship, 0 if it was not sunk. The column of player p and ship s is
+      COLUMN_SUNK + (p * SHIPS) + s.
+*/
+typedef enum {
+    COLUMN_DIFFICULTY,
+    COLUMN_MODE,
+    COLUMN_CPU,
+    COLUMN_WINNER,
+    COLUMN_TURNS,
+    COLUMN_SHOTS,
+    COLUMN_OPENING,
+    COLUMN_SUNK = COLUMN_OPENING + 2,
+    GAME_COLUMNS = COLUMN_SUNK + 2 * SHIPS
+} Column;
+
+/*
+    The columns stored for every shot, one byte per shot.
+    - SHOT_CELL: the cell fired at, given as (row * 10) + col.
+    - SHOT_OUTCOME: 0 for a miss, 1 for a hit, and 2 + the ship sunk if the shot sank a ship.
+    - SHOT_PLAYER: the player who fired the shot (0 or 1).
+*/
+typedef enum {
+    SHOT_CELL,
+    SHOT_OUTCOME,
+    SHOT_PLAYER,
+    SHOT_COLUMNS
+} ShotColumn;
+
+/*
+    What a query computes over the games that match its conditions.
+    - COUNT: the number of games.
+    - MINIMUM, MAXIMUM, MEAN, MEDIAN: a statistic of a game column. Games in which the ship of a COLUMN_SUNK
+      column was not sunk are left out.
+    - HIT_MAP, SHOT_MAP: how often a player hit, or fired at, each cell.
+*/
+typedef enum {
+    COUNT,
+    MINIMUM,
+    MAXIMUM,
+    MEAN,
+    MEDIAN,
+    HIT_MAP,
+    SHOT_MAP
+} Aggregate;
+
+/*
+    CorpusIndex struct, contains the columns of every game of a record file. Contains:
+    - long long games: number of games.
+    - long long shots: number of shots fired over all the games.
+    - unsigned char *columns[GAME_COLUMNS]: the game columns, indexed by Column.
+    - unsigned char *shotColumns[SHOT_COLUMNS]: the shot columns, indexed by ShotColumn.
+    - long long *shotStarts: index of the first shot of every game, shotStarts[games] is shots.
+*/
+struct CorpusIndex {
+    long long games;
+    long long shots;
+    unsigned char *columns[GAME_COLUMNS];
+    unsigned char *shotColumns[SHOT_COLUMNS];
+    long long *shotStarts;
+};
+
+/*
+    Condition struct, contains a condition a game has to meet to be counted by a query. Contains:
+    - Column column: the column compared.
+    - char operator: '=', '!', '<' or '>', '!' meaning not equal.
+    - unsigned char mask: bits of the column that are compared.
+    - unsigned char value: value compared with.
+*/
+struct Condition {
+    Column column;
+    char operator;
+    unsigned char mask;
+    unsigned char value;
+};
+
+/*
+    Query struct, contains a parsed query. Contains:
+    - Aggregate aggregate: what the query computes.
+    - Column column: the column aggregated by MINIMUM, MAXIMUM, MEAN and MEDIAN.
+    - int player: the player (0 or 1) whose shots are counted by HIT_MAP and SHOT_MAP.
+    - int conditionCount: number of conditions.
+    - struct Condition conditions[MAX_CONDITIONS]: conditions that every counted game meets.
+*/
+struct Query {
+    Aggregate aggregate;
+    Column column;
+    int player;
+    int conditionCount;
+    struct Condition conditions[MAX_CONDITIONS];
+};
+
+// functions
+
+bool buildIndex(char *recordPath, char *indexPath);
+bool loadIndex(char *indexPath, struct CorpusIndex *index);
+void freeIndex(struct CorpusIndex *index);
+bool parseQuery(char *text, struct Query *query);
+bool runQuery(char *recordPath, char *text, int threads);
+
+#endif
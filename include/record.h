@@ -0,0 +1,133 @@
+/*
+
+File Name: record.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for record.c.
+
+    INCLUDES
+    --------
+    game.h
+
+    MACROS
+    ------
+    1. RECORD_VERSION
+    2. MAX_SHOTS
+    3. MAX_TURNS
+    4. KEYFRAME_INTERVAL
+    5. MAX_KEYFRAMES
+    6. MAX_RECORD_BYTES
+
+    STRUCTS
+    -------
+    1. RecordedShot
+    2. Keyframe
+    3. GameRecord
+
+    FUNCTIONS
+    ---------
+    1. void beginRecord(struct GameRecord *record, struct Game *game)
+    2. void recordSalvo(struct GameRecord *record, int player, struct SalvoResult *result)
+    3. void finishRecord(struct GameRecord *record, int winner)
+    4. bool writeRecord(FILE *file, struct GameRecord *record)
+    5. bool readRecord(FILE *file, struct GameRecord *record)
+    6. bool appendRecord(char *path, struct GameRecord *record)
+    7. void seekRecord(struct GameRecord *record, int turn, struct Player state[2])
+    8. void beginPlayersRecord(struct GameRecord *record, GameMode mode, struct Player players[2], bool keyframed)
+    9. size_t encodeRecord(struct GameRecord *record, unsigned char *buffer)
+    10. bool skimRecord(FILE *file, struct GameRecord *record)
+
+*/
+
+#ifndef RECORD_H
+#define RECORD_H
+
+#include <game.h>
+
+// macros
+#define RECORD_VERSION 1 // version of the record file format written by writeRecord
+#define MAX_SHOTS (2 * BOARD_SIZE * BOARD_SIZE) // max no. of shots in a game, every cell of both boards
+#define MAX_TURNS MAX_SHOTS // max no. of turns in a game, a turn having at least one shot
+#define KEYFRAME_INTERVAL 8 // no. of turns between two keyframes
+#define MAX_KEYFRAMES (MAX_TURNS / KEYFRAME_INTERVAL + 1) // max no. of keyframes in a game
+#define MAX_RECORD_BYTES (16 + 2 * MAX_SIZE + 2 * BOARD_SIZE * BOARD_SIZE + 3 * MAX_SHOTS \
+    + MAX_KEYFRAMES * (2 * BOARD_SIZE * BOARD_SIZE + 2 * SHIPS)) // max no. of bytes a game takes in a record file
+
+/*
+    RecordedShot struct, contains a single recorded shot. Contains:
+    - unsigned char player: the player who fired the shot (0 or 1).
+    - unsigned char cell: the cell fired at, given as (row * 10) + col.
+    - char outcome: 'M' for a miss, 'H' for a hit, or the icon of the ship sunk by the shot.
+*/
+struct RecordedShot
+{
+    unsigned char player;
+    unsigned char cell;
+    char outcome;
+};
+
+/*
+    Keyframe struct, contains everything that changes during a game, as it was at the start of a turn. Seeking
+    to a turn only has to replay the turns after the keyframe before it. Contains:
+    - char actionBoards[2][BOARD_SIZE][BOARD_SIZE]: action boards of both players.
+    - int shipsHP[2][SHIPS]: hit points of the ships of both players.
+*/
+struct Keyframe
+{
+    char actionBoards[2][BOARD_SIZE][BOARD_SIZE];
+    int shipsHP[2][SHIPS];
+};
+
+/*
+    GameRecord struct, contains a complete game as it was played. Contains:
+    - GameMode mode: the rules with which the game was played.
+    - bool cpuPlayer: whether or not player cpuTurn was a CPU.
+    - int cpuTurn: index of the CPU player (0 or 1).
+    - Difficulty difficulty: difficulty of the CPU player.
+    - int winner: index of the player who won (0 or 1), -1 while the game is still being played.
+    - char names[2][MAX_SIZE]: names of both players.
+    - char boards[2][BOARD_SIZE][BOARD_SIZE]: ship placements of both players.
+    - int shotCount: number of shots fired.
+    - int turnCount: number of turns played.
+    - struct RecordedShot shots[MAX_SHOTS]: every shot, in the order in which they were fired.
+    - short turnStarts[MAX_TURNS + 1]: index of the first shot of every turn, turnStarts[turnCount] is shotCount.
+    - int keyframeCount: number of keyframes.
+    - struct Keyframe keyframes[MAX_KEYFRAMES]: keyframe i holds the state at the start of turn
+      i * KEYFRAME_INTERVAL.
+    - bool keyframed: whether keyframes are stored as the game is recorded. Without them, only the keyframe at
+      the start is stored, which makes the record smaller and quicker to make but slower to seek in.
+*/
+struct GameRecord
+{
+    GameMode mode;
+    bool cpuPlayer;
+    int cpuTurn;
+    Difficulty difficulty;
+    int winner;
+    char names[2][MAX_SIZE];
+    char boards[2][BOARD_SIZE][BOARD_SIZE];
+    int shotCount;
+    int turnCount;
+    struct RecordedShot shots[MAX_SHOTS];
+    short turnStarts[MAX_TURNS + 1];
+    int keyframeCount;
+    struct Keyframe keyframes[MAX_KEYFRAMES];
+    bool keyframed;
+};
+
+// functions
+
+void beginRecord(struct GameRecord *record, struct Game *game);
+void recordSalvo(struct GameRecord *record, int player, struct SalvoResult *result);
+void finishRecord(struct GameRecord *record, int winner);
+bool writeRecord(FILE *file, struct GameRecord *record);
+bool readRecord(FILE *file, struct GameRecord *record);
+bool appendRecord(char *path, struct GameRecord *record);
+void seekRecord(struct GameRecord *record, int turn, struct Player state[2]);
+void beginPlayersRecord(struct GameRecord *record, GameMode mode, struct Player players[2], bool keyframed);
+size_t encodeRecord(struct GameRecord *record, unsigned char *buffer);
+bool skimRecord(FILE *file, struct GameRecord *record);
+
+#endif
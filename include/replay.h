@@ -0,0 +1,38 @@
+/*
+
+File Name: replay.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for replay.c.
+
+    INCLUDES
+    --------
+    record.h
+
+    MACROS
+    ------
+    1. MAX_REPLAY_SPEED
+    2. REPLAY_LIST_GAMES
+
+    FUNCTIONS
+    ---------
+    1. void runReplay(char *path, long long game)
+
+*/
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <record.h>
+
+// macros
+#define MAX_REPLAY_SPEED 10 // max no. of turns shown per second while a replay is playing
+#define REPLAY_LIST_GAMES 20 // no. of games listed to choose from, the others being chosen by number
+
+// functions
+
+void runReplay(char *path, long long game);
+
+#endif
@@ -0,0 +1,48 @@
+/*
+
+File Name: snapshot.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for snapshot.c.
+
+    INCLUDES
+    --------
+    1. game.h
+    2. plugin.h
+
+    MACROS
+    ------
+    1. SNAPSHOT_VERSION
+    2. SNAPSHOT_SIZE
+    3. SNAPSHOT_PATH
+
+    FUNCTIONS
+    ---------
+    1. void encodeSnapshot(struct Game *game, unsigned char buffer[SNAPSHOT_SIZE])
+    2. bool decodeSnapshot(unsigned char buffer[SNAPSHOT_SIZE], struct Game *game)
+    3. bool saveSnapshot(char *path, struct Game *game)
+    4. bool loadSnapshot(char *path, struct Game *game)
+
+*/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <game.h>
+#include <plugin.h>
+
+// macros
+#define SNAPSHOT_VERSION 2 // version of the snapshot format written by encodeSnapshot
+#define SNAPSHOT_SIZE (52 + CHECKOUT_SIZE + STRATEGY_NAME_SIZE + 2 * (MAX_SIZE + 2 * BOARD_SIZE * BOARD_SIZE + SHIPS)) // size of a snapshot in bytes
+#define SNAPSHOT_PATH "battleship.sav" // file the game in progress is saved to
+
+// functions
+
+void encodeSnapshot(struct Game *game, unsigned char buffer[SNAPSHOT_SIZE]);
+bool decodeSnapshot(unsigned char buffer[SNAPSHOT_SIZE], struct Game *game);
+bool saveSnapshot(char *path, struct Game *game);
+bool loadSnapshot(char *path, struct Game *game);
+
+#endif
@@ -0,0 +1,46 @@
+/*
+
+File Name: spectate.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for spectate.c.
+
+    INCLUDES
+    --------
+    game.h
+
+    MACROS
+    ------
+    1. SPECTATOR_FRAME_SIZE
+    2. SPECTATOR_QUEUE
+    3. SPECTATOR_MAX
+
+    FUNCTIONS
+    ---------
+    1. struct SpectatorServer *openSpectatorServer(char *address)
+    2. void publishGame(struct SpectatorServer *server, struct Game *game, int shooter)
+    3. void closeSpectatorServer(struct SpectatorServer *server)
+
+*/
+
+#ifndef SPECTATE_H
+#define SPECTATE_H
+
+#include <game.h>
+
+// macros
+#define SPECTATOR_FRAME_SIZE 4096 // max size of the text sent to spectators for one state of a game
+#define SPECTATOR_QUEUE 8 // max no. of states a spectator can fall behind before it is dropped
+#define SPECTATOR_MAX 1024 // max no. of spectators watching at the same time
+
+struct SpectatorServer;
+
+// functions
+
+struct SpectatorServer *openSpectatorServer(char *address);
+void publishGame(struct SpectatorServer *server, struct Game *game, int shooter);
+void closeSpectatorServer(struct SpectatorServer *server);
+
+#endif
@@ -30,6 +30,9 @@ ________________________________________________________________________________
 
 */
 
+#ifndef STACK_H
+#define STACK_H
+
 // macros
 #define STACK_EMPTY 214424
 
@@ -54,4 +57,6 @@ short isStackEmpty(struct Stack *stack);
 short stackContains(struct Stack *stack, int value);
 void clearStack(struct Stack *stack);
 void printStack(struct Stack *stack);
-void destoryStack(struct Stack *stackPtr);
\ No newline at end of file
+void destoryStack(struct Stack *stackPtr);
+
+#endif
\ No newline at end of file
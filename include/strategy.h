@@ -0,0 +1,78 @@
+/*
+
+File Name: strategy.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Interface between the game and CPU strategies loaded from shared libraries. A strategy is a shared library
+    (.so, or .dll on Windows) built against this header alone, which exports a function named STRATEGY_ENTRY
+    returning its Strategy. Only plain C types cross the interface, and STRATEGY_ABI_VERSION changes whenever
+    anything in this file does, so that a strategy built against another version is refused rather than
+    misread.
+
+    A strategy is used for one game at a time: init is called before its first shot, chooseShot once for every
+    shot, observeResult once for every shot after the shot is resolved, and free at the end of the game. In a
+    salvo every shot is chosen before any of them is resolved. A game that is resumed calls init again and then
+    observeResult for every shot made so far, followed by one more result for a cell of every sunk ship.
+
+    MACROS
+    ------
+    1. STRATEGY_ABI_VERSION
+    2. STRATEGY_ENTRY
+    3. STRATEGY_BOARD_SIZE
+    4. STRATEGY_SHIPS
+
+    STRUCTS
+    -------
+    1. StrategyView
+    2. Strategy
+
+*/
+
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+// macros
+#define STRATEGY_ABI_VERSION 1 // version of the interface described in this file
+#define STRATEGY_ENTRY "battleshipStrategy" // name of the function every strategy exports
+#define STRATEGY_BOARD_SIZE 10 // size of the game board, the same as BOARD_SIZE
+#define STRATEGY_SHIPS 5 // no. of ships, the same as SHIPS
+
+/*
+    StrategyView struct, contains what a strategy may look at when choosing a shot. Contains:
+    - const char (*actionBoard)[STRATEGY_BOARD_SIZE]: the strategy's guesses, indexed by row and then column,
+      ' ' for a cell not guessed, 'X' for a hit, 'O' for a miss, and '*' for a cell already chosen earlier in
+      the same salvo.
+    - int shipLengths[STRATEGY_SHIPS]: length of every ship, carrier first and patrol boat last.
+    - long long microsecondsLeft: time the strategy may still spend on the shot.
+*/
+struct StrategyView {
+    const char (*actionBoard)[STRATEGY_BOARD_SIZE];
+    int shipLengths[STRATEGY_SHIPS];
+    long long microsecondsLeft;
+};
+
+/*
+    Strategy struct, contains a strategy's hooks. Contains:
+    - int abiVersion: STRATEGY_ABI_VERSION as the strategy was built with.
+    - const char *name: name of the strategy, shown in the menu.
+    - void *(*init)(unsigned long long seed): creates the strategy's state for a new game, seeding any random
+      choices with seed. Returns `NULL` only if the state could not be created.
+    - void (*chooseShot)(void *state, const struct StrategyView *view, int *row, int *col): chooses the next
+      cell to guess, which has to be a cell holding ' ' in view.
+    - void (*observeResult)(void *state, int row, int col, char result, char sunk): tells the strategy the
+      result of a guess, 'H' for a hit or 'M' for a miss, and the icon of the ship it sank ('C', 'B', 'D',
+      'S' or 'P'), '\0' if none.
+    - void (*free)(void *state): frees the state created by init.
+*/
+struct Strategy {
+    int abiVersion;
+    const char *name;
+    void *(*init)(unsigned long long seed);
+    void (*chooseShot)(void *state, const struct StrategyView *view, int *row, int *col);
+    void (*observeResult)(void *state, int row, int col, char result, char sunk);
+    void (*free)(void *state);
+};
+
+#endif
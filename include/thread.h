@@ -0,0 +1,100 @@
+/*
+
+File Name: thread.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for thread.c.
+
+    STRUCTS
+    -------
+    1. Thread
+    2. Mutex
+    3. ConditionVariable
+
+    FUNCTIONS
+    ---------
+    1. bool startThread(struct Thread *thread, void *(*function)(void *argument), void *argument)
+    2. void joinThread(struct Thread *thread)
+    3. void runShares(void *(*work)(void *task), void *tasks, size_t taskSize, int count)
+    4. int countProcessors(void)
+    5. void initMutex(struct Mutex *mutex)
+    6. void lockMutex(struct Mutex *mutex)
+    7. void unlockMutex(struct Mutex *mutex)
+    8. void destroyMutex(struct Mutex *mutex)
+    9. void initCondition(struct ConditionVariable *condition)
+    10. void waitCondition(struct ConditionVariable *condition, struct Mutex *mutex)
+    11. void signalCondition(struct ConditionVariable *condition)
+    12. void destroyCondition(struct ConditionVariable *condition)
+
+*/
+
+#ifndef THREAD_H
+#define THREAD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+/*
+    Thread struct, contains a thread started by startThread. Contains:
+    - handle: the thread, as given by the operating system.
+    - void *(*function)(void *argument): function being run by the thread.
+    - void *argument: argument given to function.
+*/
+struct Thread {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    void *(*function)(void *argument);
+    void *argument;
+};
+
+/*
+    Mutex struct, contains a lock that only one thread can hold at a time. Contains:
+    - handle: the lock, as given by the operating system.
+*/
+struct Mutex {
+#ifdef _WIN32
+    CRITICAL_SECTION handle;
+#else
+    pthread_mutex_t handle;
+#endif
+};
+
+/*
+    ConditionVariable struct, contains a condition threads can wait on until another thread signals it. Contains:
+    - handle: the condition, as given by the operating system.
+*/
+struct ConditionVariable {
+#ifdef _WIN32
+    CONDITION_VARIABLE handle;
+#else
+    pthread_cond_t handle;
+#endif
+};
+
+// functions
+
+bool startThread(struct Thread *thread, void *(*function)(void *argument), void *argument);
+void joinThread(struct Thread *thread);
+void runShares(void *(*work)(void *task), void *tasks, size_t taskSize, int count);
+int countProcessors(void);
+void initMutex(struct Mutex *mutex);
+void lockMutex(struct Mutex *mutex);
+void unlockMutex(struct Mutex *mutex);
+void destroyMutex(struct Mutex *mutex);
+void initCondition(struct ConditionVariable *condition);
+void waitCondition(struct ConditionVariable *condition, struct Mutex *mutex);
+void signalCondition(struct ConditionVariable *condition);
+void destroyCondition(struct ConditionVariable *condition);
+
+#endif
@@ -0,0 +1,23 @@
+/*
+
+File Name: timing.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for timing.c.
+
+    FUNCTIONS
+    ---------
+    1. long long monotonicMicroseconds(void)
+
+*/
+
+#ifndef TIMING_H
+#define TIMING_H
+
+// functions
+
+long long monotonicMicroseconds(void);
+
+#endif
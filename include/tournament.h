@@ -0,0 +1,48 @@
+/*
+
+File Name: tournament.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for tournament.c.
+
+    INCLUDES
+    --------
+    bot.h
+
+    MACROS
+    ------
+    1. TOURNAMENT_SHARD_GAMES
+    2. TOURNAMENT_MAX_WORKERS
+    3. TOURNAMENT_MAX_ATTEMPTS
+    4. TOURNAMENT_FIRST_TIMEOUT_MS
+    5. TOURNAMENT_MIN_TIMEOUT_MS
+    6. TOURNAMENT_SLOW_FACTOR
+    7. TOURNAMENT_BINS
+
+    FUNCTIONS
+    ---------
+    bool runTournament(long long games, char *sides[2], int workers, int shardGames, GameMode mode)
+
+*/
+
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include <bot.h>
+
+// macros
+#define TOURNAMENT_SHARD_GAMES 500 // no. of games in a shard unless told otherwise
+#define TOURNAMENT_MAX_WORKERS 64 // max no. of worker processes
+#define TOURNAMENT_MAX_ATTEMPTS 3 // no. of times a shard is handed out before it is given up on
+#define TOURNAMENT_FIRST_TIMEOUT_MS 600000 // time a worker has to finish a shard before any shard has been finished
+#define TOURNAMENT_MIN_TIMEOUT_MS 2000 // least time a worker has to finish a shard
+#define TOURNAMENT_SLOW_FACTOR 4 // how many times the mean time of a shard a worker has to finish one
+#define TOURNAMENT_BINS (CELLS + 1) // no. of bins of the histograms of shots taken to win, one per no. of shots
+
+// functions
+
+bool runTournament(long long games, char *sides[2], int workers, int shardGames, GameMode mode);
+
+#endif
@@ -0,0 +1,57 @@
+/*
+
+File Name: trace.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for trace.c.
+
+    INCLUDES
+    --------
+    stdbool.h
+
+    MACROS
+    ------
+    1. TRACE_RING_EVENTS
+    2. TRACE_MAX_THREADS
+    3. TRACE_BEGIN(name)
+    4. TRACE_END(name)
+    5. TRACE_MARK(name)
+
+    GLOBAL VARIABLE
+    ---------------
+    bool _tracing
+
+    FUNCTIONS
+    ---------
+    1. bool startTrace(char *path)
+    2. void traceEvent(char phase, const char *name)
+
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+// macros
+#define TRACE_RING_EVENTS (1 << 15) // no. of events kept per thread, older ones being overwritten, a power of 2
+#define TRACE_MAX_THREADS 256 // max no. of threads traced at once, events of any other thread running alongside them are dropped
+
+// marks the beginning of a span on the calling thread, name being a string literal
+#define TRACE_BEGIN(name) do { if (_tracing) traceEvent('B', name); } while (0)
+// marks the end of the span last begun on the calling thread with the same name
+#define TRACE_END(name) do { if (_tracing) traceEvent('E', name); } while (0)
+// marks a single point in time on the calling thread, within whatever span is open
+#define TRACE_MARK(name) do { if (_tracing) traceEvent('i', name); } while (0)
+
+// stores whether events are being traced, so that tracing costs a single test when it is off
+extern bool _tracing;
+
+// functions
+
+bool startTrace(char *path);
+void traceEvent(char phase, const char *name);
+
+#endif
@@ -0,0 +1,44 @@
+/*
+
+File Name: train.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for train.c.
+
+    INCLUDES
+    --------
+    policy.h
+
+    MACROS
+    ------
+    1. TRAIN_GENERATIONS
+    2. TRAIN_EXPLORATION
+    3. TRAIN_PRIOR_WEIGHT
+    4. TRAIN_EVALUATION_GAMES
+    5. TRAIN_MAX_THREADS
+
+    FUNCTIONS
+    ---------
+    bool runTraining(long long games, char *path, int threads)
+
+*/
+
+#ifndef TRAIN_H
+#define TRAIN_H
+
+#include <policy.h>
+
+// macros
+#define TRAIN_GENERATIONS 4 // no. of times the tables are rebuilt while training, each from the games played so far
+#define TRAIN_EXPLORATION 10 // percentage of shots fired at random while training, so that rarer boards are seen too
+#define TRAIN_PRIOR_WEIGHT 2 // no. of made-up observations at the overall hit rate every count starts from
+#define TRAIN_EVALUATION_GAMES 20000 // no. of games the trained policy plays, without exploring, to measure it
+#define TRAIN_MAX_THREADS 64 // max no. of threads the games are played on
+
+// functions
+
+bool runTraining(long long games, char *path, int threads);
+
+#endif
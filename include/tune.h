@@ -0,0 +1,52 @@
+/*
+
+File Name: tune.h
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Header file for tune.c.
+
+    INCLUDES
+    --------
+    cpu.h
+
+    MACROS
+    ------
+    1. HARD_PARAMETERS_PATH
+    2. TUNE_PARAMETERS
+    3. TUNE_MAX_CANDIDATES
+    4. TUNE_MAX_THREADS
+    5. TUNE_MAX_ROUNDS
+    6. TUNE_CHECKOUT_STEP
+    7. TUNE_SIGNIFICANCE
+
+    FUNCTIONS
+    ---------
+    1. bool loadHardParameters(char *path, struct HardParameters *parameters)
+    2. bool writeHardParameters(char *path, struct HardParameters parameters, double shots)
+    3. bool runTuning(long long games, char *path, int threads)
+
+*/
+
+#ifndef TUNE_H
+#define TUNE_H
+
+#include <cpu.h>
+
+// macros
+#define HARD_PARAMETERS_PATH "hard_parameters.txt" // file the hard CPU's choices are read from when the program starts
+#define TUNE_PARAMETERS 4 // no. of choices of the hard CPU the tuner searches
+#define TUNE_MAX_CANDIDATES (2 + NEIGHBOUR_ORDERS + 4) // max no. of settings tried in one round, the current one and its neighbours
+#define TUNE_MAX_THREADS 64 // max no. of threads the games are played on
+#define TUNE_MAX_ROUNDS 30 // max no. of rounds the tuner searches for
+#define TUNE_CHECKOUT_STEP 8 // first step the tuner takes in the size of the checkout stack
+#define TUNE_SIGNIFICANCE 2.0 // no. of standard errors by which a setting has to beat the current one to replace it
+
+// functions
+
+bool loadHardParameters(char *path, struct HardParameters *parameters);
+bool writeHardParameters(char *path, struct HardParameters parameters, double shots);
+bool runTuning(long long games, char *path, int threads);
+
+#endif
@@ -0,0 +1,853 @@
+/*
+
+File Name: arena.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the arena, which plays many games between two players, each a CPU or a bot speaking the protocol
+    described in bot.c, and reports how each of them did.
+
+    Several games are played at the same time, each with its own bot processes, which are started once and
+    kept for every game played in their place, so that a bot starts up only once however many games it plays.
+    The arena never waits on a single bot: it sends every request as soon as the game it belongs to needs it,
+    and then waits on all the bots with a request outstanding at once, handling their replies in whatever order
+    they come. Moves are checked and resolved by the same code as in a game played on the terminal. A bot has
+    the CPU's time budget, and ARENA_GRACE_MS more, to answer each request, and a bot that answers late or
+    exits loses the game and is started again, while a bot that answers wrongly only loses the game. The side
+    moving first changes from one game to the next.
+
+    If a log is set, every game in which both fleets were placed is logged once it is over, forfeited or not.
+
+    Bots are not available on Windows, where only CPUs can play in the arena.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. arena.h
+    2. defence.h
+    3. thread.h
+    4. timing.h
+    5. game_log.h
+
+    STRUCTS
+    -------
+    1. ArenaSide
+    2. ArenaSeat
+    3. ArenaSlot
+    4. Arena
+
+    FUNCTIONS (global)
+    ------------------
+    bool runArena(int games, char *sides[2], int pool, GameMode mode)
+
+    FUNCTIONS (local)
+    -----------------
+    1. bool parseSide(struct ArenaSide *side, char *spec)
+    2. void beginGame(struct Arena *arena, struct ArenaSlot *slot)
+    3. void playMoves(struct Arena *arena, struct ArenaSlot *slot)
+    4. void waitReplies(struct Arena *arena)
+    5. void handleReply(struct Arena *arena, struct ArenaSlot *slot, int seat, char *line)
+    6. void failSeat(struct Arena *arena, struct ArenaSlot *slot, int seat, char *reason, bool restart)
+    7. void finishGame(struct Arena *arena, struct ArenaSlot *slot, int winner, bool forfeit)
+    8. void restartBot(struct Arena *arena, struct ArenaSlot *slot, int seat)
+    9. bool readPlacement(struct Player *player, char *reply)
+    10. bool readSalvo(struct Player *shooter, char *reply, int shots, int cells[SHIPS])
+    11. void reportSalvo(struct Arena *arena, struct ArenaSlot *slot, int shooter, struct SalvoResult *result)
+    12. bool isIdle(struct ArenaSlot *slot)
+    13. void printSummary(struct Arena *arena, double seconds)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <arena.h>
+#include <defence.h>
+#include <thread.h>
+#include <timing.h>
+#include <game_log.h>
+#include <ctype.h>
+#include <limits.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <poll.h>
+#endif
+
+/*
+    ArenaSide struct, contains one of the two players of the arena and how it did. Contains:
+    - char *command: shell command running the player, NULL for a CPU.
+    - Difficulty difficulty: difficulty of a CPU.
+    - const struct Strategy *strategy: strategy of a CPU on plugin difficulty.
+    - char name[MAX_SIZE]: name of the player, as given by the bot or on the command line.
+    - int wins: number of games won.
+    - int forfeits: number of games lost by answering late, answering wrongly or exiting.
+    - int sinkingWins: number of games won by sinking the opponent's fleet.
+    - long long shots: total shots fired in the games won by sinking the opponent's fleet.
+*/
+struct ArenaSide {
+    char *command;
+    Difficulty difficulty;
+    const struct Strategy *strategy;
+    char name[MAX_SIZE];
+    int wins;
+    int forfeits;
+    int sinkingWins;
+    long long shots;
+};
+
+/*
+    ArenaSeat struct, contains a player in one of the games played at the same time. Contains:
+    - struct BotProcess bot: the bot, kept from one game to the next.
+    - bool running: whether bot is running.
+    - struct CPUState cpu: state of a CPU during the current game.
+    - char request: request the bot is to answer, 'P' for a placement, 'S' for a shot, 'D' for one whose
+      game is over and whose reply is thrown away, '\0' if none.
+    - long long deadline: time, as given by monotonicMicroseconds, by which the request has to be answered.
+    - int shots: number of shots asked for by a shot request.
+    - int fired: number of shots fired in the current game.
+*/
+struct ArenaSeat {
+    struct BotProcess bot;
+    bool running;
+    struct CPUState cpu;
+    char request;
+    long long deadline;
+    int shots;
+    int fired;
+};
+
+/*
+    ArenaSlot struct, contains one of the games played at the same time. Contains:
+    - struct ArenaSeat seats[2]: the players, seats[i] playing for the arena's side i.
+    - struct Player players[2]: the boards of the players.
+    - bool playing: whether a game is being played.
+    - int game: number of the game, counting from 0.
+    - int turn: seat whose turn it is.
+    - struct GameRecord *record: record of the game, NULL if games are not logged.
+    - bool recording: whether the game is being recorded, which it is once both fleets have been placed.
+*/
+struct ArenaSlot {
+    struct ArenaSeat seats[2];
+    struct Player players[2];
+    bool playing;
+    int game;
+    int turn;
+    struct GameRecord *record;
+    bool recording;
+};
+
+/*
+    Arena struct, contains everything the arena keeps track of. Contains:
+    - struct ArenaSide sides[2]: the two players.
+    - GameMode mode: rules the games are played with.
+    - int budget: time, in milliseconds, a player may spend on one move.
+    - int games: number of games to play.
+    - int started: number of games started.
+    - int finished: number of games finished.
+    - int pool: number of games played at the same time.
+    - struct ArenaSlot *slots: the games played at the same time.
+    - struct LogStage *stage: stage the games are logged into, NULL if they are not logged.
+*/
+struct Arena {
+    struct ArenaSide sides[2];
+    GameMode mode;
+    int budget;
+    int games;
+    int started;
+    int finished;
+    int pool;
+    struct ArenaSlot *slots;
+    struct LogStage *stage;
+};
+
+bool parseSide(struct ArenaSide *side, char *spec);
+void beginGame(struct Arena *arena, struct ArenaSlot *slot);
+void playMoves(struct Arena *arena, struct ArenaSlot *slot);
+void waitReplies(struct Arena *arena);
+void handleReply(struct Arena *arena, struct ArenaSlot *slot, int seat, char *line);
+void failSeat(struct Arena *arena, struct ArenaSlot *slot, int seat, char *reason, bool restart);
+void finishGame(struct Arena *arena, struct ArenaSlot *slot, int winner, bool forfeit);
+void restartBot(struct Arena *arena, struct ArenaSlot *slot, int seat);
+bool readPlacement(struct Player *player, char *reply);
+bool readSalvo(struct Player *shooter, char *reply, int shots, int cells[SHIPS]);
+void reportSalvo(struct Arena *arena, struct ArenaSlot *slot, int shooter, struct SalvoResult *result);
+bool isIdle(struct ArenaSlot *slot);
+void printSummary(struct Arena *arena, double seconds);
+
+/*
+    Plays games between two players and prints how each of them did.
+
+    Parameters
+    ----------
+    `int games`:
+        Number of games to play.
+
+    `char *sides[2]`:
+        The players, each easy, hard, expert, policy, plugin:NAME for a CPU playing with a strategy, or
+        bot:COMMAND for a bot run by the shell command COMMAND.
+
+    `int pool`:
+        Number of games to play at the same time, at most ARENA_MAX_POOL.
+
+    `GameMode mode`:
+        Rules the games are played with.
+
+    Returns
+    -------
+    Returns `true` if the games were played, else it returns `false`.
+*/
+bool runArena(int games, char *sides[2], int pool, GameMode mode)
+{
+    struct Arena arena = { .mode = mode, .budget = getCPUBudget(), .games = games };
+    struct GameLog *gameLog = NULL;
+    struct GameRecord *records = NULL;
+    char line[BOT_LINE_SIZE];
+    bool ready = true;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (!parseSide(&arena.sides[i], sides[i]))
+        {
+            printf("Unknown player \"%s\", expected easy, hard, expert, policy, plugin:NAME or bot:COMMAND.\n", sides[i]);
+            return false;
+        }
+    }
+
+    pool = pool < games ? pool : games;
+    pool = pool > ARENA_MAX_POOL ? ARENA_MAX_POOL : (pool < 1 ? 1 : pool);
+    arena.pool = pool;
+    arena.slots = (struct ArenaSlot *) calloc(pool, sizeof(struct ArenaSlot));
+
+    if (arena.slots == NULL)
+        return false;
+
+    if (getLogPath() != NULL)
+    {
+        if ((gameLog = openGameLog()) == NULL)
+        {
+            free(arena.slots);
+            return false;
+        }
+
+        records = (struct GameRecord *) malloc(pool * sizeof(struct GameRecord));
+        arena.stage = records != NULL ? openLogStage(gameLog) : NULL;
+
+        if (arena.stage == NULL)
+        {
+            printf("Could not allocate memory to log the games.\n");
+            closeGameLog(gameLog);
+            free(records);
+            free(arena.slots);
+            return false;
+        }
+
+        for (int i = 0; i < pool; i++)
+            arena.slots[i].record = &records[i];
+    }
+
+    for (int i = 0; i < pool && ready; i++)
+    {
+        for (int j = 0; j < 2 && ready; j++)
+        {
+            if (arena.sides[j].command != NULL)
+                ready = arena.slots[i].seats[j].running = startBot(&arena.slots[i].seats[j].bot, arena.sides[j].command);
+        }
+    }
+
+    for (int i = 0; i < 2 && ready; i++)
+    {
+        if (arena.sides[i].command != NULL)
+            strcpy(arena.sides[i].name, arena.slots[0].seats[i].bot.name);
+    }
+
+    long long start = monotonicMicroseconds();
+
+    while (ready && arena.finished < games)
+    {
+        for (int i = 0; i < pool; i++)
+        {
+            // a game between CPUs is over as soon as it begins, so the next one can begin at once
+            while (!arena.slots[i].playing && isIdle(&arena.slots[i]) && arena.started < games)
+                beginGame(&arena, &arena.slots[i]);
+        }
+
+        waitReplies(&arena);
+
+        for (int i = 0; i < pool; i++)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                struct ArenaSeat *seat = &arena.slots[i].seats[j];
+
+                if (seat->request == '\0')
+                    continue;
+
+                // a reply that came in time is read before the deadline is looked at, however late it is read
+                BotRead read = readBot(&seat->bot, line);
+
+                if (read == BOT_LINE)
+                    handleReply(&arena, &arena.slots[i], j, line);
+                else if (read == BOT_CLOSED)
+                    failSeat(&arena, &arena.slots[i], j, "exited", true);
+                else if (monotonicMicroseconds() > seat->deadline)
+                    failSeat(&arena, &arena.slots[i], j, "did not answer in time", true);
+            }
+        }
+    }
+
+    if (ready)
+        printSummary(&arena, (monotonicMicroseconds() - start) / 1e6);
+
+    for (int i = 0; i < pool; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            if (arena.slots[i].seats[j].running)
+                stopBot(&arena.slots[i].seats[j].bot, arena.slots[i].seats[j].request != '\0');
+        }
+    }
+
+    free(arena.slots);
+
+    if (gameLog != NULL)
+    {
+        closeLogStage(arena.stage);
+        free(records);
+
+        if (!closeGameLog(gameLog))
+        {
+            printf("Could not write every game to %s.\n", getLogPath());
+            ready = false;
+        }
+    }
+
+    return ready;
+}
+
+/*
+    Parses one of the players given to runArena.
+
+    Parameters
+    ----------
+    `struct ArenaSide *side`:
+        Stores the player.
+
+    `char *spec`:
+        The player, as given to runArena.
+
+    Returns
+    -------
+    Returns `true` if spec is a valid player, else it returns `false`.
+*/
+bool parseSide(struct ArenaSide *side, char *spec)
+{
+    side->command = NULL;
+    strncpy(side->name, spec, MAX_SIZE - 1);
+    side->name[MAX_SIZE - 1] = '\0';
+
+    if (strncmp(spec, "bot:", 4) == 0)
+    {
+        side->command = spec + 4;
+        return spec[4] != '\0';
+    }
+
+    return parseCPU(spec, &side->difficulty, &side->strategy);
+}
+
+/*
+    Begins the next game in a slot, placing the fleets of the CPUs and asking the bots for theirs.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot, in which no game is being played and no bot has a request outstanding.
+*/
+void beginGame(struct Arena *arena, struct ArenaSlot *slot)
+{
+    slot->game = arena->started++;
+    slot->turn = slot->game % 2;
+    slot->playing = true;
+
+    for (int i = 0; i < 2; i++)
+    {
+        struct ArenaSeat *seat = &slot->seats[i];
+
+        resetPlayer(&slot->players[i]);
+        seat->fired = 0;
+
+        if (arena->sides[i].command == NULL)
+        {
+            initCPUState(&seat->cpu, i, arena->sides[i].difficulty, randomSeed());
+            seat->cpu.strategy = arena->sides[i].strategy;
+
+            if (arena->sides[i].difficulty == EXPERT)
+                placeShipsExpert(&slot->players[i], countProcessors(), monotonicMicroseconds() + arena->budget * 1000LL);
+            else
+                cpuPlaceShips(&slot->players[i]);
+        }
+        else if (seat->running)
+        {
+            sendBot(&seat->bot, "newgame %s %s", arena->mode == SALVO ? "salvo" : "classic", i == slot->turn ? "first" : "second");
+            sendBot(&seat->bot, "place %d", arena->budget);
+            seat->request = 'P';
+            seat->deadline = monotonicMicroseconds() + (arena->budget + ARENA_GRACE_MS) * 1000LL;
+        }
+    }
+
+    // a bot that could not be started again after failing loses its games until it can be
+    for (int i = 0; i < 2 && slot->playing; i++)
+    {
+        if (arena->sides[i].command != NULL && !slot->seats[i].running)
+        {
+            restartBot(arena, slot, i);
+
+            if (!slot->seats[i].running)
+                failSeat(arena, slot, i, "is not running", false);
+        }
+    }
+
+    playMoves(arena, slot);
+}
+
+/*
+    Plays the moves of a game for as long as no bot has to be waited on, asking the bot whose turn it is for its
+    shots once it is a bot's turn.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot whose game is played.
+*/
+void playMoves(struct Arena *arena, struct ArenaSlot *slot)
+{
+    while (slot->playing && isIdle(slot))
+    {
+        // no request is outstanding, so both fleets have been placed
+        if (slot->record != NULL && !slot->recording)
+        {
+            for (int i = 0; i < 2; i++)
+                snprintf(slot->players[i].name, MAX_SIZE, "%s", arena->sides[i].name);
+
+            beginPlayersRecord(slot->record, arena->mode, slot->players, false);
+            slot->recording = true;
+        }
+
+        int turn = slot->turn, left = countUnguessedCells(&slot->players[turn].unguessed, -1);
+        int shots = arena->mode == SALVO ? countShipsLeft(&slot->players[turn]) : 1;
+        struct ArenaSeat *seat = &slot->seats[turn];
+        struct SalvoResult result;
+
+        shots = shots < left ? shots : left;
+
+        if (arena->sides[turn].command != NULL)
+        {
+            sendBot(&seat->bot, "shot %d %d", arena->budget, shots);
+            seat->request = 'S';
+            seat->shots = shots;
+            seat->deadline = monotonicMicroseconds() + (arena->budget + ARENA_GRACE_MS) * 1000LL;
+            return;
+        }
+
+        playCPUSalvo(&seat->cpu, &slot->players[turn], &slot->players[1 - turn], shots, &result);
+        seat->fired += result.shots;
+        reportSalvo(arena, slot, turn, &result);
+
+        if (checkWin(&slot->players[1 - turn]))
+            finishGame(arena, slot, turn, false);
+        else
+            slot->turn = 1 - turn;
+    }
+}
+
+/*
+    Waits until a bot with a request outstanding sends something, or until the first of their deadlines.
+
+    Parameter
+    ---------
+    `struct Arena *arena`:
+        The arena.
+*/
+void waitReplies(struct Arena *arena)
+{
+#ifdef _WIN32
+    (void) arena;
+#else
+    struct pollfd polls[ARENA_MAX_POOL * 2];
+    long long first = LLONG_MAX;
+    int count = 0;
+
+    for (int i = 0; i < arena->pool; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            struct ArenaSeat *seat = &arena->slots[i].seats[j];
+
+            if (seat->request == '\0')
+                continue;
+
+            polls[count].fd = seat->bot.output;
+            polls[count++].events = POLLIN;
+            first = seat->deadline < first ? seat->deadline : first;
+        }
+    }
+
+    if (count == 0)
+        return;
+
+    long long left = first - monotonicMicroseconds();
+
+    poll(polls, count, left > 0 ? (int) ((left + 999) / 1000) : 0);
+#endif
+}
+
+/*
+    Handles the reply of a bot to its outstanding request.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot of the bot.
+
+    `int seat`:
+        The seat of the bot.
+
+    `char *line`:
+        The reply.
+*/
+void handleReply(struct Arena *arena, struct ArenaSlot *slot, int seat, char *line)
+{
+    struct Player *shooter = &slot->players[seat], *target = &slot->players[1 - seat];
+    char request = slot->seats[seat].request;
+    int cells[SHIPS];
+
+    slot->seats[seat].request = '\0';
+
+    if (request == 'P' && !readPlacement(shooter, line))
+    {
+        failSeat(arena, slot, seat, "placed its fleet wrongly", false);
+    }
+    else if (request == 'S' && !readSalvo(shooter, line, slot->seats[seat].shots, cells))
+    {
+        failSeat(arena, slot, seat, "fired a wrong shot", false);
+    }
+    else if (request == 'S')
+    {
+        struct SalvoResult result;
+
+        fireSalvo(shooter, target, cells, slot->seats[seat].shots, &result);
+        slot->seats[seat].fired += result.shots;
+        reportSalvo(arena, slot, seat, &result);
+
+        if (checkWin(target))
+            finishGame(arena, slot, seat, false);
+        else
+            slot->turn = 1 - seat;
+    }
+
+    if (request != 'D')
+        playMoves(arena, slot);
+}
+
+/*
+    Deals with a bot that failed to answer its request properly, which loses the game being played.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot of the bot.
+
+    `int seat`:
+        The seat of the bot.
+
+    `char *reason`:
+        What the bot did, as in "exited".
+
+    `bool restart`:
+        Whether the bot has to be started again, as it might still answer the request later or not at all.
+*/
+void failSeat(struct Arena *arena, struct ArenaSlot *slot, int seat, char *reason, bool restart)
+{
+    if (slot->playing && slot->seats[seat].request != 'D')
+    {
+        printf("Game %d: %s %s and forfeits.\n", slot->game + 1, arena->sides[seat].name, reason);
+        finishGame(arena, slot, 1 - seat, true);
+    }
+
+    if (restart)
+        restartBot(arena, slot, seat);
+
+    slot->seats[seat].request = '\0';
+}
+
+/*
+    Ends the game being played in a slot, telling the bots how it went.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot.
+
+    `int winner`:
+        Seat of the player who won.
+
+    `bool forfeit`:
+        Whether the other player lost by forfeiting.
+*/
+void finishGame(struct Arena *arena, struct ArenaSlot *slot, int winner, bool forfeit)
+{
+    slot->playing = false;
+    arena->finished++;
+    arena->sides[winner].wins++;
+
+    if (slot->recording)
+    {
+        finishRecord(slot->record, winner);
+        logGame(arena->stage, slot->record);
+        slot->recording = false;
+    }
+
+    if (forfeit)
+    {
+        arena->sides[1 - winner].forfeits++;
+    }
+    else
+    {
+        arena->sides[winner].sinkingWins++;
+        arena->sides[winner].shots += slot->seats[winner].fired;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        struct ArenaSeat *seat = &slot->seats[i];
+
+        if (arena->sides[i].command == NULL)
+        {
+            resetCPUVariables(&seat->cpu);
+        }
+        else if (seat->running)
+        {
+            sendBot(&seat->bot, "gameover %s", i == winner ? "win" : "loss");
+            seat->request = seat->request != '\0' ? 'D' : '\0';
+        }
+    }
+}
+
+/*
+    Stops a bot and starts it again.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot of the bot.
+
+    `int seat`:
+        The seat of the bot.
+*/
+void restartBot(struct Arena *arena, struct ArenaSlot *slot, int seat)
+{
+    struct ArenaSeat *arenaSeat = &slot->seats[seat];
+
+    if (arenaSeat->running)
+        stopBot(&arenaSeat->bot, true);
+
+    arenaSeat->request = '\0';
+    arenaSeat->running = startBot(&arenaSeat->bot, arena->sides[seat].command);
+}
+
+/*
+    Places a fleet as given by a bot's reply to a place request.
+
+    Parameters
+    ----------
+    `struct Player *player`:
+        The player whose fleet is placed, with an empty board.
+
+    `char *reply`:
+        The reply, which is changed by strtok.
+
+    Returns
+    -------
+    Returns `true` if every ship was placed, else it returns `false`.
+*/
+bool readPlacement(struct Player *player, char *reply)
+{
+    bool placed[SHIPS] = { false };
+    char *word = strtok(reply, " ");
+    int count = 0;
+
+    if (word == NULL || strcmp(word, "place") != 0)
+        return false;
+
+    while ((word = strtok(NULL, " ")) != NULL)
+    {
+        char *start = strtok(NULL, " "), *end = strtok(NULL, " ");
+        Ships ship = strlen(word) == 1 ? getShipFromIcon((char) toupper((unsigned char) word[0])) : (Ships) -1;
+        int startCell, endCell;
+
+        if ((int) ship == -1 || placed[ship] || start == NULL || end == NULL ||
+            !parseCell(start, &startCell) || !parseCell(end, &endCell) ||
+            canPlaceShipOnBoard(player, start, end, ship) != PLACEMENT_OK)
+        {
+            return false;
+        }
+
+        placed[ship] = true;
+        count++;
+    }
+
+    return count == SHIPS;
+}
+
+/*
+    Reads the cells of a bot's reply to a shot request.
+
+    Parameters
+    ----------
+    `struct Player *shooter`:
+        The player of the bot.
+
+    `char *reply`:
+        The reply, which is changed by strtok.
+
+    `int shots`:
+        Number of shots asked for.
+
+    `int cells[SHIPS]`:
+        Stores the cells, given as (row * 10) + col.
+
+    Returns
+    -------
+    Returns `true` if the reply gives as many cells as were asked for, all different and none guessed before,
+    else it returns `false`.
+*/
+bool readSalvo(struct Player *shooter, char *reply, int shots, int cells[SHIPS])
+{
+    char *word = strtok(reply, " ");
+
+    if (word == NULL || strcmp(word, "shot") != 0)
+        return false;
+
+    for (int i = 0; i < shots; i++)
+    {
+        word = strtok(NULL, " ");
+
+        if (word == NULL || !parseCell(word, &cells[i]) || shooter->actionBoard[cells[i] / 10][cells[i] % 10] != ' ')
+            return false;
+
+        for (int j = 0; j < i; j++)
+        {
+            if (cells[j] == cells[i])
+                return false;
+        }
+    }
+
+    return strtok(NULL, " ") == NULL;
+}
+
+/*
+    Tells the bots of a game the results of a salvo, the shooter as results and its opponent as incoming shots.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `struct ArenaSlot *slot`:
+        The slot of the game.
+
+    `int shooter`:
+        Seat of the player who fired the salvo.
+
+    `struct SalvoResult *result`:
+        Result of the salvo.
+*/
+void reportSalvo(struct Arena *arena, struct ArenaSlot *slot, int shooter, struct SalvoResult *result)
+{
+    char *messages[2] = { "result", "incoming" };
+
+    if (slot->recording)
+        recordSalvo(slot->record, shooter, result);
+
+    for (int i = 0; i < result->shots; i++)
+    {
+        char sunk[3] = { '\0' };
+        int cell = result->cells[i];
+
+        if (result->sunkShips[i] != '\0')
+        {
+            sunk[0] = ' ';
+            sunk[1] = result->sunkShips[i];
+        }
+
+        for (int j = 0; j < 2; j++)
+        {
+            int seat = j == 0 ? shooter : 1 - shooter;
+
+            if (arena->sides[seat].command != NULL && slot->seats[seat].running)
+            {
+                sendBot(&slot->seats[seat].bot, "%s %c%d %s%s", messages[j], 'A' + (cell % 10), (cell / 10) + 1,
+                        result->statuses[i] == 'H' ? "hit" : "miss", sunk);
+            }
+        }
+    }
+}
+
+/*
+    Returns whether none of the bots of a slot has a request outstanding.
+*/
+bool isIdle(struct ArenaSlot *slot)
+{
+    return slot->seats[0].request == '\0' && slot->seats[1].request == '\0';
+}
+
+/*
+    Prints how each player of the arena did.
+
+    Parameters
+    ----------
+    `struct Arena *arena`:
+        The arena.
+
+    `double seconds`:
+        Time the games took.
+*/
+void printSummary(struct Arena *arena, double seconds)
+{
+    printf("\n%d %s games played in %.2f s (%.1f games/s), %d at a time.\n", arena->finished,
+           arena->mode == SALVO ? "salvo" : "classic", seconds, seconds > 0 ? arena->finished / seconds : 0.0, arena->pool);
+
+    for (int i = 0; i < 2; i++)
+    {
+        struct ArenaSide *side = &arena->sides[i];
+
+        printf("%-32s %5d wins (%5.1f%%)  %4d forfeits  ", side->name, side->wins,
+               arena->finished > 0 ? 100.0 * side->wins / arena->finished : 0.0, side->forfeits);
+
+        if (side->sinkingWins > 0)
+            printf("%.1f shots per win\n", (double) side->shots / side->sinkingWins);
+        else
+            printf("no wins by sinking\n");
+    }
+}
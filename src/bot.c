@@ -0,0 +1,579 @@
+/*
+
+File Name: bot.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the text protocol through which a game talks to a bot, a program playing one side of a game on its
+    standard input and output, and the CPU players speaking it as a bot themselves.
+
+    Every message is one line of words separated by spaces, and a cell is written as on the board, as in A1 or
+    J10. The game sends the bot:
+    - battleship VERSION: sent once when the bot is started, which answers with ready followed by its name.
+    - newgame classic|salvo first|second: a new game starts, with the rules it is played with and whether the
+      bot moves first.
+    - place MS: the bot has MS milliseconds to place its fleet, answering with place followed by the icon,
+      starting and ending cell of every ship, as in place C A1 A5 B C2 F2 D J8 J10 S E5 E7 P H1 H2.
+    - shot MS COUNT: the bot has MS milliseconds to choose COUNT cells it has not guessed yet, answering with
+      shot followed by the cells, as in shot B7.
+    - result CELL hit|miss [ICON]: result of one of the bot's shots, followed by the icon of the ship it sank.
+    - incoming CELL hit|miss [ICON]: result of one of the opponent's shots at the bot.
+    - gameover win|loss: the game is over. A reply the bot has not sent yet is still read and thrown away.
+    - quit: the bot should exit.
+    A bot may ignore any message it does not know, so that the protocol can grow without breaking bots. A bot
+    that answers late, answers wrongly or exits loses the game it is playing.
+
+    Bots are started and talked to with POSIX pipes, so they are not available on Windows, but the CPU players
+    can still be run as bots there.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. bot.h
+    2. plugin.h
+    3. defence.h
+    4. thread.h
+    5. timing.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool startBot(struct BotProcess *bot, char *command)
+    2. bool sendBot(struct BotProcess *bot, char *format, ...)
+    3. BotRead readBot(struct BotProcess *bot, char *line)
+    4. void stopBot(struct BotProcess *bot, bool force)
+    5. bool parseCPU(char *name, Difficulty *difficulty, const struct Strategy **strategy)
+    6. bool parseCell(char *text, int *cell)
+    7. int runBot(Difficulty difficulty, const struct Strategy *strategy)
+
+    FUNCTIONS (local)
+    -----------------
+    1. BotRead waitBot(struct BotProcess *bot, char *line, long long deadline)
+    2. void printPlacement(struct Player *player)
+    3. void printCell(int cell)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <bot.h>
+#include <plugin.h>
+#include <defence.h>
+#include <thread.h>
+#include <timing.h>
+#include <stdarg.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <unistd.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+#endif
+
+BotRead waitBot(struct BotProcess *bot, char *line, long long deadline);
+void printPlacement(struct Player *player);
+void printCell(int cell);
+
+/*
+    Starts a bot and shakes hands with it.
+
+    Parameters
+    ----------
+    `struct BotProcess *bot`:
+        Stores the bot.
+
+    `char *command`:
+        Shell command that runs the bot.
+
+    Returns
+    -------
+    Returns `true` if the bot was started and answered the handshake in time, else it returns `false`.
+*/
+bool startBot(struct BotProcess *bot, char *command)
+{
+#ifdef _WIN32
+    (void) bot;
+    (void) command;
+    printf("Bots are not available on Windows.\n");
+    return false;
+#else
+    int toBot[2], fromBot[2];
+    char line[BOT_LINE_SIZE];
+
+    signal(SIGPIPE, SIG_IGN); // a bot that exits is noticed when reading from it instead
+
+    if (pipe(toBot) != 0)
+        return false;
+
+    if (pipe(fromBot) != 0)
+    {
+        close(toBot[0]);
+        close(toBot[1]);
+        return false;
+    }
+
+    // no bot may hold on to the pipes of another, or it would keep them open after the other exits
+    for (int i = 0; i < 2; i++)
+    {
+        fcntl(toBot[i], F_SETFD, FD_CLOEXEC);
+        fcntl(fromBot[i], F_SETFD, FD_CLOEXEC);
+    }
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        dup2(toBot[0], STDIN_FILENO);
+        dup2(fromBot[1], STDOUT_FILENO);
+        execl("/bin/sh", "sh", "-c", command, (char *) NULL);
+        _exit(127);
+    }
+
+    close(toBot[0]);
+    close(fromBot[1]);
+
+    if (pid < 0)
+    {
+        close(toBot[1]);
+        close(fromBot[0]);
+        return false;
+    }
+
+    fcntl(fromBot[0], F_SETFL, fcntl(fromBot[0], F_GETFL) | O_NONBLOCK);
+    bot->pid = (long) pid;
+    bot->input = toBot[1];
+    bot->output = fromBot[0];
+    bot->buffered = 0;
+
+    if (!sendBot(bot, "battleship %d", BOT_PROTOCOL_VERSION) ||
+        waitBot(bot, line, monotonicMicroseconds() + BOT_HANDSHAKE_MS * 1000LL) != BOT_LINE ||
+        strncmp(line, "ready", 5) != 0 || (line[5] != '\0' && line[5] != ' '))
+    {
+        printf("Bot \"%s\" did not answer the handshake.\n", command);
+        stopBot(bot, true);
+        return false;
+    }
+
+    char *name = line[5] == ' ' ? line + 6 : command;
+
+    strncpy(bot->name, name, MAX_SIZE - 1);
+    bot->name[MAX_SIZE - 1] = '\0';
+
+    return true;
+#endif
+}
+
+/*
+    Sends one line to a bot.
+
+    Parameters
+    ----------
+    `struct BotProcess *bot`:
+        The bot.
+
+    `char *format`:
+        printf format of the line, without the newline.
+
+    `...`:
+        Values used by format.
+
+    Returns
+    -------
+    Returns `true` if the line was sent, else it returns `false`.
+*/
+bool sendBot(struct BotProcess *bot, char *format, ...)
+{
+#ifdef _WIN32
+    (void) bot;
+    (void) format;
+    return false;
+#else
+    char line[BOT_LINE_SIZE];
+    va_list arguments;
+
+    va_start(arguments, format);
+    int length = vsnprintf(line, sizeof line - 1, format, arguments);
+    va_end(arguments);
+
+    length = length < (int) sizeof line - 2 ? length : (int) sizeof line - 2;
+    line[length++] = '\n';
+
+    for (int sent = 0; sent < length; )
+    {
+        ssize_t written = write(bot->input, line + sent, length - sent);
+
+        if (written < 0 && errno != EINTR)
+            return false;
+        if (written > 0)
+            sent += (int) written;
+    }
+
+    return true;
+#endif
+}
+
+/*
+    Reads the next line sent by a bot, without waiting for it.
+
+    Parameters
+    ----------
+    `struct BotProcess *bot`:
+        The bot.
+
+    `char *line`:
+        Stores the line, of at most BOT_LINE_SIZE characters, without the newline.
+
+    Returns
+    -------
+    Returns `BOT_LINE` if a line was read, `BOT_WAITING` if the bot has not sent a whole line yet, and
+    `BOT_CLOSED` if the bot will never send one.
+*/
+BotRead readBot(struct BotProcess *bot, char *line)
+{
+#ifdef _WIN32
+    (void) bot;
+    (void) line;
+    return BOT_CLOSED;
+#else
+    while (1)
+    {
+        char *newline = memchr(bot->buffer, '\n', bot->buffered);
+
+        if (newline != NULL)
+        {
+            int length = (int) (newline - bot->buffer);
+
+            memcpy(line, bot->buffer, length);
+            line[length > 0 && line[length - 1] == '\r' ? length - 1 : length] = '\0';
+            bot->buffered -= length + 1;
+            memmove(bot->buffer, newline + 1, bot->buffered);
+
+            return BOT_LINE;
+        }
+
+        if (bot->buffered == BOT_LINE_SIZE)
+            return BOT_CLOSED;
+
+        ssize_t got = read(bot->output, bot->buffer + bot->buffered, BOT_LINE_SIZE - bot->buffered);
+
+        if (got > 0)
+            bot->buffered += (int) got;
+        else if (got < 0 && errno == EINTR)
+            continue;
+        else if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return BOT_WAITING;
+        else
+            return BOT_CLOSED;
+    }
+#endif
+}
+
+/*
+    Stops a bot, telling it to quit and killing it if it does not.
+
+    Parameters
+    ----------
+    `struct BotProcess *bot`:
+        The bot.
+
+    `bool force`:
+        Whether to kill the bot right away, for a bot that cannot be trusted to quit.
+*/
+void stopBot(struct BotProcess *bot, bool force)
+{
+#ifdef _WIN32
+    (void) bot;
+    (void) force;
+#else
+    long long deadline = monotonicMicroseconds() + (force ? 0 : BOT_QUIT_MS * 1000LL);
+
+    if (!force)
+        sendBot(bot, "quit");
+
+    close(bot->input);
+    close(bot->output);
+
+    while (waitpid((pid_t) bot->pid, NULL, WNOHANG) == 0)
+    {
+        if (monotonicMicroseconds() >= deadline)
+        {
+            kill((pid_t) bot->pid, SIGKILL);
+            waitpid((pid_t) bot->pid, NULL, 0);
+            break;
+        }
+
+        poll(NULL, 0, 1);
+    }
+#endif
+}
+
+/*
+    Parses the name of a CPU player: easy, hard, expert, policy, or plugin:NAME for a strategy, which is loaded
+    if it has not been yet.
+
+    Parameters
+    ----------
+    `char *name`:
+        The name.
+
+    `Difficulty *difficulty`:
+        Stores the difficulty of the CPU.
+
+    `const struct Strategy **strategy`:
+        Stores the strategy of a plugin CPU, NULL for the others.
+
+    Returns
+    -------
+    Returns `true` if the name is that of a CPU, else it returns `false`.
+*/
+bool parseCPU(char *name, Difficulty *difficulty, const struct Strategy **strategy)
+{
+    char *names[] = { "easy", "hard", "expert", "policy" };
+    Difficulty difficulties[] = { EASY, HARD, EXPERT, POLICY };
+
+    *strategy = NULL;
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            *difficulty = difficulties[i];
+            return true;
+        }
+    }
+
+    if (strncmp(name, "plugin:", 7) != 0)
+        return false;
+
+    *difficulty = PLUGIN;
+    *strategy = findStrategy(name + 7);
+
+    if (*strategy == NULL)
+        *strategy = loadStrategy(name + 7);
+
+    return *strategy != NULL;
+}
+
+/*
+    Parses a cell written as on the board.
+
+    Parameters
+    ----------
+    `char *text`:
+        The cell, as in A1 or J10.
+
+    `int *cell`:
+        Stores the cell, given as (row * 10) + col.
+
+    Returns
+    -------
+    Returns `true` if text is a cell of the board, else it returns `false`.
+*/
+bool parseCell(char *text, int *cell)
+{
+    int row, col;
+    size_t length = strlen(text);
+
+    if (length < 2 || length > 3 || !validatePosition(text))
+        return false;
+
+    convertToIndex(text, &row, &col);
+    *cell = (row * 10) + col;
+
+    return true;
+}
+
+/*
+    Plays as a bot on the standard input and output, with a CPU of the given difficulty, until told to quit.
+
+    Parameters
+    ----------
+    `Difficulty difficulty`:
+        Difficulty of the CPU.
+
+    `const struct Strategy *strategy`:
+        Strategy of the CPU on plugin difficulty.
+
+    Returns
+    -------
+    Returns the exit status of the program.
+*/
+int runBot(Difficulty difficulty, const struct Strategy *strategy)
+{
+    char *difficulties[] = { "easy", "hard", "expert", "plugin", "policy" };
+    char line[BOT_LINE_SIZE];
+    struct Player self;
+    struct CPUState cpu;
+    bool playing = false;
+
+    resetPlayer(&self);
+
+    while (fgets(line, sizeof line, stdin) != NULL)
+    {
+        char *word = strtok(line, " \r\n");
+        char *first = strtok(NULL, " \r\n"), *second = strtok(NULL, " \r\n"), *third = strtok(NULL, " \r\n");
+        int ms = first != NULL ? atoi(first) : 0;
+
+        if (word == NULL)
+            continue;
+
+        if (strcmp(word, "battleship") == 0)
+        {
+            if (difficulty == PLUGIN)
+                printf("ready %s\n", strategy->name);
+            else
+                printf("ready Battleship CPU (%s)\n", difficulties[difficulty - EASY]);
+        }
+        else if (strcmp(word, "newgame") == 0 || (strcmp(word, "place") == 0 && !playing))
+        {
+            if (playing)
+                resetCPUVariables(&cpu);
+
+            resetPlayer(&self);
+            initCPUState(&cpu, 0, difficulty, randomSeed());
+            cpu.strategy = strategy;
+            playing = true;
+        }
+
+        if (strcmp(word, "place") == 0)
+        {
+            // the expert spends the time it is given looking for a layout that is hard to sink, less a margin
+            if (difficulty == EXPERT)
+                placeShipsExpert(&self, countProcessors(), monotonicMicroseconds() + ms * 900LL);
+            else
+                cpuPlaceShips(&self);
+
+            printPlacement(&self);
+        }
+        else if (strcmp(word, "shot") == 0 && playing)
+        {
+            int cells[SHIPS];
+
+            cpu.budget = ms - ms / 10;
+
+            int shots = chooseCPUSalvo(&cpu, &self, second != NULL ? atoi(second) : 1, cells);
+
+            printf("shot");
+
+            for (int i = 0; i < shots; i++)
+                printCell(cells[i]);
+
+            printf("\n");
+        }
+        else if (strcmp(word, "result") == 0 && playing && second != NULL)
+        {
+            int cell;
+
+            if (parseCell(first, &cell) && self.actionBoard[cell / 10][cell % 10] == ' ')
+                observeCPUShot(&cpu, &self, cell, strcmp(second, "hit") == 0 ? 'H' : 'M', third != NULL ? third[0] : '\0');
+        }
+        else if (strcmp(word, "gameover") == 0 && playing)
+        {
+            resetCPUVariables(&cpu);
+            playing = false;
+        }
+        else if (strcmp(word, "quit") == 0)
+        {
+            break;
+        }
+
+        fflush(stdout);
+    }
+
+    if (playing)
+        resetCPUVariables(&cpu);
+
+    return 0;
+}
+
+/*
+    Waits for the next line sent by a bot.
+
+    Parameters
+    ----------
+    `struct BotProcess *bot`:
+        The bot.
+
+    `char *line`:
+        Stores the line.
+
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, after which to stop waiting.
+
+    Returns
+    -------
+    Returns what reading the line came to, `BOT_WAITING` if the deadline passed first.
+*/
+BotRead waitBot(struct BotProcess *bot, char *line, long long deadline)
+{
+#ifdef _WIN32
+    (void) bot;
+    (void) line;
+    (void) deadline;
+    return BOT_CLOSED;
+#else
+    BotRead read;
+
+    while ((read = readBot(bot, line)) == BOT_WAITING)
+    {
+        long long left = deadline - monotonicMicroseconds();
+        struct pollfd wait = { .fd = bot->output, .events = POLLIN };
+
+        if (left <= 0)
+            break;
+
+        poll(&wait, 1, (int) ((left + 999) / 1000));
+    }
+
+    return read;
+#endif
+}
+
+/*
+    Prints the placement of a player's fleet as a bot answers a place message.
+
+    Parameter
+    ---------
+    `struct Player *player`:
+        The player whose fleet is printed.
+*/
+void printPlacement(struct Player *player)
+{
+    printf("place");
+
+    for (int ship = 0; ship < SHIPS; ship++)
+    {
+        int start = -1, end = -1;
+
+        // cells are scanned in order, so the first and last cells of a ship are its ends
+        for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; cell++)
+        {
+            if (player->board[cell / 10][cell % 10] == getShipIcon(ship))
+            {
+                start = start == -1 ? cell : start;
+                end = cell;
+            }
+        }
+
+        printf(" %c", getShipIcon(ship));
+        printCell(start);
+        printCell(end);
+    }
+
+    printf("\n");
+}
+
+/*
+    Prints a space followed by a cell, given as (row * 10) + col, as it is written on the board.
+*/
+void printCell(int cell)
+{
+    printf(" %c%d", 'A' + (cell % 10), (cell / 10) + 1);
+}
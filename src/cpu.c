@@ -10,31 +10,48 @@ ________________________________________________________________________________
     INCLUDES (user-defined)
     1. cpu.h
     2. stack.h
+    3. expert.h
+    4. timing.h
+    5. policy.h
+    6. trace.h
 
     GLOBAL VARIABLES
     ----------------
-    1. int  _CPUTurn
-    2. short _lastMove
-    3. struct Stack *_checkout
-    4. int _hitCount
-    5. bool _orientationFlipped
-    6. short _guessOrientation
+    1. int _CPUTurn
+    2. int _CPUBudget
+    3. const struct Strategy *_CPUStrategy
+    4. struct HardParameters _hardParameters
 
     FUNCTIONS (global)
     ------------------
     1. void setCPUTurn(int turn)
     2. int getCPUTurn(void)
-    3. void cpuPlaceShips(void)
-    4. bool playCPUTurn(char *moveStatus, Difficulty difficulty)
-    5. void resetCPUVariables()
-    6. void testCPU()
+    3. void initCPUState(struct CPUState *cpu, int turn, Difficulty difficulty, unsigned long long seed)
+    4. void cpuPlaceShips(struct Player *cpuPlayer)
+    5. bool playCPUTurn(struct CPUState *cpu, struct Player *self, struct Player *opponent, char *moveStatus)
+    6. bool playCPUSalvo(struct CPUState *cpu, struct Player *self, struct Player *opponent, int shots, struct SalvoResult *result)
+    7. void resetCPUVariables(struct CPUState *cpu)
+    8. void setCPUBudget(int milliseconds)
+    9. int getCPUBudget(void)
+    10. void restoreCPUState(struct CPUState *cpu, struct Player *self, struct Player *opponent)
+    11. void setCPUStrategy(const struct Strategy *strategy)
+    12. int chooseCPUSalvo(struct CPUState *cpu, struct Player *self, int shots, int cells[SHIPS])
+    13. void observeCPUShot(struct CPUState *cpu, struct Player *self, int cell, char moveStatus, char sunk)
+    14. void setHardParameters(struct HardParameters parameters)
+    15. struct HardParameters getHardParameters(void)
 
     FUNCTIONS (local)
     -----------------
-    1. bool playCPUTurnEasy(char *moveStatus)
-    2. bool playCPUTurnHard(char *moveStatus)
-    3. void shuffleArray(int *array, int n)
-    4. char playGuess(int row, int col, char *sunkShip)
+    1. void chooseShot(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, long long deadline, int *row, int *col)
+    2. void observeShot(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], int row, int col, char moveStatus, char sunk)
+    3. void chooseShotEasy(struct CPUState *cpu, struct CellIndex *unguessed, int *row, int *col)
+    4. void chooseShotHard(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, int *row, int *col)
+    5. void observeShotHard(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], int row, int col, char moveStatus, char sunk)
+    6. bool randomUnguessedCell(struct CellIndex *unguessed, int parity, struct Random *random, int *row, int *col)
+    7. bool isOnBoard(int row, int col)
+    8. void shuffleArray(int *array, int n, struct Random *random)
+    9. void chooseShotPlugin(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, long long deadline, int *row, int *col)
+    10. void permuteArray(int *array, int size, int order)
 
 *Compiled using C99 standards*
 
@@ -42,31 +59,32 @@ ________________________________________________________________________________
 
 #include <cpu.h>
 #include <stack.h>
+#include <expert.h>
+#include <timing.h>
+#include <policy.h>
+#include <trace.h>
 #include <stdio.h>
 #include <string.h>
 
-// stores the CPU's turn
+// stores the CPU's turn chosen from the menu, used to set up the CPUState of the next game
 int _CPUTurn = 0;
-
-/* For hard difficulty */
-
-// stores the position of the last successful hit
-short _lastMove = -1;
-// stack that stores cells for the CPU to explore
-struct Stack *_checkout = NULL;
-// counts how many times the CPU has guessed successfully
-int _hitCount = 0;
-// checks whether _guessOrientation has flipped already or not
-bool _orientationFlipped = false;
-/* 
-    Direction in which to guess: 
-    0 - no saved orientation, 1 - right, -1 - left, 10 - down, -10 - up
-*/
-short _guessOrientation = 0; 
-
-bool playCPUTurnEasy(char *moveStatus);
-bool playCPUTurnHard(char *moveStatus);
-void shuffleArray(int *array, int n);
+// stores the time, in milliseconds, a CPU may spend on one move, used to set up the CPUState of the next game
+int _CPUBudget = DEFAULT_CPU_BUDGET_MS;
+// stores the strategy chosen from the menu, used to set up the CPUState of the next game on plugin difficulty
+const struct Strategy *_CPUStrategy = NULL;
+// stores the choices the hard CPU plays by, used to set up the CPUState of the next game
+struct HardParameters _hardParameters = { true, 0, CHECKOUT_SIZE, 1 };
+
+void chooseShot(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, long long deadline, int *row, int *col);
+void observeShot(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], int row, int col, char moveStatus, char sunk);
+void chooseShotEasy(struct CPUState *cpu, struct CellIndex *unguessed, int *row, int *col);
+void chooseShotHard(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, int *row, int *col);
+void observeShotHard(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], int row, int col, char moveStatus, char sunk);
+bool randomUnguessedCell(struct CellIndex *unguessed, int parity, struct Random *random, int *row, int *col);
+bool isOnBoard(int row, int col);
+void shuffleArray(int *array, int n, struct Random *random);
+void chooseShotPlugin(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, long long deadline, int *row, int *col);
+void permuteArray(int *array, int size, int order);
 
 /*
     Used to set CPU's turn.
@@ -90,411 +108,658 @@ int getCPUTurn()
 }
 
 /*
-    Randomly places ships on the CPU's board.
+    Used to set the time a CPU may spend on one move.
+
+    Parameter
+    ---------
+    `int milliseconds`:
+        The time, 0 or more.
 */
-void cpuPlaceShips()
+void setCPUBudget(int milliseconds)
 {
-    Ships ships[] = { CARRIER, BATTLESHIP, DESTROYER, SUBMARINE, PATROL };
-    int rowStart, colStart, rowEnd, colEnd, startArr[2], endArr[2];
+    _CPUBudget = milliseconds;
+}
 
-    for (int i = 0; i < SHIPS; i++)
-    {
-        int shipHP = players[_CPUTurn].shipsHP[i];
-        
-        while (1)
-        {
-            bool validPositions = false;
+/*
+    Returns the time, in milliseconds, a CPU may spend on one move.
+*/
+int getCPUBudget()
+{
+    return _CPUBudget;
+}
 
-            while (1) // for choosing starting position that has not been already occupied
-            {
-                rowStart = rand() % (BOARD_SIZE - shipHP); colStart = rand() % (BOARD_SIZE - shipHP);
+/*
+    Used to set the strategy a CPU plays with on plugin difficulty.
 
-                if (players[_CPUTurn].board[rowStart][colStart] == ' ')
-                    break;
-            }
-            
-            bool vertical = (rand() % 2) == 0 ? true : false;
-            bool switched = false;
+    Parameter
+    ---------
+    `const struct Strategy *strategy`:
+        The strategy, loaded with loadStrategy.
+*/
+void setCPUStrategy(const struct Strategy *strategy)
+{
+    _CPUStrategy = strategy;
+}
 
-            while (1) // for choosing ending position that has not been already occupied
-            {
-                if (vertical)
-                {
-                    rowEnd = rowStart + (shipHP - 1);
-                    colEnd = colStart;
-                }
-                else
-                {
-                    rowEnd = rowStart;
-                    colEnd = colStart + (shipHP - 1);
-                }
+/*
+    Used to set the choices the hard CPU plays by, as tuned by the tuner (see tune.c).
 
-                if (players[_CPUTurn].board[rowEnd][colEnd] == ' ')
-                {
-                    validPositions = true;
-                    break;
-                }
-                else if (!switched) // if end position is not valid, then switch ship orientation and try again
-                {
-                    vertical = !vertical;
-                    switched = true;
-                }
-                else // if we have already tried placing ship in both orientation, try again with another start position
-                {
-                    break;
-                }
-            }
+    Parameter
+    ---------
+    `struct HardParameters parameters`:
+        The choices.
+*/
+void setHardParameters(struct HardParameters parameters)
+{
+    _hardParameters = parameters;
+}
 
-            // prevents overlapping
-            if (rowStart == rowEnd)
-            {
-                for (int j = colStart; j <= colEnd; j++)
-                {
-                    if (players[_CPUTurn].board[rowStart][j] != ' ')
-                    {
-                        validPositions = false;
-                    }
-                }
-            }
-            else
-            {
-                for (int j = rowStart; j <= rowEnd; j++)
-                {
-                    if (players[_CPUTurn].board[j][colStart] != ' ')
-                    {
-                        validPositions = false;
-                    }
-                }
-            }
+/*
+    Returns the choices the hard CPU plays by.
+*/
+struct HardParameters getHardParameters()
+{
+    return _hardParameters;
+}
 
-            if (validPositions) // check if the positions are valid, if not, try again.
-                break;
-        }
+/*
+    Sets up the given CPUState for a new game.
+
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        The CPUState to set up.
+    
+    `int turn`:
+        CPU's turn, either 0 or 1.
+    
+    `Difficulty difficulty`:
+        Selects the difficulty of the CPU.
+    
+    `unsigned long long seed`:
+        Seed of the CPU's random number generator.
+*/
+void initCPUState(struct CPUState *cpu, int turn, Difficulty difficulty, unsigned long long seed)
+{
+    cpu->turn = turn;
+    cpu->difficulty = difficulty;
+    cpu->budget = _CPUBudget;
+    seedRandom(&cpu->random, seed);
+    cpu->lastMove = -1;
+    cpu->checkout = NULL;
+    cpu->hitCount = 0;
+    cpu->orientationFlips = 0;
+    cpu->guessOrientation = 0;
+    cpu->expert = NULL;
+    cpu->strategy = difficulty == PLUGIN ? _CPUStrategy : NULL;
+    cpu->strategyState = NULL;
+    cpu->sunkCells = (struct CellMask) { { 0, 0 } };
+    cpu->hard = _hardParameters;
+
+    initPlacements();
+}
 
-        startArr[0] = rowStart; startArr[1] = colStart;
-        endArr[0] = rowEnd; endArr[1] = colEnd;
+/*
+    Randomly places ships on the CPU's board.
 
-        placeShipOnBoard(_CPUTurn + 1, startArr, endArr, ships[i]);
-    }
+    Parameter
+    ---------
+    `struct Player *cpuPlayer`:
+        The CPU player whose ships are to be placed.
+*/
+void cpuPlaceShips(struct Player *cpuPlayer)
+{
+    struct Random random;
+    unsigned char fleet[SHIPS];
+
+    TRACE_BEGIN("cpuPlaceShips");
+    seedRandom(&random, randomSeed());
+    drawFleet(&random, fleet);
+    placeFleet(cpuPlayer, fleet);
+    TRACE_END("cpuPlaceShips");
 }
 
 /*
-    Plays the CPU's turn.
+    Plays the CPU's turn, taking no more than the CPU's time budget to choose its move.
 
     Parameters
     ----------
+    `struct CPUState *cpu`:
+        State of the CPU playing the turn.
+    
+    `struct Player *self`:
+        The CPU player.
+    
+    `struct Player *opponent`:
+        The player the CPU is playing against.
+    
     `char *moveStatus`:
         Used to tell user the status of the CPU's move.
     
-    `Difficulty difficulty`:
-        Selects the difficulty of the CPU.
+    Returns
+    -------
+    Returns `true` if CPU won, else it returns `false`.
+*/
+bool playCPUTurn(struct CPUState *cpu, struct Player *self, struct Player *opponent, char *moveStatus)
+{
+    int row, col;
+    char sunk = '\0'; // variable to check whether the CPU sank a ship
+    long long deadline = monotonicMicroseconds() + cpu->budget * 1000LL;
+
+    TRACE_BEGIN("playCPUTurn");
+    chooseShot(cpu, self->actionBoard, &self->unguessed, deadline, &row, &col);
+    *moveStatus = resolveShot(self, opponent, row, col, &sunk);
+    observeShot(cpu, self->actionBoard, row, col, *moveStatus, sunk);
+    TRACE_END("playCPUTurn");
+
+    return checkWin(opponent);
+}
+
+/*
+    Plays the CPU's turn in a salvo game. The CPU picks all of its shots first and then fires them together, 
+    learning their results only once the whole salvo has been resolved. The CPU's time budget covers the whole
+    salvo, and is shared evenly between the shots left to choose.
+
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU playing the turn.
+    
+    `struct Player *self`:
+        The CPU player.
+    
+    `struct Player *opponent`:
+        The player the CPU is playing against.
+    
+    `int shots`:
+        Number of shots the CPU gets to fire.
+    
+    `struct SalvoResult *result`:
+        Stores the result of the salvo.
     
     Returns
     -------
     Returns `true` if CPU won, else it returns `false`.
 */
-bool playCPUTurn(char *moveStatus, Difficulty difficulty)
+bool playCPUSalvo(struct CPUState *cpu, struct Player *self, struct Player *opponent, int shots, struct SalvoResult *result)
 {
-    switch (difficulty)
-    {
-        case EASY: return playCPUTurnEasy(moveStatus);
-        case HARD: return playCPUTurnHard(moveStatus);
-    }
+    int cells[SHIPS];
 
-    return true;
+    TRACE_BEGIN("playCPUSalvo");
+    shots = chooseCPUSalvo(cpu, self, shots, cells);
+    fireSalvo(self, opponent, cells, shots, result);
+
+    for (int i = 0; i < shots; i++)
+        observeShot(cpu, self->actionBoard, cells[i] / 10, cells[i] % 10, result->statuses[i], result->sunkShips[i]);
+
+    TRACE_END("playCPUSalvo");
+
+    return checkWin(opponent);
 }
 
 /*
-    Plays the CPU's guess.
+    Chooses the cells of the CPU's next salvo without firing it, for when the opponent's board is not known to 
+    the CPU's side of the game, as with a bot (see bot.c). The results have to be passed to observeCPUShot.
 
     Parameters
     ----------
-    `int row`:
-        Row of the guessed cell.
+    `struct CPUState *cpu`:
+        State of the CPU choosing the cells.
     
-    `int col`:
-        Column of the guessed cell.
+    `struct Player *self`:
+        The CPU player.
+    
+    `int shots`:
+        Number of shots the CPU gets to fire, a single shot in a classic game.
     
-    `char *sunkShip`:
-        Stores the value of the ship which has sunk, if any.
+    `int cells[SHIPS]`:
+        Stores the chosen cells, given as (row * 10) + col.
     
     Returns
     -------
-    Returns 'H' if the guess results in a hit, else it returns 'M'.
+    Returns the number of cells chosen, fewer than shots if fewer cells are left to guess.
 */
-char playGuess(int row, int col, char *sunkShip)
+int chooseCPUSalvo(struct CPUState *cpu, struct Player *self, int shots, int cells[SHIPS])
 {
-    if (players[(_CPUTurn + 1) % 2].board[row][col] != ' ') // if CPU hit a ship
-    {
-        players[_CPUTurn].actionBoard[row][col] = 'X';
+    char view[BOARD_SIZE][BOARD_SIZE];
+    struct CellIndex unguessed = self->unguessed;
+    int left = countUnguessedCells(&unguessed, -1);
+    long long deadline = monotonicMicroseconds() + cpu->budget * 1000LL;
 
-        switch (players[(_CPUTurn + 1) % 2].board[row][col])
-        {
-            case 'C':
-                if (--players[(_CPUTurn + 1) % 2].shipsHP[CARRIER] == 0 && sunkShip != NULL)
-                    *sunkShip = 'C';
-                break;
-            case 'B':
-                if (--players[(_CPUTurn + 1) % 2].shipsHP[BATTLESHIP] == 0 && sunkShip != NULL)
-                    *sunkShip = 'B';
-                break;
-            case 'D':
-                if (--players[(_CPUTurn + 1) % 2].shipsHP[DESTROYER] == 0 && sunkShip != NULL)
-                    *sunkShip = 'D';
-                break;
-            case 'S':
-                if (--players[(_CPUTurn + 1) % 2].shipsHP[SUBMARINE] == 0 && sunkShip != NULL)
-                    *sunkShip = 'S';
-                break;
-            case 'P':
-                if (--players[(_CPUTurn + 1) % 2].shipsHP[PATROL] == 0 && sunkShip != NULL)
-                    *sunkShip = 'P';
-                break;
-        }
+    memcpy(view, self->actionBoard, sizeof view);
+    shots = shots < left ? shots : left;
 
-        return 'H';
-    }
-    else
+    for (int i = 0; i < shots; i++)
     {
-        players[_CPUTurn].actionBoard[row][col] = 'O';
-        return 'M';
+        int row, col;
+        long long now = monotonicMicroseconds();
+
+        // time left over by one shot goes to the ones after it
+        chooseShot(cpu, view, &unguessed, now + (deadline - now) / (shots - i), &row, &col);
+        view[row][col] = '*'; // marks the cell as taken so that the following shots go elsewhere
+        removeUnguessedCell(&unguessed, (row * 10) + col);
+        cells[i] = (row * 10) + col;
     }
+
+    return shots;
 }
 
 /*
-    Plays the CPU turn on easy difficulty. On easy difficulty, the CPU simply randomly guesses.
+    Tells the CPU the result of a shot chosen by chooseCPUSalvo, marking it on the CPU's action board.
 
-    Parameter
-    ---------
-    `char *moveStatus`:
-        Stores the status of the guess, either 'H' or 'M'.
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU that fired the shot.
     
-    Returns
-    -------
-    Returns `true` if the CPU wins, else it returns `false`.
+    `struct Player *self`:
+        The CPU player.
+    
+    `int cell`:
+        Cell of the shot, given as (row * 10) + col.
+    
+    `char moveStatus`:
+        Result of the shot, 'H' for a hit or 'M' for a miss.
+    
+    `char sunk`:
+        Icon of the ship sunk by the shot, '\0' if none.
 */
-bool playCPUTurnEasy(char *moveStatus)
+void observeCPUShot(struct CPUState *cpu, struct Player *self, int cell, char moveStatus, char sunk)
 {
-    int row, col;
+    removeUnguessedCell(&self->unguessed, cell);
+    self->actionBoard[cell / 10][cell % 10] = moveStatus == 'H' ? 'X' : 'O';
+    observeShot(cpu, self->actionBoard, cell / 10, cell % 10, moveStatus, sunk);
+}
 
-    while (1)
+/*
+    Chooses the cell at which the CPU guesses next.
+
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU choosing the cell.
+    
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The CPU's action board. Only cells containing ' ' may be chosen.
+    
+    `struct CellIndex *unguessed`:
+        The cells of view containing ' '.
+    
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, by which the cell has to be chosen. Only the expert CPU needs
+        time to think, the other difficulties choose at once.
+    
+    `int *row`:
+        Stores the row of the chosen cell.
+    
+    `int *col`:
+        Stores the column of the chosen cell.
+*/
+void chooseShot(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, long long deadline, int *row, int *col)
+{
+    switch (cpu->difficulty)
     {
-        row = rand() % 10; col = rand() % 10; // generate a random position on the board
+        case EASY:
+            chooseShotEasy(cpu, unguessed, row, col);
+            break;
 
-        if (players[_CPUTurn].actionBoard[row][col] == ' ') // if CPU hasn't guessed that position yet
+        case HARD:
+            chooseShotHard(cpu, view, unguessed, row, col);
+            break;
+
+        case EXPERT:
+            if (cpu->expert == NULL) // create the expert's state if it doesn't already exist
+            {
+                cpu->expert = createExpert(nextSeed(&cpu->random));
+
+                if (cpu->expert == NULL)
+                {
+                    printf("Could not create CPU state.\n");
+                    exit(1);
+                }
+            }
+
+            chooseShotExpert(cpu->expert, view, deadline, row, col);
+            break;
+
+        case PLUGIN:
+            chooseShotPlugin(cpu, view, unguessed, deadline, row, col);
+            break;
+
+        case POLICY:
+            choosePolicyShot(_policyPatterns, _policyCells, view, cpu->sunkCells, unguessed, &cpu->random, row, col);
             break;
     }
+}
+
+/*
+    Lets the CPU learn from the result of one of its guesses.
+
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU which made the guess.
+    
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The CPU's action board, with the result of the guess already written into it.
+    
+    `int row`:
+        Row of the guessed cell.
+    
+    `int col`:
+        Column of the guessed cell.
+    
+    `char moveStatus`:
+        Status of the guess, either 'H' or 'M'.
+    
+    `char sunk`:
+        Icon of the ship sunk by the guess, '\0' if none.
+*/
+void observeShot(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], int row, int col, char moveStatus, char sunk)
+{
+    if (cpu->difficulty == HARD)
+        observeShotHard(cpu, view, row, col, moveStatus, sunk);
+    else if (cpu->difficulty == EXPERT && cpu->expert != NULL)
+        observeShotExpert(cpu->expert, row, col, moveStatus, sunk);
+    else if (cpu->difficulty == PLUGIN && cpu->strategyState != NULL)
+        cpu->strategy->observeResult(cpu->strategyState, row, col, moveStatus, sunk);
+    else if (cpu->difficulty == POLICY && sunk != '\0')
+        markPolicySunk(view, &cpu->sunkCells, row, col, getShipLength(getShipFromIcon(sunk)));
+}
 
-    *moveStatus = playGuess(row, col, NULL);
+/*
+    Chooses the CPU's guess on easy difficulty. On easy difficulty, the CPU simply randomly guesses.
 
-    return checkWin(_CPUTurn);
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU choosing the cell.
+    
+    `struct CellIndex *unguessed`:
+        The cells the CPU has not guessed yet.
+    
+    `int *row`:
+        Stores the row of the chosen cell.
+    
+    `int *col`:
+        Stores the column of the chosen cell.
+*/
+void chooseShotEasy(struct CPUState *cpu, struct CellIndex *unguessed, int *row, int *col)
+{
+    randomUnguessedCell(unguessed, -1, &cpu->random, row, col);
 }
 
 /*
-    Plays the CPU turn on hard difficulty. Uses a modified version of the algorithm described here: 
+    Chooses the CPU's guess on hard difficulty. Uses a modified version of the algorithm described here: 
     https://www.datagenetics.com/blog/december32011/index.html (Hunt (with parity)/Target).
     
     Initially, the CPU randomly guesses odd cells.
-    The modified algorithm uses variable _guessOrientation to track successive hits in order to keep guessing the same direction.
+    The modified algorithm uses variable guessOrientation to track successive hits in order to keep guessing the same direction.
     If the current orientation results in going out of bounds of the board or if it results in a miss, then the orientation is flipped.
-    _lastMove keeps track of the last successful move. _checkout is a stack that stores the cells adjacent to a successful hit, it is used
-    to take better informed guesses. _hitCount keeps track of how many successful hits the CPU has had, if the CPU sinks a ships, the length
-    of the ship is subtracted from _hitCount, if _hitCount reaches 0, the stack is emptied.
+    lastMove keeps track of the last successful move. checkout is a stack that stores the cells adjacent to a successful hit, it is used
+    to take better informed guesses. hitCount keeps track of how many successful hits the CPU has had, if the CPU sinks a ships, the length
+    of the ship is subtracted from hitCount, if hitCount reaches 0, the stack is emptied.
 
-    Parameter
-    ---------
-    `char *moveStatus`:
-        Stores the status of the guess, either 'H' or 'M'.
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU choosing the cell.
     
-    Returns
-    -------
-    Returns `true` if the CPU wins, else it returns `false`.
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The CPU's action board.
+    
+    `struct CellIndex *unguessed`:
+        The cells of view containing ' ', from which the hunt picks.
+    
+    `int *row`:
+        Stores the row of the chosen cell.
+    
+    `int *col`:
+        Stores the column of the chosen cell.
 */
-bool playCPUTurnHard(char *moveStatus)
+void chooseShotHard(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, int *row, int *col)
 {
-    char sunk = '\0'; // variable to check whether the CPU sank a ship
-    
-    if (_checkout == NULL) // create a checkout stack if it doesn't already exist
+    if (cpu->checkout == NULL) // create a checkout stack if it doesn't already exist
     {
-        _checkout = createStack(20);
+        cpu->checkout = createStack(CHECKOUT_SIZE);
 
-        if (_checkout == NULL)
+        if (cpu->checkout == NULL)
         {
             printf("Could not create CPU stack.\n");
             exit(1);
         }
     }
 
-    int row, col; // row and column of the current guess
-
-    // if there is no previously stored _guessOrientation and stack is empty then the CPU will randomly select an odd numbered cell
-    if (_guessOrientation == 0 && isStackEmpty(_checkout))
+    while (1) // every pass either chooses a cell or drops a lead, so the loop always ends with the hunt at the latest
     {
-        while (1)
+        // if there is no previously stored guessOrientation and stack is empty then the CPU will randomly select an odd numbered cell
+        if (cpu->guessOrientation == 0 && isStackEmpty(cpu->checkout))
         {
-            row = rand() % 10; col = rand() % 10; // generate a random position on the board
+            // if all odd cells have been guessed, or the hunt ignores parity, any cell will do
+            if (!cpu->hard.huntParity || !randomUnguessedCell(unguessed, 1, &cpu->random, row, col))
+                randomUnguessedCell(unguessed, -1, &cpu->random, row, col);
 
-            if ((row + col) % 2 == 0) // making sure to only hit odd cells
-                continue;
-
-            if (players[_CPUTurn].actionBoard[row][col] == ' ') // if CPU hasn't guessed that position yet, then stop randomly choosing
-                break;
+            TRACE_MARK("hunt");
+            return;
         }
-    }
-    else // if a _guessOrientation had been stored previously
-    {
-        // if last guess was a hit and the _checkout stack isn't empty and we have a guess orientation, no need to pop from stack
-        if (_lastMove != -1 && !isStackEmpty(_checkout) && _guessOrientation != 0)
+
+        // if last guess was a hit and the checkout stack isn't empty and we have a guess orientation, no need to pop from stack
+        if (cpu->lastMove != -1 && !isStackEmpty(cpu->checkout) && cpu->guessOrientation != 0)
         {
-            row = (_lastMove + _guessOrientation) / 10;
-            col = (_lastMove + _guessOrientation) % 10;
+            *row = (cpu->lastMove / 10) + (cpu->guessOrientation / 10);
+            *col = (cpu->lastMove % 10) + (cpu->guessOrientation % 10);
 
-            // if new cell goes beyond the boundaries of the game board, we try and flip the _guessOrientation
-            if (row < 0 || row == BOARD_SIZE || col < 0 || col == BOARD_SIZE)
+            // if new cell goes beyond the boundaries of the game board, we try and flip the guessOrientation
+            if (!isOnBoard(*row, *col))
             {
-                row = _lastMove / 10; col = _lastMove % 10;
-                _guessOrientation = (-_guessOrientation);
+                TRACE_MARK("flip");
+                *row = cpu->lastMove / 10; *col = cpu->lastMove % 10;
+                cpu->guessOrientation = (-cpu->guessOrientation);
                 
                 // keep moving in the flipped orientation until we find an empty cell or a missed cell
-                while (1)
+                do
                 {
-                    row = row + (_guessOrientation / 10);
-                    col = col + (_guessOrientation % 10);
-
-                    // if the flip results in the finding of a missed cell, then we reset _guessOrientation and play the turn again
-                    if (players[_CPUTurn].actionBoard[row][col] == 'O')
-                    {
-                        _guessOrientation = 0;
-                        return playCPUTurnHard(moveStatus);
-                    }
-
-                    if (players[_CPUTurn].actionBoard[row][col] == ' ')
-                        break;
-                }
+                    *row += (cpu->guessOrientation / 10);
+                    *col += (cpu->guessOrientation % 10);
+                } while (isOnBoard(*row, *col) && view[*row][*col] == 'X');
+
+                // changes lastMove so that it becomes the position before the empty cell
+                cpu->lastMove = ((*row - (cpu->guessOrientation / 10)) * 10) + (*col - (cpu->guessOrientation % 10));
+            }
 
-                // changes _lastMove so that it becomes the position before the missed cell
-                _lastMove = ((row - (_guessOrientation / 10)) * 10) + (col - (_guessOrientation % 10));
+            if (isOnBoard(*row, *col) && view[*row][*col] == ' ')
+            {
+                TRACE_MARK("target");
+                return;
             }
+
+            // if the flip results in the finding of a missed cell, then we reset guessOrientation and try again
+            cpu->guessOrientation = 0;
+            continue;
         }
+
         // if last move was a hit and stack isn't empty and we don't have a guess orientation
-        // or if last move was a miss and stack isn't empty and _guessOrientation = 0
-        else
+        // or if last move was a miss and stack isn't empty and guessOrientation = 0
+        if (isStackEmpty(cpu->checkout))
         {
-            int guessCell = pop(_checkout);
-            row = guessCell / 10; col = guessCell % 10;
+            cpu->guessOrientation = 0;
+            continue;
         }
-    }
 
-    *moveStatus = playGuess(row, col, &sunk);
+        int guessCell = pop(cpu->checkout);
+        *row = guessCell / 10; *col = guessCell % 10;
 
-    int orientations[4] = { 1, -1, 10, -10 };
-    shuffleArray(orientations, 4); // shuffles the orientations array
+        if (view[*row][*col] == ' ')
+        {
+            TRACE_MARK("target");
+            return;
+        }
+    }
+}
+
+/*
+    Updates the hard difficulty CPU's variables with the result of its guess. See `chooseShotHard` for how they
+    are used.
 
-    if (*moveStatus == 'H') // if guess resulted in a hit
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU which made the guess.
+    
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The CPU's action board, with the result of the guess already written into it.
+    
+    `int row`:
+        Row of the guessed cell.
+    
+    `int col`:
+        Column of the guessed cell.
+    
+    `char moveStatus`:
+        Status of the guess, either 'H' or 'M'.
+    
+    `char sunk`:
+        Icon of the ship sunk by the guess, '\0' if none.
+*/
+void observeShotHard(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], int row, int col, char moveStatus, char sunk)
+{
+    if (moveStatus == 'H') // if guess resulted in a hit
     {
         short successfulMove = (row * 10) + col;
-        _hitCount++;
+        cpu->hitCount++;
 
         if (sunk == '\0')
         {
-            if (!isStackEmpty(_checkout))
+            int orientations[4] = { 1, -1, 10, -10 };
+
+            if (cpu->hard.neighbourOrder == 0)
+                shuffleArray(orientations, 4, &cpu->random); // shuffles the orientations array
+            else
+                permuteArray(orientations, 4, cpu->hard.neighbourOrder - 1);
+
+            if (!isStackEmpty(cpu->checkout))
             {
-                _guessOrientation = successfulMove - _lastMove;
+                cpu->guessOrientation = successfulMove - cpu->lastMove;
             }
 
             // then we need to add adjacent cells to stack
             for (int i = 0; i < 4; i++)
             {
-                if (orientations[i] == _guessOrientation)
+                if (orientations[i] == cpu->guessOrientation)
                     continue;
                 
-                int adjRow = (successfulMove / 10) + (orientations[i] / 10);
-                int adjCol = (successfulMove % 10) + (orientations[i] % 10);
+                int adjRow = row + (orientations[i] / 10);
+                int adjCol = col + (orientations[i] % 10);
 
-                if (adjRow < 0 || adjRow == BOARD_SIZE || adjCol < 0 || adjCol == BOARD_SIZE)
+                if (!isOnBoard(adjRow, adjCol))
                     continue;
                 
-                if (players[_CPUTurn].actionBoard[adjRow][adjCol] != ' ')
+                if (view[adjRow][adjCol] != ' ')
                     continue;
                 
-                if (stackContains(_checkout, (adjRow * 10) + adjCol))
+                if (stackContains(cpu->checkout, (adjRow * 10) + adjCol))
+                    continue;
+
+                if (cpu->checkout->stackPointer >= cpu->hard.checkoutSize)
                     continue;
                 
-                push(_checkout, (adjRow * 10) + adjCol);
+                push(cpu->checkout, (adjRow * 10) + adjCol);
             }
         }
         else
         {
-            switch (sunk)
-            {
-                case 'C':
-                    _hitCount -= 5;
-                    break;
-
-                case 'B':
-                    _hitCount -= 4;
-                    break;
-                
-                case 'D':
-                case 'S':
-                    _hitCount -= 3;
-                    break;
-                
-                case 'P':
-                    _hitCount -= 2;
-                    break;
-            }
-
-            sunk = '\0';
+            cpu->hitCount -= getShipLength(getShipFromIcon(sunk));
 
-            if (_hitCount == 0)
+            if (cpu->hitCount == 0)
             {
-                clearStack(_checkout);
+                clearStack(cpu->checkout);
             }
 
-            _guessOrientation = 0;
+            cpu->guessOrientation = 0;
         }
 
-        _lastMove = successfulMove;
+        cpu->lastMove = successfulMove;
     }
     else // if guess resulted in a miss
     {
-        if (!_orientationFlipped && _guessOrientation != 0)
+        if (cpu->orientationFlips < cpu->hard.flips && cpu->guessOrientation != 0)
         {
-            _guessOrientation = (-_guessOrientation);
-            int tempRow = _lastMove / 10, tempCol = _lastMove % 10;
+            cpu->guessOrientation = (-cpu->guessOrientation);
+            int tempRow = cpu->lastMove / 10, tempCol = cpu->lastMove % 10;
 
             while (1)
             {
-                tempRow += (_guessOrientation / 10);
-                tempCol += (_guessOrientation % 10);
+                tempRow += (cpu->guessOrientation / 10);
+                tempCol += (cpu->guessOrientation % 10);
 
-                if (players[_CPUTurn].actionBoard[tempRow][tempCol] == ' ')
+                if (!isOnBoard(tempRow, tempCol) || view[tempRow][tempCol] == 'O')
                 {
-                    tempRow -= (_guessOrientation / 10);
-                    tempCol -= (_guessOrientation % 10);
-
-                    _lastMove = (tempRow * 10) + tempCol;
-
+                    cpu->guessOrientation = 0;
                     break;
                 }
-                else if (players[_CPUTurn].actionBoard[_lastMove / 10][_lastMove % 10] == 'O')
+                else if (view[tempRow][tempCol] == ' ')
                 {
-                    _guessOrientation = 0;
+                    tempRow -= (cpu->guessOrientation / 10);
+                    tempCol -= (cpu->guessOrientation % 10);
+
+                    cpu->lastMove = (tempRow * 10) + tempCol;
+
                     break;
                 }
             }
 
-            _orientationFlipped = true;
+            cpu->orientationFlips++;
         }
         else
         {
-            _guessOrientation = 0;
-            _orientationFlipped = false;
+            cpu->guessOrientation = 0;
+            cpu->orientationFlips = 0;
         }
     }
+}
 
-    return checkWin(_CPUTurn);
+/*
+    Randomly picks a cell that has not been guessed yet, in constant time however far the game has gone.
+
+    Parameters
+    ----------
+    `struct CellIndex *unguessed`:
+        The cells to pick from.
+    
+    `int parity`:
+        If 0 or 1, only cells for which (row + col) % 2 equals parity are picked. If -1, any cell can be picked.
+    
+    `struct Random *random`:
+        Generator used to pick the cell.
+    
+    `int *row`:
+        Stores the row of the picked cell.
+    
+    `int *col`:
+        Stores the column of the picked cell.
+    
+    Returns
+    -------
+    Returns `true` if a cell was picked, `false` if there is no unguessed cell left to pick from.
+*/
+bool randomUnguessedCell(struct CellIndex *unguessed, int parity, struct Random *random, int *row, int *col)
+{
+    int cell = pickUnguessedCell(unguessed, parity, nextRandom(random, 1U << 31));
+
+    if (cell == -1)
+        return false;
+
+    *row = cell / 10; *col = cell % 10;
+
+    return true;
+}
+
+/*
+    Checks whether the given row and column lie within the game board.
+*/
+bool isOnBoard(int row, int col)
+{
+    return row >= 0 && row < BOARD_SIZE && col >= 0 && col < BOARD_SIZE;
 }
 
 /*
@@ -507,14 +772,17 @@ bool playCPUTurnHard(char *moveStatus)
     
     `int n`:
         Size of array
+    
+    `struct Random *random`:
+        Generator used to shuffle the array.
 */
-void shuffleArray(int *array, int size)
+void shuffleArray(int *array, int size, struct Random *random)
 {
     if (size > 1)
     {
         for (int i = 0; i < size - 1; i++)
         {
-            int j = i + rand() / (RAND_MAX / (size - i) + 1);
+            int j = i + nextRandom(random, size - i);
             int t = array[j];
             array[j] = array[i];
             array[i] = t;
@@ -523,14 +791,175 @@ void shuffleArray(int *array, int size)
 }
 
 /*
-    Resets all the CPU variables.
+    Chooses the CPU's guess on plugin difficulty, by asking the CPU's strategy. A guess the strategy may not 
+    make is replaced by a random one, so that a faulty strategy cannot stop the game.
+
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU.
+    
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The board of the CPU's guesses so far.
+    
+    `struct CellIndex *unguessed`:
+        The cells of view that have not been guessed yet.
+    
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, by which the cell has to be chosen.
+    
+    `int *row`:
+        Stores the row of the chosen cell.
+    
+    `int *col`:
+        Stores the column of the chosen cell.
+*/
+void chooseShotPlugin(struct CPUState *cpu, char view[BOARD_SIZE][BOARD_SIZE], struct CellIndex *unguessed, long long deadline, int *row, int *col)
+{
+    struct StrategyView strategyView;
+
+    if (cpu->strategy == NULL)
+    {
+        chooseShotEasy(cpu, unguessed, row, col);
+        return;
+    }
+
+    if (cpu->strategyState == NULL) // create the strategy's state if it doesn't already exist
+    {
+        cpu->strategyState = cpu->strategy->init(nextSeed(&cpu->random));
+
+        if (cpu->strategyState == NULL)
+        {
+            printf("Could not create the state of strategy %s.\n", cpu->strategy->name);
+            exit(1);
+        }
+    }
+
+    strategyView.actionBoard = (const char (*)[STRATEGY_BOARD_SIZE]) view;
+    strategyView.microsecondsLeft = deadline - monotonicMicroseconds();
+
+    for (int i = 0; i < SHIPS; i++)
+        strategyView.shipLengths[i] = getShipLength(i);
+
+    *row = -1;
+    *col = -1;
+    cpu->strategy->chooseShot(cpu->strategyState, &strategyView, row, col);
+
+    if (!isOnBoard(*row, *col) || view[*row][*col] != ' ')
+        chooseShotEasy(cpu, unguessed, row, col);
+}
+
+/*
+    Resets all the CPU variables and frees the memory held by the given CPUState.
+
+    Parameter
+    ---------
+    `struct CPUState *cpu`:
+        The CPUState to reset.
 */
-void resetCPUVariables()
+void resetCPUVariables(struct CPUState *cpu)
 {
-    destoryStack(_checkout);
+    if (cpu->checkout != NULL)
+        destoryStack(cpu->checkout);
+
+    destroyExpert(cpu->expert);
+
+    if (cpu->strategyState != NULL)
+        cpu->strategy->free(cpu->strategyState);
+
+    const struct Strategy *strategy = cpu->strategy;
+    struct HardParameters hard = cpu->hard;
+
+    initCPUState(cpu, 0, cpu->difficulty, cpu->random.state);
+    cpu->strategy = strategy;
+    cpu->hard = hard;
+}
+/*
+    Rebuilds what a CPU remembers about a game that is not kept in its CPUState itself, so that a game can be 
+    continued from its boards alone. Only the expert CPU, strategies and the policy CPU need this, which relearn
+    every guess made so far.
+
+    Parameters
+    ----------
+    `struct CPUState *cpu`:
+        State of the CPU, as it was saved.
+    
+    `struct Player *self`:
+        The CPU player.
     
-    _CPUTurn = 0;
-    _lastMove = -1;
-    _checkout = NULL;
-    _hitCount = 0;
-}
\ No newline at end of file
+    `struct Player *opponent`:
+        The CPU player's opponent.
+*/
+void restoreCPUState(struct CPUState *cpu, struct Player *self, struct Player *opponent)
+{
+    // seeded from a copy of the CPU's generator, so that restoring the CPU leaves its state exactly as saved
+    struct Random random = cpu->random;
+    unsigned long long seed = nextSeed(&random);
+
+    if (cpu->difficulty == EXPERT && cpu->expert == NULL)
+        cpu->expert = createExpert(seed);
+    else if (cpu->difficulty == PLUGIN && cpu->strategy != NULL && cpu->strategyState == NULL)
+        cpu->strategyState = cpu->strategy->init(seed);
+    else if (cpu->difficulty != POLICY)
+        return;
+
+    if (cpu->difficulty != POLICY && cpu->expert == NULL && cpu->strategyState == NULL) // left for the CPU's next turn to report
+        return;
+
+    for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; cell++)
+    {
+        char guess = self->actionBoard[cell / 10][cell % 10];
+
+        if (guess != ' ')
+            observeShot(cpu, self->actionBoard, cell / 10, cell % 10, guess == 'X' ? 'H' : 'M', '\0');
+    }
+
+    // every ship sunk is seen again through one of its cells, all of which have been hit by then
+    for (int ship = 0; ship < SHIPS; ship++)
+    {
+        for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE && opponent->shipsHP[ship] == 0; cell++)
+        {
+            if (opponent->board[cell / 10][cell % 10] == getShipIcon(ship))
+            {
+                observeShot(cpu, self->actionBoard, cell / 10, cell % 10, 'H', getShipIcon(ship));
+                break;
+            }
+        }
+    }
+}
+
+/*
+    Puts an array into one of its fixed orders, the same every time for the same order, so that the hard CPU can
+    explore the cells next to a hit in a tuned order instead of a random one.
+
+    Parameters
+    ----------
+    `int *array`:
+        Array to put in order.
+    
+    `int size`:
+        Size of array, at most 12.
+    
+    `int order`:
+        Number of the order, from 0 to size! - 1, 0 leaving the array as it is.
+*/
+void permuteArray(int *array, int size, int order)
+{
+    // the order is read as a number whose i-th digit, counted in base size - i, picks the i-th element from
+    // those left
+    for (int i = 0; i < size - 1; i++)
+    {
+        int count = 1;
+
+        for (int j = 2; j < size - i; j++)
+            count *= j;
+
+        int pick = i + (order / count) % (size - i);
+        int t = array[pick];
+
+        for (int j = pick; j > i; j--)
+            array[j] = array[j - 1];
+
+        array[i] = t;
+    }
+}
@@ -0,0 +1,343 @@
+/*
+
+File Name: defence.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the expert CPU's ship placement, which looks for a fleet layout that the known ways of attacking
+    take long to sink.
+
+    A number of random layouts are drawn, and every attacker plays a few games against each of them. The easy
+    CPU is left out, since guessing at random takes as long against any layout. The hard CPU plays as it does
+    in a real game, and a density attacker guesses the cell covered by the most placements of the ships left,
+    much like a careful human would. Layouts are compared by the mean number of shots they took to sink, and
+    after every round of games the weaker half is dropped, so clearly weak layouts cost only a few games while
+    the strong ones are played until the differences between them can be trusted. The games of a round are
+    shared between threads, and the placement stops at the deadline with whatever it has found by then. The
+    fleet is finally picked at random among the hardest layouts left, so that it cannot be predicted from the
+    attackers alone.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. defence.h
+    2. thread.h
+    3. timing.h
+    4. trace.h
+
+    STRUCTS
+    -------
+    1. DefenceCandidate
+    2. DefenceTask
+
+    FUNCTIONS (global)
+    ------------------
+    void placeShipsExpert(struct Player *cpuPlayer, int threads, long long deadline)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *playRound(void *argument)
+    2. int playHard(unsigned char fleet[SHIPS], struct Random *random)
+    3. int playDensity(unsigned char fleet[SHIPS], struct Random *random)
+    4. double meanShots(const struct DefenceCandidate *candidate)
+    5. int compareCandidates(const void *first, const void *second)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <defence.h>
+#include <thread.h>
+#include <timing.h>
+#include <trace.h>
+#include <string.h>
+
+/*
+    DefenceCandidate struct, contains a fleet layout being considered. Contains:
+    - unsigned char fleet[SHIPS]: placement of every ship, an index into getPlacements.
+    - long long shots: total shots the attackers took to sink the layout.
+    - int games: number of games played against the layout.
+*/
+struct DefenceCandidate {
+    unsigned char fleet[SHIPS];
+    long long shots;
+    int games;
+};
+
+/*
+    DefenceTask struct, contains the games of one round played by one thread. Contains:
+    - struct DefenceCandidate *candidates: the layouts still considered.
+    - int count: number of layouts still considered.
+    - int first: first layout played against by the thread.
+    - int step: distance between two layouts played against by the thread.
+    - struct Random random: generator of the thread, used to seed the attackers.
+    - long long deadline: time, as given by monotonicMicroseconds, after which no more games are started.
+*/
+struct DefenceTask {
+    struct DefenceCandidate *candidates;
+    int count;
+    int first;
+    int step;
+    struct Random random;
+    long long deadline;
+};
+
+void *playRound(void *argument);
+int playHard(unsigned char fleet[SHIPS], struct Random *random);
+int playDensity(unsigned char fleet[SHIPS], struct Random *random);
+double meanShots(const struct DefenceCandidate *candidate);
+int compareCandidates(const void *first, const void *second);
+
+/*
+    Places the expert CPU's ships. See the top of this file for how.
+
+    Parameters
+    ----------
+    `struct Player *cpuPlayer`:
+        The CPU player whose ships are to be placed, with an empty board.
+
+    `int threads`:
+        Number of threads to play the games on, at most DEFENCE_MAX_THREADS are used.
+
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, by which the ships have to be placed.
+*/
+void placeShipsExpert(struct Player *cpuPlayer, int threads, long long deadline)
+{
+    struct DefenceCandidate candidates[DEFENCE_CANDIDATES];
+    struct DefenceTask tasks[DEFENCE_MAX_THREADS];
+    struct Random random;
+    int considered = DEFENCE_CANDIDATES;
+
+    TRACE_BEGIN("placeShipsExpert");
+    initPlacements(); // before any thread looks at the placements
+    seedRandom(&random, randomSeed());
+    threads = threads < 1 ? 1 : (threads > DEFENCE_MAX_THREADS ? DEFENCE_MAX_THREADS : threads);
+
+    for (int i = 0; i < DEFENCE_CANDIDATES; i++)
+    {
+        drawFleet(&random, candidates[i].fleet);
+        candidates[i].shots = 0;
+        candidates[i].games = 0;
+    }
+
+    while (considered > DEFENCE_FINALISTS && monotonicMicroseconds() < deadline)
+    {
+        for (int i = 0; i < threads; i++)
+        {
+            tasks[i].candidates = candidates;
+            tasks[i].count = considered;
+            tasks[i].first = i;
+            tasks[i].step = threads;
+            tasks[i].deadline = deadline;
+            seedRandom(&tasks[i].random, nextSeed(&random));
+        }
+
+        runShares(playRound, tasks, sizeof(struct DefenceTask), threads);
+
+        qsort(candidates, considered, sizeof(struct DefenceCandidate), compareCandidates);
+        considered /= 2;
+    }
+
+    considered = considered < DEFENCE_FINALISTS ? considered : DEFENCE_FINALISTS;
+    placeFleet(cpuPlayer, candidates[nextRandom(&random, considered)].fleet);
+    TRACE_END("placeShipsExpert");
+}
+
+/*
+    Plays one round of games against one thread's share of the layouts still considered. Runs on its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The DefenceTask to run.
+*/
+void *playRound(void *argument)
+{
+    struct DefenceTask *task = (struct DefenceTask *) argument;
+
+    for (int i = task->first; i < task->count; i += task->step)
+    {
+        struct DefenceCandidate *candidate = &task->candidates[i];
+
+        for (int j = 0; j < DEFENCE_PLAYOUTS && monotonicMicroseconds() < task->deadline; j++)
+        {
+            candidate->shots += playHard(candidate->fleet, &task->random);
+            candidate->shots += playDensity(candidate->fleet, &task->random);
+            candidate->games += 2;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Plays a game of the hard CPU against a fleet layout.
+
+    Parameters
+    ----------
+    `unsigned char fleet[SHIPS]`:
+        The layout attacked.
+
+    `struct Random *random`:
+        Generator used to seed the CPU.
+
+    Returns
+    -------
+    Returns the number of shots the CPU took to sink the fleet.
+*/
+int playHard(unsigned char fleet[SHIPS], struct Random *random)
+{
+    struct Player attacker, defender;
+    struct CPUState cpu;
+    char moveStatus;
+    int shots = 1;
+
+    resetPlayer(&attacker);
+    resetPlayer(&defender);
+    placeFleet(&defender, fleet);
+    initCPUState(&cpu, 0, HARD, nextSeed(random));
+
+    while (!playCPUTurn(&cpu, &attacker, &defender, &moveStatus))
+        shots++;
+
+    resetCPUVariables(&cpu);
+
+    return shots;
+}
+
+/*
+    Plays a game of the density attacker against a fleet layout. Every turn, the attacker counts for each cell
+    how many placements of the ships it has not sunk yet cover it and avoid its misses, and guesses a cell with
+    the highest count. Placements through hits of ships that are still afloat count DEFENCE_TARGET_WEIGHT times
+    as much for every such hit, which makes the attacker finish off a ship once it has found it. Like a human,
+    it knows which cells a ship covered once it is sunk.
+
+    Parameters
+    ----------
+    `unsigned char fleet[SHIPS]`:
+        The layout attacked.
+
+    `struct Random *random`:
+        Generator used to break ties between cells.
+
+    Returns
+    -------
+    Returns the number of shots the attacker took to sink the fleet.
+*/
+int playDensity(unsigned char fleet[SHIPS], struct Random *random)
+{
+    const struct Placement *placements[SHIPS];
+    struct CellMask ships[SHIPS], guessed = { { 0, 0 } }, open = { { 0, 0 } }, sunkCells = { { 0, 0 } };
+    unsigned char candidates[SHIPS][MAX_PLACEMENTS];
+    int candidateCounts[SHIPS], hitPoints[SHIPS], shots = 0, left = SHIPS;
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        candidateCounts[i] = getPlacements(i, &placements[i]);
+        ships[i] = placements[i][fleet[i]].mask;
+        hitPoints[i] = getShipLength(i);
+
+        for (int j = 0; j < candidateCounts[i]; j++)
+            candidates[i][j] = j;
+    }
+
+    while (left > 0)
+    {
+        long long scores[CELLS] = { 0 };
+
+        for (int i = 0; i < SHIPS; i++)
+        {
+            for (int j = 0; j < candidateCounts[i] && hitPoints[i] > 0; j++)
+            {
+                struct CellMask mask = placements[i][candidates[i][j]].mask;
+                struct CellMask unknown = maskDifference(mask, guessed);
+
+                if (masksOverlap(mask, sunkCells))
+                    continue;
+
+                long long weight = 1;
+
+                for (int hits = maskCount(maskIntersection(mask, open)); hits > 0; hits--)
+                    weight *= DEFENCE_TARGET_WEIGHT;
+
+                for (int cell = maskLowest(unknown); cell != -1; maskClear(&unknown, cell), cell = maskLowest(unknown))
+                    scores[cell] += weight;
+            }
+        }
+
+        int best = -1, ties = 0;
+
+        for (int cell = 0; cell < CELLS; cell++)
+        {
+            if (maskTest(guessed, cell))
+                continue;
+
+            // a cell scoring as high as the best so far replaces it with a chance that makes every tie as likely
+            if (best == -1 || scores[cell] > scores[best])
+            {
+                best = cell;
+                ties = 1;
+            }
+            else if (scores[cell] == scores[best] && nextRandom(random, ++ties) == 0)
+            {
+                best = cell;
+            }
+        }
+
+        Ships hit = -1;
+
+        shots++;
+        maskSet(&guessed, best);
+
+        for (int i = 0; i < SHIPS && hit == -1; i++)
+            hit = maskTest(ships[i], best) ? i : -1;
+
+        if (hit == -1)
+        {
+            // placements through the miss are dropped for good
+            for (int i = 0; i < SHIPS; i++)
+            {
+                int kept = 0;
+
+                for (int j = 0; j < candidateCounts[i]; j++)
+                {
+                    if (!maskTest(placements[i][candidates[i][j]].mask, best))
+                        candidates[i][kept++] = candidates[i][j];
+                }
+
+                candidateCounts[i] = kept;
+            }
+        }
+        else if (--hitPoints[hit] == 0)
+        {
+            left--;
+            open = maskDifference(open, ships[hit]);
+            sunkCells = maskUnion(sunkCells, ships[hit]);
+        }
+        else
+        {
+            maskSet(&open, best);
+        }
+    }
+
+    return shots;
+}
+
+/*
+    Returns the mean number of shots taken to sink a layout, -1 if no game has been played against it.
+*/
+double meanShots(const struct DefenceCandidate *candidate)
+{
+    return candidate->games > 0 ? (double) candidate->shots / candidate->games : -1;
+}
+
+/*
+    Compares two layouts for qsort, putting the one that took more shots to sink first.
+*/
+int compareCandidates(const void *first, const void *second)
+{
+    double difference = meanShots((const struct DefenceCandidate *) second) - meanShots((const struct DefenceCandidate *) first);
+
+    return (difference > 0) - (difference < 0);
+}
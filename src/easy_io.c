@@ -17,8 +17,9 @@ ________________________________________________________________________________
     2. ReturnCode takeNInput(void *inputVar, DataType type, int inputSize)
     3. ReturnCode takeInputWithPropmt(char *propmt, void *inputVar, DataType type)
     4. ReturnCode takeNInputWithPropmt(char *propmt, void *inputVar, DataType type, int inputSize)
-    5. void clearScreen(void)
-    6. short checkInputValidity(
+    5. ReturnCode takeLine(char *line, int lineSize)
+    6. void clearScreen(void)
+    7. short checkInputValidity(
             ReturnCode returnCode, 
             char *cannotReadMessage, 
             char *tooLongMessage, 
@@ -32,6 +33,7 @@ ________________________________________________________________________________
 
 #include <easy_io.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
     This macro defines a function CLSCR() which contains system specific code to clear screen.
@@ -230,6 +232,52 @@ ReturnCode takeNInputWithPropmt(char *propmt, void *inputVar, DataType type, int
     return takeNInput(inputVar, type, inputSize);
 }
 
+/*
+    This function reads a whole line from stdin as it is, without the trailing newline. Unlike the takeInput 
+    functions, an empty line is a valid input.
+
+    Parameters
+    ----------
+    `char *line`:
+        Array in which to store the line.
+    
+    `int lineSize`:
+        Size of the array, including space for the terminating null character.
+    
+    Returns
+    -------
+    Returns `OK` if a line was read, 
+    else returns a value of datatype ReturnCode with one of the following values:
+        `ERR_TOO_LONG` - if the line does not fit in the array, the part that fits is still stored.
+        `ERR_CANNOT_READ` - if for whatever reason, fgets was not able to reed from stdin.
+*/
+ReturnCode takeLine(char *line, int lineSize)
+{
+    if (!fgets(line, lineSize, stdin))
+        return ERR_CANNOT_READ;
+
+    size_t length = strlen(line);
+
+    if (length > 0 && line[length - 1] == '\n')
+    {
+        line[--length] = '\0';
+
+        if (length > 0 && line[length - 1] == '\r')
+            line[--length] = '\0';
+
+        return OK;
+    }
+
+    if (feof(stdin)) // last line of input without a newline
+        return OK;
+
+    // clearing stdin buffer
+    int dump;
+    while ((dump = fgetc(stdin)) != '\n' && dump != EOF);
+
+    return ERR_TOO_LONG;
+}
+
 /*
     This function allows for automatic inference of the value returned by takeInput or takeNInput functions.
 
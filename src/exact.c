@@ -0,0 +1,417 @@
+/*
+
+File Name: exact.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains an exact count of the fleet layouts consistent with a set of guesses, and of how many of them put a
+    ship on each cell. It serves as ground truth for the CPUs that only estimate these numbers, and lets the
+    expert CPU drop its estimates whenever the count can be finished in time.
+
+    Ships are placed one after the other, each on one of its placements that avoids the misses. The number of
+    ways to place the remaining ships only depends on which of the cells they can still reach are occupied, so
+    it is remembered for every such set of cells, and most of the game tree is never walked twice. A hit that
+    none of the remaining ships can reach has to be covered already, which cuts dead branches early. Once every
+    sub-fleet has been counted, a second pass walks the remembered sets from the first ship to the last, passing
+    on the number of ways to reach each set, which gives the number of layouts using every placement of every
+    ship. Every thread counts the layouts for its own share of the first ship's placements.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. exact.h
+    2. thread.h
+    3. timing.h
+
+    STRUCTS
+    -------
+    1. ExactProblem
+    2. ExactEntry
+    3. ExactTask
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool countLayouts(
+            struct CellMask misses, struct CellMask hits, bool sunk[SHIPS],
+            int threads, long long deadline, struct ExactResult *result
+        )
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *countRange(void *argument)
+    2. unsigned long long countSubFleets(struct ExactTask *task, int ship, struct CellMask occupied)
+    3. struct ExactEntry *findEntry(struct ExactTask *task, int ship, struct CellMask occupied)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <exact.h>
+#include <thread.h>
+#include <timing.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    ExactProblem struct, contains what every thread needs to know about the layouts being counted. Contains:
+    - int counts[SHIPS]: number of placements of each ship that fit the guesses.
+    - struct CellMask masks[SHIPS][MAX_PLACEMENTS]: the cells covered by each of those placements.
+    - struct CellMask reachable[SHIPS + 1]: cells that each ship or any ship after it can cover.
+    - struct CellMask settled[SHIPS]: hits that have to be covered once each ship has been placed, since no ship
+      after it can reach them.
+*/
+struct ExactProblem {
+    int counts[SHIPS];
+    struct CellMask masks[SHIPS][MAX_PLACEMENTS];
+    struct CellMask reachable[SHIPS + 1];
+    struct CellMask settled[SHIPS];
+};
+
+/*
+    ExactEntry struct, contains one remembered set of occupied cells. Contains:
+    - struct CellMask occupied: the occupied cells that the remaining ships can reach.
+    - unsigned long long count: number of ways to place the remaining ships.
+    - unsigned long long ways: number of ways to place the ships before them and end up with these cells.
+    - int ship: first of the remaining ships, 0 if the entry is unused.
+*/
+struct ExactEntry {
+    struct CellMask occupied;
+    unsigned long long count;
+    unsigned long long ways;
+    int ship;
+};
+
+/*
+    ExactTask struct, contains the share of the count done by one thread. Contains:
+    - const struct ExactProblem *problem: the layouts being counted.
+    - int first: first placement of the first ship counted by the thread.
+    - int step: distance between two placements of the first ship counted by the thread.
+    - long long deadline: time, as given by monotonicMicroseconds, by which the count has to be done.
+    - struct ExactEntry *table: the sets remembered by the thread, a hash table of EXACT_TABLE_SIZE entries.
+    - int *order: positions in table of the entries in use, in the order they were filled in.
+    - int used: number of entries in use.
+    - bool failed: whether the table filled up or the deadline passed.
+    - unsigned long long layouts[SHIPS][MAX_PLACEMENTS]: number of layouts counted using each placement.
+*/
+struct ExactTask {
+    const struct ExactProblem *problem;
+    int first;
+    int step;
+    long long deadline;
+    struct ExactEntry *table;
+    int *order;
+    int used;
+    bool failed;
+    unsigned long long layouts[SHIPS][MAX_PLACEMENTS];
+};
+
+void *countRange(void *argument);
+unsigned long long countSubFleets(struct ExactTask *task, int ship, struct CellMask occupied);
+struct ExactEntry *findEntry(struct ExactTask *task, int ship, struct CellMask occupied);
+
+/*
+    Counts the fleet layouts consistent with a set of guesses exactly. See the top of this file for how.
+
+    Parameters
+    ----------
+    `struct CellMask misses`:
+        Cells guessed without hitting a ship.
+
+    `struct CellMask hits`:
+        Cells guessed that hit a ship.
+
+    `bool sunk[SHIPS]`:
+        Ships that have been sunk, which lie only on hits. Ships that have not been sunk do not.
+
+    `int threads`:
+        Number of threads to count on, at most EXACT_MAX_THREADS are used.
+
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, after which the count is given up.
+
+    `struct ExactResult *result`:
+        Stores the counts.
+
+    Returns
+    -------
+    Returns `true` if the count was finished, `false` if it could not be finished by the deadline or with the
+    memory it is allowed.
+*/
+bool countLayouts(
+    struct CellMask misses, struct CellMask hits, bool sunk[SHIPS],
+    int threads, long long deadline, struct ExactResult *result
+)
+{
+    struct ExactProblem *problem = (struct ExactProblem *) malloc(sizeof(struct ExactProblem));
+
+    if (problem == NULL)
+        return false;
+
+    memset(result, 0, sizeof *result);
+    memset(problem->reachable, 0, sizeof problem->reachable);
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        int count = getPlacements(i, &placements);
+
+        problem->counts[i] = 0;
+
+        // a ship lying only on hits has to be sunk, and a sunk ship has to lie only on hits
+        for (int j = 0; j < count; j++)
+        {
+            if (!masksOverlap(placements[j].mask, misses) && maskIsSubset(placements[j].mask, hits) == sunk[i])
+            {
+                problem->masks[i][problem->counts[i]++] = placements[j].mask;
+            }
+        }
+    }
+
+    for (int i = SHIPS - 1; i >= 0; i--)
+    {
+        problem->reachable[i] = problem->reachable[i + 1];
+
+        for (int j = 0; j < problem->counts[i]; j++)
+            problem->reachable[i] = maskUnion(problem->reachable[i], problem->masks[i][j]);
+
+        problem->settled[i] = maskDifference(maskIntersection(hits, problem->reachable[i]), problem->reachable[i + 1]);
+    }
+
+    // a hit that no ship can reach leaves no layout at all
+    if (!maskIsSubset(hits, problem->reachable[0]))
+    {
+        free(problem);
+        return true;
+    }
+
+    threads = threads < 1 ? 1 : (threads > EXACT_MAX_THREADS ? EXACT_MAX_THREADS : threads);
+    threads = threads > problem->counts[0] ? (problem->counts[0] > 0 ? problem->counts[0] : 1) : threads;
+
+    struct ExactTask *tasks = (struct ExactTask *) calloc(threads, sizeof(struct ExactTask));
+    bool finished = tasks != NULL;
+
+    for (int i = 0; i < threads && finished; i++)
+    {
+        tasks[i].problem = problem;
+        tasks[i].first = i;
+        tasks[i].step = threads;
+        tasks[i].deadline = deadline;
+        tasks[i].table = (struct ExactEntry *) calloc(EXACT_TABLE_SIZE, sizeof(struct ExactEntry));
+        tasks[i].order = (int *) malloc(EXACT_TABLE_SIZE * sizeof(int));
+        finished = tasks[i].table != NULL && tasks[i].order != NULL;
+    }
+
+    if (finished)
+    {
+        runShares(countRange, tasks, sizeof(struct ExactTask), threads);
+
+        for (int i = 0; i < threads; i++)
+            finished = finished && !tasks[i].failed;
+    }
+
+    for (int i = 0; i < threads && finished; i++)
+    {
+        for (int ship = 0; ship < SHIPS; ship++)
+        {
+            for (int j = 0; j < problem->counts[ship]; j++)
+            {
+                double layouts = (double) tasks[i].layouts[ship][j];
+                struct CellMask mask = problem->masks[ship][j];
+                bool sinks = maskCount(maskDifference(mask, hits)) == 1;
+
+                if (layouts == 0)
+                    continue;
+
+                result->total += ship == 0 ? layouts : 0;
+
+                for (int cell = maskLowest(mask); cell != -1; maskClear(&mask, cell), cell = maskLowest(mask))
+                {
+                    result->hit[cell] += layouts;
+                    result->sink[cell][ship] += sinks && !maskTest(hits, cell) ? layouts : 0;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < threads && tasks != NULL; i++)
+    {
+        free(tasks[i].table);
+        free(tasks[i].order);
+    }
+
+    free(tasks);
+    free(problem);
+
+    return finished;
+}
+
+/*
+    Counts the layouts for one thread's share of the first ship's placements. Runs on its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The ExactTask to run.
+*/
+void *countRange(void *argument)
+{
+    struct ExactTask *task = (struct ExactTask *) argument;
+    const struct ExactProblem *problem = task->problem;
+
+    // first pass, counts the ways to place the remaining ships for every set of cells that can be reached
+    for (int i = task->first; i < problem->counts[0] && !task->failed; i += task->step)
+    {
+        if (!maskIsSubset(problem->settled[0], problem->masks[0][i]))
+            continue;
+
+        struct CellMask next = maskIntersection(problem->masks[0][i], problem->reachable[1]);
+        task->layouts[0][i] = SHIPS == 1 ? 1 : countSubFleets(task, 1, next);
+
+        if (SHIPS > 1 && task->layouts[0][i] > 0 && !task->failed)
+            findEntry(task, 1, next)->ways++;
+    }
+
+    // second pass, hands the ways to reach every set on to the sets reached from it, one ship at a time
+    for (int ship = 1; ship < SHIPS && !task->failed; ship++)
+    {
+        for (int i = 0; i < task->used; i++)
+        {
+            struct ExactEntry *entry = &task->table[task->order[i]];
+
+            if (entry->ship != ship || entry->ways == 0 || entry->count == 0)
+                continue;
+
+            for (int j = 0; j < problem->counts[ship]; j++)
+            {
+                struct CellMask next = maskUnion(entry->occupied, problem->masks[ship][j]);
+
+                if (masksOverlap(entry->occupied, problem->masks[ship][j]) || !maskIsSubset(problem->settled[ship], next))
+                    continue;
+
+                next = maskIntersection(next, problem->reachable[ship + 1]);
+
+                struct ExactEntry *nextEntry = ship + 1 < SHIPS ? findEntry(task, ship + 1, next) : NULL;
+                unsigned long long count = nextEntry != NULL ? nextEntry->count : 1;
+
+                task->layouts[ship][j] += entry->ways * count;
+
+                if (nextEntry != NULL && count > 0)
+                    nextEntry->ways += entry->ways;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Counts the ways to place the given ship and the ones after it, remembering the count.
+
+    Parameters
+    ----------
+    `struct ExactTask *task`:
+        The task counting.
+
+    `int ship`:
+        First ship to place, at least 1.
+
+    `struct CellMask occupied`:
+        Cells that the ship or the ones after it can reach and which are occupied by the ships before it.
+
+    Returns
+    -------
+    Returns the number of ways, 0 if the task failed.
+*/
+unsigned long long countSubFleets(struct ExactTask *task, int ship, struct CellMask occupied)
+{
+    const struct ExactProblem *problem = task->problem;
+    struct ExactEntry *entry = findEntry(task, ship, occupied);
+
+    if (entry == NULL)
+    {
+        task->failed = true;
+        return 0;
+    }
+
+    if (entry->ship == ship)
+        return entry->count;
+
+    // the clock is only read every so many new sets, a set taking well under a microsecond to count
+    if ((task->used & 255) == 0 && monotonicMicroseconds() >= task->deadline)
+    {
+        task->failed = true;
+        return 0;
+    }
+
+    unsigned long long count = 0;
+
+    for (int i = 0; i < problem->counts[ship] && !task->failed; i++)
+    {
+        struct CellMask next = maskUnion(occupied, problem->masks[ship][i]);
+
+        if (masksOverlap(occupied, problem->masks[ship][i]) || !maskIsSubset(problem->settled[ship], next))
+            continue;
+
+        if (ship + 1 == SHIPS)
+            count++;
+        else
+            count += countSubFleets(task, ship + 1, maskIntersection(next, problem->reachable[ship + 1]));
+    }
+
+    if (task->failed)
+        return 0;
+
+    // the entry is claimed only now, since the calls above may have claimed the slot it was found in
+    entry = findEntry(task, ship, occupied);
+
+    if (entry == NULL)
+    {
+        task->failed = true;
+        return 0;
+    }
+
+    entry->occupied = occupied;
+    entry->count = count;
+    entry->ship = ship;
+    task->order[task->used++] = (int) (entry - task->table);
+
+    return count;
+}
+
+/*
+    Finds the entry of the given set of cells in a task's table.
+
+    Parameters
+    ----------
+    `struct ExactTask *task`:
+        The task whose table is searched.
+
+    `int ship`:
+        First of the remaining ships.
+
+    `struct CellMask occupied`:
+        The set of cells.
+
+    Returns
+    -------
+    Returns the entry if the set is remembered, else the unused entry where it should go, or NULL if the table
+    is too full to take it.
+*/
+struct ExactEntry *findEntry(struct ExactTask *task, int ship, struct CellMask occupied)
+{
+    unsigned long long hash = (occupied.bits[0] * 0x9E3779B97F4A7C15ULL) ^ (occupied.bits[1] * 0xC2B2AE3D27D4EB4FULL)
+        ^ ((unsigned long long) ship * 0x165667B19E3779F9ULL);
+
+    hash ^= hash >> 29;
+
+    for (unsigned long long i = hash & (EXACT_TABLE_SIZE - 1); ; i = (i + 1) & (EXACT_TABLE_SIZE - 1))
+    {
+        struct ExactEntry *entry = &task->table[i];
+
+        if (entry->ship == 0)
+            return task->used < EXACT_TABLE_SIZE / 4 * 3 ? entry : NULL;
+
+        if (entry->ship == ship && entry->occupied.bits[0] == occupied.bits[0] && entry->occupied.bits[1] == occupied.bits[1])
+            return entry;
+    }
+}
@@ -0,0 +1,601 @@
+/*
+
+File Name: expert.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the expert CPU, which guesses the cell that tells it the most about where the opponent's fleet is.
+
+    Every shot has one of SHIPS + 2 outcomes: a miss, a hit, or a hit that sinks one of the ships. Since the
+    outcome is fixed by the layout of the fleet, the expected reduction in the entropy over all consistent
+    layouts equals the entropy of the outcome, so the CPU guesses the cell whose outcome is the most uncertain.
+    A cell that is certain to be a hit tells the CPU nothing, but has to be guessed at some point anyway, so it
+    is guessed first.
+
+    Outcome probabilities are estimated from weighted layouts, drawn by sequential importance sampling: the
+    lowest hit cell not yet covered by a ship is covered by one of the placements that can cover it, until
+    every hit is covered, and the remaining ships are then placed on cells that were not guessed. A layout's
+    weight is the product of the number of choices made while drawing it, which makes the weighted layouts
+    stand for all consistent layouts equally. Layouts are kept between turns and only the ones the last shot
+    rules out are dropped, so most of the work of a turn carries over to the next. The weight of every cell is
+    kept up to date as layouts are added and dropped, so a guess can be given at any moment.
+
+    Once a result has dropped some of the layouts kept, the pool is refilled from the ones left before any new
+    layout is drawn: layouts are copied in proportion to their weight, which each one then shares with its
+    copies, and every copy is moved a little by shifting or turning one of its ships. A move is only made if the
+    moved layout is still consistent, and every move is undone by another move tried just as often, so the
+    copies spread out over the consistent layouts without favouring any. Copying and moving a layout is much
+    cheaper than drawing one, which keeps the cost of a guess about the same all game long, and the layouts
+    never take more memory than the fixed pool in ExpertState.
+
+    Late in a game there are few enough consistent layouts for them to be counted exactly, see exact.c. Half of
+    the time for a guess goes to trying the exact count, which is used instead of the layouts whenever it
+    finishes; otherwise layouts are drawn for the time left.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. expert.h
+    2. thread.h
+    3. timing.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. struct ExpertState *createExpert(unsigned long long seed)
+    2. void resetExpert(struct ExpertState *expert, unsigned long long seed)
+    3. void destroyExpert(struct ExpertState *expert)
+    4. void chooseShotExpert(struct ExpertState *expert, char view[BOARD_SIZE][BOARD_SIZE], long long deadline, int *row, int *col)
+    5. void observeShotExpert(struct ExpertState *expert, int row, int col, char moveStatus, char sunk)
+
+    FUNCTIONS (local)
+    -----------------
+    1. bool drawSample(struct ExpertState *expert, struct ExpertSample *sample)
+    2. void refillSamples(struct ExpertState *expert, long long deadline)
+    3. bool moveSample(struct ExpertState *expert, struct ExpertSample *sample)
+    4. void addSample(struct ExpertState *expert, struct ExpertSample *sample)
+    5. bool sampleIsConsistent(struct ExpertState *expert, struct ExpertSample *sample)
+    6. double outcomeEntropy(double total, double hit, double sink[SHIPS])
+
+*Compiled using C99 standards*
+
+*/
+
+#include <expert.h>
+#include <thread.h>
+#include <timing.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool drawSample(struct ExpertState *expert, struct ExpertSample *sample);
+void refillSamples(struct ExpertState *expert, long long deadline);
+bool moveSample(struct ExpertState *expert, struct ExpertSample *sample);
+void addSample(struct ExpertState *expert, struct ExpertSample *sample);
+bool sampleIsConsistent(struct ExpertState *expert, struct ExpertSample *sample);
+double outcomeEntropy(double total, double hit, double sink[SHIPS]);
+
+/*
+    Creates the state of an expert CPU for a new game.
+
+    Parameter
+    ---------
+    `unsigned long long seed`:
+        Seed of the CPU's random number generator.
+
+    Returns
+    -------
+    Returns the created state, or NULL if memory could not be allocated.
+*/
+struct ExpertState *createExpert(unsigned long long seed)
+{
+    struct ExpertState *expert = (struct ExpertState *) malloc(sizeof(struct ExpertState));
+
+    if (expert != NULL)
+        resetExpert(expert, seed);
+
+    return expert;
+}
+
+/*
+    Sets the state of an expert CPU back to that of a new game, so that a state allocated once can be used for
+    game after game.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        The state to set back. Its number of threads is set back to one per processor.
+
+    `unsigned long long seed`:
+        Seed of the CPU's random number generator.
+*/
+void resetExpert(struct ExpertState *expert, unsigned long long seed)
+{
+    memset(expert, 0, sizeof *expert);
+    seedRandom(&expert->random, seed);
+    expert->threads = countProcessors();
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        expert->candidateCounts[i] = getPlacements(i, &placements);
+
+        for (int j = 0; j < expert->candidateCounts[i]; j++)
+            expert->candidates[i][j] = j;
+    }
+}
+
+/*
+    Frees the given expert CPU state.
+*/
+void destroyExpert(struct ExpertState *expert)
+{
+    free(expert);
+}
+
+/*
+    Chooses the expert CPU's guess. See the top of this file for how. Unless the layouts can be counted exactly,
+    layouts are drawn until the deadline passes, and the best cell found from the layouts kept so far is
+    returned, so the guess only gets better with more time and a deadline that has already passed still gives a
+    guess.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU choosing the cell.
+
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The CPU's action board. Only cells containing ' ' may be chosen.
+
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, after which the CPU stops drawing new layouts.
+
+    `int *row`:
+        Stores the row of the chosen cell.
+
+    `int *col`:
+        Stores the column of the chosen cell.
+*/
+void chooseShotExpert(struct ExpertState *expert, char view[BOARD_SIZE][BOARD_SIZE], long long deadline, int *row, int *col)
+{
+    long long now = monotonicMicroseconds();
+
+    // the count is kept until the next result, since the guesses of a salvo are all chosen from the same one
+    if (!expert->counted && now < deadline)
+    {
+        expert->counted = countLayouts(
+            expert->misses, expert->hits, expert->sunk, expert->threads, now + ((deadline - now) / 2), &expert->exact
+        );
+    }
+
+    // too few layouts left are copied too often to spread out, so they are only added to by drawing
+    if (!expert->counted && expert->sampleCount >= EXPERT_POOL / 64 && expert->sampleCount < EXPERT_REFILL)
+        refillSamples(expert, deadline);
+
+    // a weight is one over the chance of drawing the layout, so every draw, whenever it was made, stands for
+    // all consistent layouts equally and no draw needs to be weighed against the others; the clock is read
+    // before every draw, which costs far less than the draw itself, so the deadline is overrun by one draw at most
+    while (!expert->counted && expert->sampleCount < EXPERT_POOL && monotonicMicroseconds() < deadline)
+    {
+        if (drawSample(expert, &expert->samples[expert->sampleCount]))
+            addSample(expert, &expert->samples[expert->sampleCount++]);
+    }
+
+    int best = -1;
+    double bestScore = -1, bestHit = -1, total = expert->counted ? expert->exact.total : expert->total;
+
+    for (int cell = 0; cell < CELLS; cell++)
+    {
+        if (view[cell / BOARD_SIZE][cell % BOARD_SIZE] != ' ')
+            continue;
+
+        double hit = expert->counted ? expert->exact.hit[cell] : expert->hit[cell];
+        double *sink = expert->counted ? expert->exact.sink[cell] : expert->sink[cell];
+
+        // a certain hit is scored above any entropy, which is at most log2(SHIPS + 2)
+        double score = total > 0 && hit >= total * (1 - 1e-9) ? 100 : outcomeEntropy(total, hit, sink);
+
+        if (score > bestScore || (score == bestScore && hit > bestHit))
+        {
+            best = cell;
+            bestScore = score;
+            bestHit = hit;
+        }
+    }
+
+    // without any layout every cell scores 0, so a random unguessed cell is picked instead
+    if (total == 0)
+    {
+        int count = 0;
+
+        for (int cell = 0; cell < CELLS; cell++)
+            count += view[cell / BOARD_SIZE][cell % BOARD_SIZE] == ' ';
+
+        for (int cell = 0, pick = nextRandom(&expert->random, count > 0 ? count : 1); cell < CELLS; cell++)
+        {
+            if (view[cell / BOARD_SIZE][cell % BOARD_SIZE] == ' ' && pick-- == 0)
+                best = cell;
+        }
+    }
+
+    *row = best / BOARD_SIZE;
+    *col = best % BOARD_SIZE;
+}
+
+/*
+    Lets the expert CPU learn from the result of one of its guesses: the placements and layouts that the
+    result rules out are dropped.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU which made the guess.
+
+    `int row`:
+        Row of the guessed cell.
+
+    `int col`:
+        Column of the guessed cell.
+
+    `char moveStatus`:
+        Status of the guess, either 'H' or 'M'.
+
+    `char sunk`:
+        Icon of the ship sunk by the guess, '\0' if none.
+*/
+void observeShotExpert(struct ExpertState *expert, int row, int col, char moveStatus, char sunk)
+{
+    int cell = (row * 10) + col;
+    Ships sunkShip = sunk == '\0' ? -1 : getShipFromIcon(sunk);
+
+    maskSet(moveStatus == 'H' ? &expert->hits : &expert->misses, cell);
+
+    if (sunkShip != -1)
+        expert->sunk[sunkShip] = true;
+
+    expert->counted = false;
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        int kept = 0;
+
+        getPlacements(i, &placements);
+
+        for (int j = 0; j < expert->candidateCounts[i]; j++)
+        {
+            struct CellMask mask = placements[expert->candidates[i][j]].mask;
+
+            if (!masksOverlap(mask, expert->misses) && (!expert->sunk[i] || maskIsSubset(mask, expert->hits)))
+                expert->candidates[i][kept++] = expert->candidates[i][j];
+        }
+
+        expert->candidateCounts[i] = kept;
+    }
+
+    int kept = 0;
+
+    // the weights of the layouts kept are summed again, since the new hit changes which cells each one sinks
+    expert->total = 0;
+    memset(expert->hit, 0, sizeof expert->hit);
+    memset(expert->sink, 0, sizeof expert->sink);
+
+    for (int i = 0; i < expert->sampleCount; i++)
+    {
+        if (sampleIsConsistent(expert, &expert->samples[i]))
+        {
+            expert->samples[kept] = expert->samples[i];
+            addSample(expert, &expert->samples[kept++]);
+        }
+    }
+
+    expert->sampleCount = kept;
+}
+
+/*
+    Draws a random layout consistent with everything the expert CPU has seen. See the top of this file for how.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU.
+
+    `struct ExpertSample *sample`:
+        Stores the layout drawn and its weight.
+
+    Returns
+    -------
+    Returns `true` if a layout was drawn, `false` if the choices made led to a dead end.
+*/
+bool drawSample(struct ExpertState *expert, struct ExpertSample *sample)
+{
+    const struct Placement *placements[SHIPS];
+    struct CellMask occupied = { { 0, 0 } }, uncovered = expert->hits;
+    unsigned char optionShips[SHIPS * MAX_PLACEMENTS], optionPlacements[SHIPS * MAX_PLACEMENTS];
+    bool placed[SHIPS] = { false };
+
+    for (int i = 0; i < SHIPS; i++)
+        getPlacements(i, &placements[i]);
+
+    sample->weight = 1;
+
+    // covers the lowest uncovered hit with any ship that can cover it
+    for (int cell = maskLowest(uncovered); cell != -1; cell = maskLowest(uncovered))
+    {
+        int options = 0;
+
+        for (int i = 0; i < SHIPS; i++)
+        {
+            for (int j = 0; j < expert->candidateCounts[i] && !placed[i]; j++)
+            {
+                struct CellMask mask = placements[i][expert->candidates[i][j]].mask;
+
+                // a ship lying only on hits has to be sunk, and a sunk ship has to lie only on hits
+                if (maskTest(mask, cell) && !masksOverlap(mask, occupied)
+                    && maskIsSubset(mask, expert->hits) == expert->sunk[i])
+                {
+                    optionShips[options] = i;
+                    optionPlacements[options++] = expert->candidates[i][j];
+                }
+            }
+        }
+
+        if (options == 0)
+            return false;
+
+        int option = nextRandom(&expert->random, options);
+        Ships ship = optionShips[option];
+
+        sample->placements[ship] = optionPlacements[option];
+        sample->weight *= options;
+        placed[ship] = true;
+        occupied = maskUnion(occupied, placements[ship][optionPlacements[option]].mask);
+        uncovered = maskDifference(uncovered, occupied);
+    }
+
+    // every hit is covered, so the remaining ships lie on unguessed cells only
+    struct CellMask blocked = maskUnion(occupied, expert->hits);
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        if (placed[i])
+            continue;
+
+        if (expert->sunk[i])
+            return false;
+
+        int options = 0;
+
+        for (int j = 0; j < expert->candidateCounts[i]; j++)
+        {
+            if (!masksOverlap(placements[i][expert->candidates[i][j]].mask, blocked))
+                optionPlacements[options++] = expert->candidates[i][j];
+        }
+
+        if (options == 0)
+            return false;
+
+        sample->placements[i] = optionPlacements[nextRandom(&expert->random, options)];
+        sample->weight *= options;
+        blocked = maskUnion(blocked, placements[i][sample->placements[i]].mask);
+    }
+
+    return true;
+}
+
+/*
+    Refills the expert CPU's layouts up to EXPERT_REFILL with moved copies of the layouts it already has. See
+    the top of this file for how.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU, with at least one layout.
+
+    `long long deadline`:
+        Time, as given by monotonicMicroseconds, after which no more layouts are copied.
+*/
+void refillSamples(struct ExpertState *expert, long long deadline)
+{
+    int kept = expert->sampleCount, copies[EXPERT_POOL] = { 0 };
+    double step = expert->total / (EXPERT_REFILL - kept), cumulative = 0;
+    double position = step * nextRandom(&expert->random, 1U << 30) / (1U << 30);
+
+    // picks the layouts to copy at evenly spaced points of their summed weights
+    for (int i = 0, j = 0; j < EXPERT_REFILL - kept; j++, position += step)
+    {
+        while (i < kept - 1 && cumulative + expert->samples[i].weight <= position)
+            cumulative += expert->samples[i++].weight;
+
+        copies[i]++;
+    }
+
+    for (int i = 0; i < kept && ((i & 63) != 0 || monotonicMicroseconds() < deadline); i++)
+    {
+        if (copies[i] == 0)
+            continue;
+
+        expert->samples[i].weight /= copies[i] + 1;
+
+        for (int j = 0; j < copies[i]; j++)
+        {
+            struct ExpertSample *copy = &expert->samples[expert->sampleCount++];
+            *copy = expert->samples[i];
+
+            for (int k = 0; k < EXPERT_MOVES; k++)
+                moveSample(expert, copy);
+        }
+    }
+
+    expert->total = 0;
+    memset(expert->hit, 0, sizeof expert->hit);
+    memset(expert->sink, 0, sizeof expert->sink);
+
+    for (int i = 0; i < expert->sampleCount; i++)
+        addSample(expert, &expert->samples[i]);
+}
+
+/*
+    Tries to move one ship of a layout by one cell in any direction, or to turn it about its top-left cell.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU.
+
+    `struct ExpertSample *sample`:
+        The layout to move, left as it is if the move would make it inconsistent.
+
+    Returns
+    -------
+    Returns `true` if the layout was moved, else it returns `false`.
+*/
+bool moveSample(struct ExpertState *expert, struct ExpertSample *sample)
+{
+    const struct Placement *placements[SHIPS];
+    Ships ship = nextRandom(&expert->random, SHIPS);
+
+    for (int i = 0; i < SHIPS; i++)
+        getPlacements(i, &placements[i]);
+
+    const struct Placement *placement = &placements[ship][sample->placements[ship]];
+    int row = placement->first / 10, col = placement->first % 10;
+    bool vertical = placement->vertical;
+
+    switch (nextRandom(&expert->random, 5))
+    {
+        case 0: row--; break;
+        case 1: row++; break;
+        case 2: col--; break;
+        case 3: col++; break;
+        default: vertical = !vertical; break;
+    }
+
+    int moved = findPlacement(ship, row, col, vertical), previous = sample->placements[ship];
+
+    if (moved == -1)
+        return false;
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        if (i != ship && masksOverlap(placements[ship][moved].mask, placements[i][sample->placements[i]].mask))
+            return false;
+    }
+
+    sample->placements[ship] = moved;
+
+    if (!sampleIsConsistent(expert, sample))
+    {
+        sample->placements[ship] = previous;
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Adds the weight of a layout to the expert CPU's totals of how often each cell is a hit and sinks a ship.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU.
+
+    `struct ExpertSample *sample`:
+        The layout to add.
+*/
+void addSample(struct ExpertState *expert, struct ExpertSample *sample)
+{
+    expert->total += sample->weight;
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        getPlacements(i, &placements);
+
+        struct CellMask unknown = maskDifference(placements[sample->placements[i]].mask, expert->hits);
+        bool sinks = maskCount(unknown) == 1;
+
+        for (int cell = maskLowest(unknown); cell != -1; maskClear(&unknown, cell), cell = maskLowest(unknown))
+        {
+            expert->hit[cell] += sample->weight;
+            expert->sink[cell][i] += sinks ? sample->weight : 0;
+        }
+    }
+}
+
+/*
+    Checks whether a layout is still consistent with everything the expert CPU has seen. Ships of a layout
+    never overlap, so only the guesses have to be checked.
+
+    Parameters
+    ----------
+    `struct ExpertState *expert`:
+        State of the CPU.
+
+    `struct ExpertSample *sample`:
+        The layout to check.
+
+    Returns
+    -------
+    Returns `true` if the layout is consistent, else it returns `false`.
+*/
+bool sampleIsConsistent(struct ExpertState *expert, struct ExpertSample *sample)
+{
+    struct CellMask occupied = { { 0, 0 } };
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        getPlacements(i, &placements);
+
+        struct CellMask mask = placements[sample->placements[i]].mask;
+
+        if (masksOverlap(mask, expert->misses) || maskIsSubset(mask, expert->hits) != expert->sunk[i])
+            return false;
+
+        occupied = maskUnion(occupied, mask);
+    }
+
+    return maskIsSubset(expert->hits, occupied);
+}
+
+/*
+    Returns the entropy, in bits, of the outcome of a guess.
+
+    Parameters
+    ----------
+    `double total`:
+        Total weight of the layouts.
+
+    `double hit`:
+        Weight of the layouts in which the guess hits.
+
+    `double sink[SHIPS]`:
+        Weight of the layouts in which the guess sinks each ship.
+*/
+double outcomeEntropy(double total, double hit, double sink[SHIPS])
+{
+    double outcomes[SHIPS + 2], entropy = 0;
+
+    if (total <= 0)
+        return 0;
+
+    outcomes[0] = total - hit;
+    outcomes[1] = hit;
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        outcomes[1] -= sink[i];
+        outcomes[i + 2] = sink[i];
+    }
+
+    for (int i = 0; i < SHIPS + 2; i++)
+    {
+        double probability = outcomes[i] / total;
+
+        if (probability > 1e-12)
+            entropy -= probability * log2(probability);
+    }
+
+    return entropy;
+}
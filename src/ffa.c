@@ -0,0 +1,706 @@
+/*
+
+File Name: ffa.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the free-for-all, which plays games between up to FFA_MAX_PLAYERS CPUs at once, each firing at the
+    fleets of the others until a single fleet is left afloat, and reports how every CPU placed.
+
+    The free-for-all is a simulation between CPUs only, for trying CPUs out in large lobbies. The interactive
+    game, its records and spectating are played between two players, and are left as they are.
+
+    Every player sits at a seat holding its fleet, and keeps a track of its own for every opponent it has fired
+    at, holding its action board against that opponent and the state of its CPU for it, so that each pair plays
+    out like a game of its own. Tracks are made on the first shot at an opponent, from a pool set aside for
+    every pair when the thread starts. A shot touches the shooter's track and the target's fleet alone, and
+    costs the same however many players there are.
+
+    The state of the expert CPU is far too large to keep for every pair, so every expert seat is given a single
+    one when the thread starts, which the seat lends to the track of the opponent it is firing at. When the
+    seat moves on to another opponent, the state is set back and shown the guesses of that track again, which
+    takes the expert a little longer over its first shot at the opponent. Beyond the pool and the experts'
+    states, only what the hard CPU and strategies allocate for themselves is allocated while games are played.
+
+    The players still in are kept twice: as a ring in turn order, which gives the next player to move and lets
+    go of an eliminated one at once, and as an array, from which a random opponent is drawn at once. A player
+    keeps firing at its target while a ship it has hit there is still afloat, and after a miss moves on to a
+    random opponent once in FFA_SWITCH_ODDS, or as soon as its target is eliminated. A player is eliminated once
+    its last ship is sunk, only the shot sinking a ship having to look at the rest of the fleet, and the game
+    ends when a single player is left in.
+
+    Every cell of a fleet is only lost once, so a cell already hit by another player shows as a hit to the
+    shooter but costs the fleet nothing, and a ship is announced as sunk only to the player sinking it. The
+    CPUs given take the seats in turn, starting over after the last, and the turn order is shuffled for every
+    game. Games are played classic, one shot per turn, and split evenly between the threads, with the expert
+    CPU given a share of the processors.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. ffa.h
+    2. defence.h
+    3. expert.h
+    4. thread.h
+    5. timing.h
+    6. trace.h
+
+    STRUCTS
+    -------
+    1. FFAKind
+    2. FFATrack
+    3. FFASeat
+    4. FFATally
+    5. FFATask
+
+    FUNCTIONS (global)
+    ------------------
+    bool runFreeForAll(long long games, int players, char *cpus, int threads)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *playFFAShare(void *argument)
+    2. void playFFAGame(struct FFATask *task)
+    3. void placeFFASeat(struct FFATask *task, struct FFASeat *seat)
+    4. struct FFATrack *getFFATrack(struct FFATask *task, struct FFASeat *seat, int target)
+    5. int pickFFATarget(struct FFATask *task, int alive[FFA_MAX_PLAYERS], int left, int shooter)
+    6. void eliminateFFASeat(struct FFATask *task, int alive[FFA_MAX_PLAYERS], int left, int out)
+    7. void lendFFAExpert(struct FFATask *task, struct FFASeat *seat, struct FFATrack *track)
+    8. void releaseFFATrack(struct FFATrack *track)
+    9. void printFFAResult(
+            struct FFAKind *kinds, int kindCount, int players, struct FFATally *tallies, long long games,
+            double seconds, int threads
+        )
+
+*Compiled using C99 standards*
+
+*/
+
+#include <ffa.h>
+#include <defence.h>
+#include <expert.h>
+#include <thread.h>
+#include <timing.h>
+#include <trace.h>
+#include <string.h>
+
+/*
+    FFAKind struct, contains one of the CPUs given to the free-for-all. Contains:
+    - Difficulty difficulty: difficulty of the CPU.
+    - const struct Strategy *strategy: strategy of the CPU on plugin difficulty.
+    - char *name: the CPU as it was given.
+*/
+struct FFAKind {
+    Difficulty difficulty;
+    const struct Strategy *strategy;
+    char *name;
+};
+
+/*
+    FFATrack struct, contains a player's shots at one opponent. Contains:
+    - struct Player view: the player as its CPU sees it against the opponent, only its action board and unguessed
+      cells being used.
+    - struct CPUState cpu: state of the player's CPU against the opponent.
+    - int lastShip: ship of the opponent the player last hit, -1 if it has hit none.
+    - int sunkAt[SHIPS]: cell of the shot with which the player sank each of the opponent's ships, -1 for a
+      ship it has not sunk, for an expert CPU's state to be shown the track again.
+*/
+struct FFATrack {
+    struct Player view;
+    struct CPUState cpu;
+    int lastShip;
+    int sunkAt[SHIPS];
+};
+
+/*
+    FFASeat struct, contains a player of the game being played. Contains:
+    - struct Player fleet: the player's fleet, only its board and ship HP being used.
+    - struct CellMask struck: cells of the fleet hit by anyone.
+    - int kind: the player's CPU, as an index into the CPUs given.
+    - int target: opponent the player is firing at, -1 if it has to pick one.
+    - int next: player moving after this one, while it is still in.
+    - int prev: player moving before this one, while it is still in.
+    - int slot: position of the player in the array of players still in, while it is still in.
+    - int place: place the player finished in, 1 for the winner, 0 while it is still in.
+    - int kills: number of players the player eliminated.
+    - int shots: number of shots the player fired.
+    - struct FFATrack *tracks[FFA_MAX_PLAYERS]: the player's track for every opponent, NULL until it fires at it.
+    - struct ExpertState *expert: state of the player's expert CPU, NULL if it is not the expert.
+    - struct FFATrack *lent: track the expert's state is lent to, NULL if it is lent to none.
+*/
+struct FFASeat {
+    struct Player fleet;
+    struct CellMask struck;
+    int kind;
+    int target;
+    int next;
+    int prev;
+    int slot;
+    int place;
+    int kills;
+    int shots;
+    struct FFATrack *tracks[FFA_MAX_PLAYERS];
+    struct ExpertState *expert;
+    struct FFATrack *lent;
+};
+
+/*
+    FFATally struct, contains what the games came to for one of the CPUs given. Contains:
+    - long long seats: number of seats the CPU played.
+    - long long wins: number of games the CPU won.
+    - long long places: sum of the places the CPU finished in.
+    - long long kills: number of players the CPU eliminated.
+    - long long shots: number of shots the CPU fired.
+*/
+struct FFATally {
+    long long seats;
+    long long wins;
+    long long places;
+    long long kills;
+    long long shots;
+};
+
+/*
+    FFATask struct, contains the games played by one thread. Contains:
+    - const struct FFAKind *kinds: the CPUs given.
+    - int kindCount: number of CPUs given.
+    - int players: number of players in every game.
+    - long long games: number of games to play.
+    - int threads: number of threads the expert CPU may think on.
+    - struct Random random: generator of the thread.
+    - struct FFASeat *seats: the seats of the game being played.
+    - struct FFATrack *pool: tracks for every pair of players, handed out as the game being played needs them.
+    - int poolUsed: number of tracks handed out in the game being played.
+    - struct ExpertState *experts: a state for every seat, used by the seats of the expert CPU, NULL if no
+      expert CPU plays.
+    - struct FFATally tallies[FFA_MAX_PLAYERS]: what the games came to for every CPU given.
+*/
+struct FFATask {
+    const struct FFAKind *kinds;
+    int kindCount;
+    int players;
+    long long games;
+    int threads;
+    struct Random random;
+    struct FFASeat *seats;
+    struct FFATrack *pool;
+    int poolUsed;
+    struct ExpertState *experts;
+    struct FFATally tallies[FFA_MAX_PLAYERS];
+};
+
+void *playFFAShare(void *argument);
+void playFFAGame(struct FFATask *task);
+void placeFFASeat(struct FFATask *task, struct FFASeat *seat);
+struct FFATrack *getFFATrack(struct FFATask *task, struct FFASeat *seat, int target);
+int pickFFATarget(struct FFATask *task, int alive[FFA_MAX_PLAYERS], int left, int shooter);
+void eliminateFFASeat(struct FFATask *task, int alive[FFA_MAX_PLAYERS], int left, int out);
+void lendFFAExpert(struct FFATask *task, struct FFASeat *seat, struct FFATrack *track);
+void releaseFFATrack(struct FFATrack *track);
+void printFFAResult(
+    struct FFAKind *kinds, int kindCount, int players, struct FFATally *tallies, long long games,
+    double seconds, int threads
+);
+
+/*
+    Plays free-for-all games between CPUs and prints how every CPU placed. See the top of this file for how.
+
+    Parameters
+    ----------
+    `long long games`:
+        Number of games to play.
+
+    `int players`:
+        Number of players in every game, from 2 to FFA_MAX_PLAYERS.
+
+    `char *cpus`:
+        The CPUs, each easy, hard, expert, policy or plugin:NAME, separated by commas, at most one per player.
+        The commas are overwritten.
+
+    `int threads`:
+        Number of threads to play on, at most FFA_MAX_THREADS are used.
+
+    Returns
+    -------
+    Returns `true` if the games were played, else it returns `false`.
+*/
+bool runFreeForAll(long long games, int players, char *cpus, int threads)
+{
+    struct FFAKind kinds[FFA_MAX_PLAYERS];
+    struct FFATask tasks[FFA_MAX_THREADS];
+    struct FFATally tallies[FFA_MAX_PLAYERS] = { { 0 } };
+    struct Random random;
+    int kindCount = 0;
+    bool allocated = true, experts = false;
+
+    if (players < 2 || players > FFA_MAX_PLAYERS)
+    {
+        printf("A free-for-all takes from 2 to %d players.\n", FFA_MAX_PLAYERS);
+        return false;
+    }
+
+    for (char *name = cpus; name != NULL; kindCount++)
+    {
+        char *comma = strchr(name, ',');
+
+        if (comma != NULL)
+            *comma = '\0';
+
+        if (kindCount == players)
+        {
+            printf("Give at most %d CPUs for %d players.\n", players, players);
+            return false;
+        }
+
+        if (!parseCPU(name, &kinds[kindCount].difficulty, &kinds[kindCount].strategy))
+        {
+            printf("Unknown CPU \"%s\", expected easy, hard, expert, policy or plugin:NAME.\n", name);
+            return false;
+        }
+
+        kinds[kindCount].name = name;
+        experts = experts || kinds[kindCount].difficulty == EXPERT;
+        name = comma != NULL ? comma + 1 : NULL;
+    }
+
+    initPlacements();
+    seedRandom(&random, randomSeed());
+    threads = threads < 1 ? 1 : (threads > FFA_MAX_THREADS ? FFA_MAX_THREADS : threads);
+    threads = games < threads ? (int) games : threads;
+
+    for (int i = 0; i < threads; i++)
+    {
+        tasks[i] = (struct FFATask) { .kinds = kinds, .kindCount = kindCount, .players = players };
+        tasks[i].games = (games * (i + 1)) / threads - (games * i) / threads;
+        tasks[i].threads = countProcessors() / threads > 1 ? countProcessors() / threads : 1;
+        seedRandom(&tasks[i].random, nextSeed(&random));
+        tasks[i].seats = (struct FFASeat *) malloc(players * sizeof(struct FFASeat));
+        tasks[i].pool = (struct FFATrack *) malloc(players * (players - 1) * sizeof(struct FFATrack));
+        tasks[i].experts = experts ? (struct ExpertState *) malloc(players * sizeof(struct ExpertState)) : NULL;
+        allocated = allocated && tasks[i].seats != NULL && tasks[i].pool != NULL && (!experts || tasks[i].experts != NULL);
+    }
+
+    if (!allocated)
+    {
+        printf("Could not allocate memory for the games.\n");
+
+        for (int i = 0; i < threads; i++)
+        {
+            free(tasks[i].seats);
+            free(tasks[i].pool);
+            free(tasks[i].experts);
+        }
+
+        return false;
+    }
+
+    long long start = monotonicMicroseconds();
+
+    runShares(playFFAShare, tasks, sizeof(struct FFATask), threads);
+
+    for (int i = 0; i < threads; i++)
+    {
+        for (int kind = 0; kind < kindCount; kind++)
+        {
+            tallies[kind].seats += tasks[i].tallies[kind].seats;
+            tallies[kind].wins += tasks[i].tallies[kind].wins;
+            tallies[kind].places += tasks[i].tallies[kind].places;
+            tallies[kind].kills += tasks[i].tallies[kind].kills;
+            tallies[kind].shots += tasks[i].tallies[kind].shots;
+        }
+
+        free(tasks[i].seats);
+        free(tasks[i].pool);
+        free(tasks[i].experts);
+    }
+
+    printFFAResult(kinds, kindCount, players, tallies, games, (monotonicMicroseconds() - start) / 1e6, threads);
+
+    return true;
+}
+
+/*
+    Plays one thread's share of the games. Runs on its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The FFATask to run.
+*/
+void *playFFAShare(void *argument)
+{
+    struct FFATask *task = (struct FFATask *) argument;
+
+    for (long long i = 0; i < task->games; i++)
+    {
+        playFFAGame(task);
+
+        for (int j = 0; j < task->players; j++)
+        {
+            struct FFASeat *seat = &task->seats[j];
+            struct FFATally *tally = &task->tallies[seat->kind];
+
+            tally->seats++;
+            tally->wins += seat->place == 1;
+            tally->places += seat->place;
+            tally->kills += seat->kills;
+            tally->shots += seat->shots;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Plays one game, leaving how every player did in the task's seats.
+
+    Parameter
+    ---------
+    `struct FFATask *task`:
+        The task the game is played for.
+*/
+void playFFAGame(struct FFATask *task)
+{
+    struct FFASeat *seats = task->seats;
+    int order[FFA_MAX_PLAYERS], alive[FFA_MAX_PLAYERS];
+    int players = task->players, left = players;
+
+    TRACE_BEGIN("playFFAGame");
+    task->poolUsed = 0;
+
+    for (int i = 0; i < players; i++)
+    {
+        struct FFASeat *seat = &seats[i];
+        int other = nextRandom(&task->random, i + 1);
+
+        // shuffles the turn order as it is built
+        order[i] = other == i ? i : order[other];
+        order[other] = i;
+
+        seat->kind = i % task->kindCount;
+        resetPlayer(&seat->fleet);
+        placeFFASeat(task, seat);
+        seat->struck = (struct CellMask) { { 0, 0 } };
+        seat->target = -1;
+        seat->slot = i;
+        seat->place = 0;
+        seat->kills = 0;
+        seat->shots = 0;
+        memset(seat->tracks, 0, players * sizeof(struct FFATrack *));
+        seat->expert = task->kinds[seat->kind].difficulty == EXPERT ? &task->experts[i] : NULL;
+        seat->lent = NULL;
+        alive[i] = i;
+    }
+
+    for (int i = 0; i < players; i++)
+    {
+        seats[order[i]].next = order[(i + 1) % players];
+        seats[order[i]].prev = order[(i + players - 1) % players];
+    }
+
+    int turn = order[0];
+
+    while (left > 1)
+    {
+        struct FFASeat *seat = &seats[turn];
+
+        if (seat->target == -1 || seats[seat->target].place != 0)
+            seat->target = pickFFATarget(task, alive, left, turn);
+
+        struct FFASeat *target = &seats[seat->target];
+        struct FFATrack *track = getFFATrack(task, seat, seat->target);
+        int cells[SHIPS];
+
+        if (seat->expert != NULL && seat->lent != track)
+            lendFFAExpert(task, seat, track);
+
+        char sunk = '\0';
+
+        chooseCPUSalvo(&track->cpu, &track->view, 1, cells);
+
+        int cell = cells[0];
+
+        char icon = target->fleet.board[cell / 10][cell % 10], moveStatus = icon == ' ' ? 'M' : 'H';
+
+        if (moveStatus == 'H')
+        {
+            Ships ship = getShipFromIcon(icon);
+
+            track->lastShip = ship;
+
+            // a cell hit by another player before shows as a hit, but the ship only loses it once
+            if (!maskTest(target->struck, cell))
+            {
+                maskSet(&target->struck, cell);
+                sunk = --target->fleet.shipsHP[ship] == 0 ? icon : '\0';
+
+                if (sunk != '\0')
+                    track->sunkAt[ship] = cell;
+            }
+        }
+
+        observeCPUShot(&track->cpu, &track->view, cell, moveStatus, sunk);
+        seat->shots++;
+
+        // only the shot sinking a ship can sink the last one, so the rest of the fleet is looked at only then
+        if (sunk != '\0' && checkWin(&target->fleet))
+        {
+            eliminateFFASeat(task, alive, left--, seat->target);
+            seat->kills++;
+        }
+        else if (moveStatus == 'M' && (track->lastShip == -1 || target->fleet.shipsHP[track->lastShip] == 0) &&
+                 nextRandom(&task->random, FFA_SWITCH_ODDS) == 0)
+        {
+            seat->target = -1;
+        }
+
+        turn = seat->next;
+    }
+
+    seats[turn].place = 1;
+
+    for (int i = 0; i < task->poolUsed; i++)
+        releaseFFATrack(&task->pool[i]);
+
+    TRACE_END("playFFAGame");
+}
+
+/*
+    Places the fleet of a player.
+
+    Parameters
+    ----------
+    `struct FFATask *task`:
+        The task the game is played for.
+
+    `struct FFASeat *seat`:
+        The player, whose board is empty.
+*/
+void placeFFASeat(struct FFATask *task, struct FFASeat *seat)
+{
+    unsigned char fleet[SHIPS];
+
+    if (task->kinds[seat->kind].difficulty == EXPERT)
+    {
+        placeShipsExpert(&seat->fleet, task->threads, monotonicMicroseconds() + getCPUBudget() * 1000LL);
+        return;
+    }
+
+    drawFleet(&task->random, fleet);
+    placeFleet(&seat->fleet, fleet);
+}
+
+/*
+    Gives a player's track for an opponent, making it on the first shot at the opponent.
+
+    Parameters
+    ----------
+    `struct FFATask *task`:
+        The task the game is played for.
+
+    `struct FFASeat *seat`:
+        The player.
+
+    `int target`:
+        Seat of the opponent.
+
+    Returns
+    -------
+    Returns the track.
+*/
+struct FFATrack *getFFATrack(struct FFATask *task, struct FFASeat *seat, int target)
+{
+    if (seat->tracks[target] != NULL)
+        return seat->tracks[target];
+
+    // every pair is given a track at most once a game, which the pool has room for
+    struct FFATrack *track = &task->pool[task->poolUsed++];
+    const struct FFAKind *kind = &task->kinds[seat->kind];
+
+    resetPlayer(&track->view);
+    initCPUState(&track->cpu, 0, kind->difficulty, nextSeed(&task->random));
+    track->cpu.strategy = kind->strategy;
+    track->lastShip = -1;
+
+    for (int i = 0; i < SHIPS; i++)
+        track->sunkAt[i] = -1;
+
+    seat->tracks[target] = track;
+
+    return track;
+}
+
+/*
+    Draws an opponent for a player at random from the players still in.
+
+    Parameters
+    ----------
+    `struct FFATask *task`:
+        The task the game is played for.
+
+    `int alive[FFA_MAX_PLAYERS]`:
+        Seats of the players still in.
+
+    `int left`:
+        Number of players still in, at least 2.
+
+    `int shooter`:
+        Seat of the player, which is still in.
+
+    Returns
+    -------
+    Returns the seat of the opponent.
+*/
+int pickFFATarget(struct FFATask *task, int alive[FFA_MAX_PLAYERS], int left, int shooter)
+{
+    // one of the first left - 1 players is drawn, the last standing in for the shooter if it is drawn
+    int pick = alive[nextRandom(&task->random, left - 1)];
+
+    return pick == shooter ? alive[left - 1] : pick;
+}
+
+/*
+    Takes a player whose last ship was sunk out of the game.
+
+    Parameters
+    ----------
+    `struct FFATask *task`:
+        The task the game is played for.
+
+    `int alive[FFA_MAX_PLAYERS]`:
+        Seats of the players still in.
+
+    `int left`:
+        Number of players still in, counting the player, which becomes the place it finishes in.
+
+    `int out`:
+        Seat of the player.
+*/
+void eliminateFFASeat(struct FFATask *task, int alive[FFA_MAX_PLAYERS], int left, int out)
+{
+    struct FFASeat *seats = task->seats, *seat = &seats[out];
+
+    seat->place = left;
+    seats[seat->prev].next = seat->next;
+    seats[seat->next].prev = seat->prev;
+    alive[seat->slot] = alive[left - 1];
+    seats[alive[left - 1]].slot = seat->slot;
+
+    // nobody fires at the player again, so what every CPU kept for it is freed, the expert's state being large
+    for (int i = 0; i < task->players; i++)
+    {
+        if (seats[i].tracks[out] != NULL)
+            releaseFFATrack(seats[i].tracks[out]);
+    }
+}
+
+/*
+    Lends a seat's expert state to the track of the opponent it is about to fire at, setting the state back and
+    showing it the track's guesses, so that it picks up where the seat left off against the opponent.
+
+    Parameters
+    ----------
+    `struct FFATask *task`:
+        The task the game is played for.
+
+    `struct FFASeat *seat`:
+        The seat, of the expert CPU.
+
+    `struct FFATrack *track`:
+        The seat's track for the opponent.
+*/
+void lendFFAExpert(struct FFATask *task, struct FFASeat *seat, struct FFATrack *track)
+{
+    struct ExpertState *expert = seat->expert;
+
+    if (seat->lent != NULL)
+        seat->lent->cpu.expert = NULL;
+
+    resetExpert(expert, nextSeed(&task->random));
+    expert->threads = task->threads;
+
+    for (int cell = 0; cell < CELLS; cell++)
+    {
+        char guess = track->view.actionBoard[cell / BOARD_SIZE][cell % BOARD_SIZE];
+
+        if (guess != ' ')
+            observeShotExpert(expert, cell / BOARD_SIZE, cell % BOARD_SIZE, guess == 'X' ? 'H' : 'M', '\0');
+    }
+
+    // every ship the seat sank is seen again through the shot that sank it
+    for (int ship = 0; ship < SHIPS; ship++)
+    {
+        if (track->sunkAt[ship] != -1)
+            observeShotExpert(expert, track->sunkAt[ship] / BOARD_SIZE, track->sunkAt[ship] % BOARD_SIZE, 'H', getShipIcon(ship));
+    }
+
+    track->cpu.expert = expert;
+    seat->lent = track;
+}
+
+/*
+    Frees what the CPU of a track allocated for itself, leaving an expert state lent to it to its seat.
+
+    Parameter
+    ---------
+    `struct FFATrack *track`:
+        The track.
+*/
+void releaseFFATrack(struct FFATrack *track)
+{
+    track->cpu.expert = NULL;
+    resetCPUVariables(&track->cpu);
+}
+
+/*
+    Prints how every CPU did over the games.
+
+    Parameters
+    ----------
+    `struct FFAKind *kinds`:
+        The CPUs given.
+
+    `int kindCount`:
+        Number of CPUs given.
+
+    `int players`:
+        Number of players in every game.
+
+    `struct FFATally *tallies`:
+        What the games came to for every CPU given.
+
+    `long long games`:
+        Number of games played.
+
+    `double seconds`:
+        Time the games took.
+
+    `int threads`:
+        Number of threads the games were played on.
+*/
+void printFFAResult(
+    struct FFAKind *kinds, int kindCount, int players, struct FFATally *tallies, long long games,
+    double seconds, int threads
+)
+{
+    long long shots = 0;
+
+    for (int kind = 0; kind < kindCount; kind++)
+        shots += tallies[kind].shots;
+
+    printf("%lld games of %d players played in %.2f s (%.1f games/s, %.0f shots/s) on %d thread%s.\n", games, players,
+           seconds, seconds > 0 ? games / seconds : 0.0, seconds > 0 ? shots / seconds : 0.0, threads, threads == 1 ? "" : "s");
+
+    for (int kind = 0; kind < kindCount; kind++)
+    {
+        struct FFATally *tally = &tallies[kind];
+
+        if (tally->seats == 0)
+            continue;
+
+        // a seat wins one game in players by chance, so the CPU's share of the wins is set against its share of the seats
+        printf("%s: won %.1f%% of its seats (%.1f%% by chance), finished %.1f of %d on average, eliminated %.2f and fired %.1f shots per seat.\n",
+               kinds[kind].name, 100.0 * tally->wins / tally->seats, 100.0 / players, (double) tally->places / tally->seats,
+               players, (double) tally->kills / tally->seats, (double) tally->shots / tally->seats);
+    }
+}
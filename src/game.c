@@ -7,51 +7,118 @@ ________________________________________________________________________________
 
     Contains functions for game operations.
 
+    A game is driven one step at a time by `gameStep`, which takes a single line of input, advances the game's
+    state and returns the text to show, without ever waiting on input itself. `start` is the interactive driver
+    which feeds it lines from stdin, but any number of games can be advanced from a single thread in the same way.
+
     INCLUDES (user-defined)
     -----------------------
-    game.h
+    1. game.h
+    2. game_event.h
+    3. trace.h
+    4. hint.h
 
     GLOBAL VARIABLES
     ----------------
-    1. char _opponentMove
-    2. bool _cpuPlayer
-    3. short _playerTurn
+    1. bool _cpuPlayer
+    2. char *_recordPath
+    3. struct SpectatorServer *_spectatorServer
+    4. bool _hintsSubscribed
 
     FUNCTIONS (Global)
     ------------------
     1. void setCPUPlayer(bool isCPUPlayer)
-    2. bool start(int playerTurn, Difficulty difficulty)
-    3. void convertToIndex(char *position, int *row, int *col)
+    2. void setRecordPath(char *path)
+    3. void setSpectatorServer(struct SpectatorServer *server)
+    4. bool start(int playerTurn, Difficulty difficulty, GameMode mode)
+    5. bool resumeGame(bool *playAgain)
+    6. void initGame(
+            struct Game *game, char *playerOneName, char *playerTwoName, 
+            bool cpuPlayer, int cpuTurn, Difficulty difficulty, GameMode mode
+        )
+    7. void gameStep(struct Game *game, char *input, struct GameOutput *output)
+    8. void freeGame(struct Game *game)
+    9. void convertToIndex(char *position, int *row, int *col)
+    10. bool validatePosition(char *position)
 
     FUNCTIONS (Local)
     -----------------
-    1. void takePosition(char *positionArr, char *positionPrompt)
-    2. bool validatePosition(char *position)
-    3. void placeShips(void)
-    4. bool play(Difficulty difficulty)
-    5. bool playTurn(void)
-    6. void resetVariables(void)
+    1. void appendOutput(struct GameOutput *output, char *format, ...)
+    2. void appendBoard(struct GameOutput *output, char board[BOARD_SIZE][BOARD_SIZE])
+    3. void showPhase(struct Game *game, struct GameOutput *output)
+    4. void showTurnMenu(struct Game *game, struct GameOutput *output, bool showBoard, bool showHint)
+    5. void stepChooseShip(struct Game *game, char *input, struct GameOutput *output)
+    6. void stepPlacePosition(struct Game *game, char *input, struct GameOutput *output)
+    7. void stepPlaceDone(struct Game *game, struct GameOutput *output)
+    8. void stepTurnMenu(struct Game *game, char *input, struct GameOutput *output)
+    9. void stepGuess(struct Game *game, char *input, struct GameOutput *output)
+    10. void stepSalvo(struct Game *game, char *input, struct GameOutput *output)
+    11. void stepPlayAgain(struct Game *game, char *input, struct GameOutput *output)
+    12. void beginPlacement(struct Game *game, short playerTurn)
+    13. void beginTurn(struct Game *game, short playerTurn, struct GameOutput *output)
+    14. void endGame(struct Game *game, char *winnerName, struct GameOutput *output)
+    15. void showGuessPrompt(struct Game *game, struct GameOutput *output)
+    16. int countSalvoShots(struct Player *player)
+    17. void resetVariables(void)
+    18. bool playGame(struct Game *game)
+    19. bool finishSalvo(struct Game *game, int shooter, struct GameOutput *output)
+    20. void recordGameEvent(struct GameEvent *event)
+    21. void spectateGameEvent(struct GameEvent *event)
+    22. void hintGameEvent(struct GameEvent *event)
+    23. void refreshHint(struct Game *game, int player)
+    24. void appendHint(struct Game *game, struct GameOutput *output)
 
 *Compiled using C99 standards*
 
 */
 
 #include <game.h>
+#include <game_event.h>
+#include <trace.h>
+#include <hint.h>
+#include <record.h>
+#include <snapshot.h>
+#include <spectate.h>
+#include <defence.h>
+#include <thread.h>
+#include <timing.h>
 #include <ctype.h>
+#include <stdarg.h>
+#include <string.h>
 
-// stores the status of the most recent move made by a player
-char _opponentMove = '\0';
-// stores whether or not there is a CPU player
+// stores whether or not there is a CPU player in the next game started from the menu
 bool _cpuPlayer = false;
-// stores the player turn value, it is 0 initially, else it is either 1 or 2
-short _playerTurn = 0;
-
-void takePosition(char *positionArr, char *positionPrompt);
-bool validatePosition(char *position);
-void placeShips(void);
-bool play(Difficulty difficulty);
-bool playTurn(void);
+// stores the file to which finished games are appended, NULL if games are not recorded
+char *_recordPath = NULL;
+// stores the server games played from the menu are watched on, NULL if they are not watched
+struct SpectatorServer *_spectatorServer = NULL;
+// stores whether the hints of the players have been subscribed to the game's events
+bool _hintsSubscribed = false;
+
+void appendOutput(struct GameOutput *output, char *format, ...);
+void appendBoard(struct GameOutput *output, char board[BOARD_SIZE][BOARD_SIZE]);
+void showPhase(struct Game *game, struct GameOutput *output);
+void showTurnMenu(struct Game *game, struct GameOutput *output, bool showBoard, bool showHint);
+void stepChooseShip(struct Game *game, char *input, struct GameOutput *output);
+void stepPlacePosition(struct Game *game, char *input, struct GameOutput *output);
+void stepPlaceDone(struct Game *game, struct GameOutput *output);
+void stepTurnMenu(struct Game *game, char *input, struct GameOutput *output);
+void stepGuess(struct Game *game, char *input, struct GameOutput *output);
+void stepSalvo(struct Game *game, char *input, struct GameOutput *output);
+void stepPlayAgain(struct Game *game, char *input, struct GameOutput *output);
+void beginPlacement(struct Game *game, short playerTurn);
+void beginTurn(struct Game *game, short playerTurn, struct GameOutput *output);
+void endGame(struct Game *game, char *winnerName, struct GameOutput *output);
+void showGuessPrompt(struct Game *game, struct GameOutput *output);
+int countSalvoShots(struct Player *player);
 void resetVariables(void);
+bool playGame(struct Game *game);
+bool finishSalvo(struct Game *game, int shooter, struct GameOutput *output);
+void recordGameEvent(struct GameEvent *event);
+void spectateGameEvent(struct GameEvent *event);
+void hintGameEvent(struct GameEvent *event);
+void refreshHint(struct Game *game, int player);
+void appendHint(struct Game *game, struct GameOutput *output);
 
 /*
     Sets the CPU player.
@@ -62,8 +129,42 @@ void setCPUPlayer()
 }
 
 /*
-    This functions starts the actual game of battleship. The function contains code that allows players to 
-    place all their ships.
+    Makes every game played from the menu get appended to the given file once it is over, so that it can be 
+    replayed later.
+
+    Parameter
+    ---------
+    `char *path`:
+        The file to record games into.
+*/
+void setRecordPath(char *path)
+{
+    // the record is kept by an observer of the game's events, subscribed once
+    if (_recordPath == NULL && path != NULL)
+        subscribeGameEvents(recordGameEvent, EVENT_BIT(EVENT_GAME_STARTED) | EVENT_BIT(EVENT_SALVO_RESOLVED) | EVENT_BIT(EVENT_GAME_OVER));
+
+    _recordPath = path;
+}
+
+/*
+    Makes every game played from the menu watchable on the given server.
+
+    Parameter
+    ---------
+    `struct SpectatorServer *server`:
+        The server to publish games to.
+*/
+void setSpectatorServer(struct SpectatorServer *server)
+{
+    // games are published by an observer of their events, subscribed once
+    if (_spectatorServer == NULL && server != NULL)
+        subscribeGameEvents(spectateGameEvent, EVENT_BIT(EVENT_GAME_STARTED) | EVENT_BIT(EVENT_SALVO_RESOLVED));
+
+    _spectatorServer = server;
+}
+
+/*
+    This functions starts the actual game of battleship on the terminal, which is then played by `playGame`.
 
     Parameters
     ----------
@@ -72,483 +173,866 @@ void setCPUPlayer()
     
     `Difficulty difficulty`:
         Stores the difficulty of the CPU is there is a CPU player.
+    
+    `GameMode mode`:
+        The rules with which the game is played.
 
     Returns
     -------
     Returns `true` if after finishing the current game, player(s) want to keep playing, else it returns `false`.
 */
-bool start(int playerTurn, Difficulty difficulty)
+bool start(int playerTurn, Difficulty difficulty, GameMode mode)
 {
-    if (_cpuPlayer)
+    struct Game game;
+
+    initGame(&game, players[0].name, players[1].name, _cpuPlayer, playerTurn % 2, difficulty, mode);
+
+    if (_recordPath != NULL)
     {
-        cpuPlaceShips(); // CPU places ships
+        game.record = (struct GameRecord *) calloc(1, sizeof(struct GameRecord));
+
+        // the record is only begun once the game starts, so a game left during placement has no winner to append
+        if (game.record != NULL)
+            game.record->winner = -1;
+        else
+            printf("Could not allocate memory to record the game, it will not be recorded.\n");
+    }
+
+    return playGame(&game);
+}
+
+/*
+    Resumes the game saved the last time a game was left before it was over, and plays it the same way `start` 
+    plays a new game. A resumed game is not recorded.
+
+    Parameter
+    ---------
+    `bool *playAgain`:
+        Stores `true` if after finishing the game, player(s) want to keep playing, else `false`.
+
+    Returns
+    -------
+    Returns `true` if a saved game was resumed, `false` if there is none.
+*/
+bool resumeGame(bool *playAgain)
+{
+    struct Game game;
+
+    if (!loadSnapshot(SNAPSHOT_PATH, &game))
+        return false;
+
+    clearScreen();
+    *playAgain = playGame(&game);
+
+    return true;
+}
 
-        // player turn
-        _playerTurn = playerTurn;
-        placeShips();
-        displayBoard(players[_playerTurn - 1].board);
+/*
+    Sets up a new game. If there is a CPU player, the CPU's ships are placed right away.
 
-        printf("All ships placed! Press ENTER to continue...");
-        clearInputBuffer();
-        clearScreen();
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game to set up.
+    
+    `char *playerOneName`:
+        Name of player 1.
+    
+    `char *playerTwoName`:
+        Name of player 2.
+    
+    `bool cpuPlayer`:
+        Whether or not one of the players is a CPU.
+    
+    `int cpuTurn`:
+        CPU's turn, either 0 or 1. Ignored if there is no CPU player.
+    
+    `Difficulty difficulty`:
+        Stores the difficulty of the CPU is there is a CPU player.
+    
+    `GameMode mode`:
+        The rules with which the game is played.
+*/
+void initGame(
+    struct Game *game, char *playerOneName, char *playerTwoName, 
+    bool cpuPlayer, int cpuTurn, Difficulty difficulty, GameMode mode
+)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        resetPlayer(&game->players[i]);
+        strncpy(game->players[i].name, i == 0 ? playerOneName : playerTwoName, MAX_SIZE - 1);
+        game->players[i].name[MAX_SIZE - 1] = '\0';
+    }
+
+    initCPUState(&game->cpu, cpuTurn, difficulty, randomSeed());
+    game->cpuPlayer = cpuPlayer;
+    game->mode = mode;
+    game->lastSalvo.shots = 0;
+    game->playAgain = false;
+    game->record = NULL;
+    game->spectators = NULL;
+    game->hints[0] = game->hints[1] = NULL;
+
+    if (cpuPlayer)
+    {
+        // CPU places ships, the expert taking as long as it may for a move to find a layout that is hard to sink
+        if (difficulty == EXPERT)
+            placeShipsExpert(&game->players[cpuTurn], countProcessors(), monotonicMicroseconds() + game->cpu.budget * 1000LL);
+        else
+            cpuPlaceShips(&game->players[cpuTurn]);
+        beginPlacement(game, cpuTurn == 0 ? 2 : 1);
     }
     else
     {
-        for (int i = 1; i <= 2; i++)
-        {
-            _playerTurn = i;
-            placeShips();
-            displayBoard(players[i - 1].board);
+        beginPlacement(game, 1);
+    }
+}
+
+/*
+    Advances the given game by one step.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game to advance.
+    
+    `char *input`:
+        A single line of input, without the trailing newline, for the phase the game is in. If `NULL`, the 
+        game is not advanced and the output for its current phase is produced again.
+    
+    `struct GameOutput *output`:
+        Stores the text produced by the step.
+*/
+void gameStep(struct Game *game, char *input, struct GameOutput *output)
+{
+    output->text[0] = '\0';
+    output->length = 0;
+    output->clearScreen = false;
+    output->finished = false;
 
-            if (i == 1)
-                printf("\nAll ships placed! Give computer to player 2 so they can place their ships!\n");
+    if (input == NULL)
+    {
+        showPhase(game, output);
+        return;
+    }
+
+    switch (game->phase)
+    {
+        case PLACE_CHOOSE_SHIP:
+            stepChooseShip(game, input, output);
+            break;
+
+        case PLACE_START:
+        case PLACE_END:
+            stepPlacePosition(game, input, output);
+            break;
+        
+        case PLACE_DONE:
+            stepPlaceDone(game, output);
+            break;
+
+        case TURN_MENU:
+            stepTurnMenu(game, input, output);
+            break;
+
+        case GUESS:
+            if (game->mode == SALVO)
+                stepSalvo(game, input, output);
             else
-                printf("\nAll ships placed! Give computer back to player 1 so the game can begin!\n");
+                stepGuess(game, input, output);
+            break;
 
-            printf("Press ENTER to continue...");
-            clearInputBuffer();
+        case GUESS_DONE:
+            beginTurn(game, game->playerTurn == 1 ? 2 : 1, output); // next player's turn
+            break;
 
-            clearScreen();
-        }
+        case PLAY_AGAIN:
+            stepPlayAgain(game, input, output);
+            break;
 
-        _playerTurn = 1;
+        case GAME_OVER:
+            break;
     }
 
-    return play(difficulty);
+    output->finished = game->phase == GAME_OVER;
 }
 
 /*
-    This function contains code to actually play the game.
+    Frees the memory held by the given game.
 
     Parameter
     ---------
-    `Difficulty difficulty`:
-        Stores the difficulty of the CPU is there is a CPU player.
+    `struct Game *game`:
+        The game to free.
+*/
+void freeGame(struct Game *game)
+{
+    resetCPUVariables(&game->cpu);
 
-    Returns
-    -------
-    Returns `true` if player(s) want to keep playing after finishing the game, else it returns `false`.
+    for (int i = 0; i < 2; i++)
+    {
+        stopHint(game->hints[i]);
+        game->hints[i] = NULL;
+    }
+}
+
+/*
+    Appends formatted text to the given output, the same way printf prints it. Text that does not fit in the
+    output is dropped.
+
+    Parameters
+    ----------
+    `struct GameOutput *output`:
+        The output to append to.
+    
+    `char *format`:
+        printf style format string.
+*/
+void appendOutput(struct GameOutput *output, char *format, ...)
+{
+    if (output->length >= OUTPUT_SIZE - 1)
+        return;
+
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(output->text + output->length, OUTPUT_SIZE - output->length, format, args);
+    va_end(args);
+
+    if (written > 0)
+        output->length = output->length + written < OUTPUT_SIZE ? output->length + written : OUTPUT_SIZE - 1;
+}
+
+/*
+    Appends the given board to the given output, in the same format that `displayBoard` prints it in.
+
+    Parameters
+    ----------
+    `struct GameOutput *output`:
+        The output to append to.
+    
+    `char board[BOARD_SIZE][BOARD_SIZE]`:
+        The board to append.
+*/
+void appendBoard(struct GameOutput *output, char board[BOARD_SIZE][BOARD_SIZE])
+{
+    output->length += formatBoard(board, output->text + output->length, OUTPUT_SIZE - output->length);
+}
+
+/*
+    Produces the output for the phase the given game is currently in.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game whose phase is to be shown.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
 */
-bool play(Difficulty difficulty)
+void showPhase(struct Game *game, struct GameOutput *output)
 {
-    _playerTurn = 1;
-    bool showBoard = false, playUserTurn = false;
+    struct Player *player = &game->players[game->playerTurn - 1];
 
-    while (1) // this loop will never be broken instead, control will be returned only after one of the players win.
+    switch (game->phase)
     {
-        if (_cpuPlayer && (getCPUTurn() + 1) == _playerTurn) // if it is CPU's turn
-        {
-            if (playCPUTurn(&_opponentMove, difficulty)) // if CPU wins
-            {
-                clearScreen();
+        case PLACE_CHOOSE_SHIP:
+            output->clearScreen = true;
+            appendOutput(output, "For %s:\n", player->name);
+            appendBoard(output, player->board);
+            appendOutput(output, "\nShips available:\n");
 
-                for (int i = 0; i < 2; i++)
-                {
-                    printf("%s's board:\n", players[i].name);
-                    displayBoard(players[i].board);
-                    printf("%s's action board:\n", players[i].name);
-                    displayBoard(players[i].actionBoard);
-                    printf("\n\n");
-                }
-                
-                printf("CPU Wins!\n");
-                resetVariables();
-                resetCPUVariables();
-
-                char playAgain;
-            
-                while (1) // loop breaks after valid input ('Y' / 'N')
+            for (int i = 0; i < SHIPS; i++)
+            {
+                if (game->shipsAvailable[i]) // prints all available ships
                 {
-                    while (!checkInputValidity(
-                        takeNInputWithPropmt("Play again? (Y/N): ", &playAgain, CHAR, 1),
-                        NULL, "Please enter only 'Y' or 'N'.", NULL, NULL ));
-                    
-                    playAgain = tolower(playAgain);
-
-                    if (playAgain != 'y' && playAgain != 'n')
-                        printf("Please enter only 'Y' or 'N'.\n");
-                    else
-                        return playAgain == 'y';
+                    appendOutput(output, "(%c)%s (%d spaces)\n", getShipIcon(i), getShipName(i) + 1, 
+                        player->shipsHP[i]);
                 }
             }
+
+            appendOutput(output, "Which piece do you want to place? (Type in the first letter of the piece): ");
+            break;
+        
+        case PLACE_START:
+            appendOutput(output, "Enter starting position (ex: A5): ");
+            break;
+        
+        case PLACE_END:
+            appendOutput(output, "Enter ending position (ex: A5): ");
+            break;
+
+        case PLACE_DONE:
+            output->clearScreen = true;
+            appendBoard(output, player->board);
+
+            if (game->cpuPlayer)
+                appendOutput(output, "All ships placed! ");
+            else if (game->playerTurn == 1)
+                appendOutput(output, "\nAll ships placed! Give computer to player 2 so they can place their ships!\n");
             else
+                appendOutput(output, "\nAll ships placed! Give computer back to player 1 so the game can begin!\n");
+
+            appendOutput(output, "Press ENTER to continue...");
+            break;
+        
+        case TURN_MENU:
+            showTurnMenu(game, output, false, false);
+            break;
+        
+        case GUESS:
+            output->clearScreen = true;
+            appendOutput(output, "Player %d's turn (%s):\n", game->playerTurn, player->name);
+            appendBoard(output, player->actionBoard);
+            appendOutput(output, "\n");
+            showGuessPrompt(game, output);
+            break;
+        
+        case GUESS_DONE:
+            output->clearScreen = true;
+            appendOutput(output, "Player %d's turn (%s):\n", game->playerTurn, player->name);
+            appendBoard(output, player->actionBoard);
+
+            if (game->mode == SALVO)
             {
-                _playerTurn = _playerTurn == 1 ? _playerTurn + 1 : _playerTurn - 1; // next player's turn
-                continue;
+                appendOutput(output, "\n%d HIT(S), %d MISS(ES)!\n", game->lastSalvo.hits, 
+                    game->lastSalvo.shots - game->lastSalvo.hits);
+            }
+            else
+            {
+                appendOutput(output, game->lastSalvo.statuses[0] == 'H' ? "\nHIT!\n" : "\nMISS!\n");
             }
-        }
-
-        printf("Player %d's turn (%s):\n", _playerTurn, players[_playerTurn - 1].name);
 
-        if (showBoard)
-        {
-            char mergedBoard[BOARD_SIZE][BOARD_SIZE];
-            mergeBoards(players[_playerTurn - 1].board, players[_playerTurn % 2].actionBoard, mergedBoard);
-            displayBoard(mergedBoard);
-            showBoard = false;
-        }
-        else if (playUserTurn)
-        {
-            if (playTurn()) // if one of the players win
+            for (int i = 0; i < game->lastSalvo.shots; i++)
             {
-                clearScreen();
+                if (game->lastSalvo.sunkShips[i] != '\0')
+                    appendOutput(output, "You sunk their %s!\n", getShipName(getShipFromIcon(game->lastSalvo.sunkShips[i])));
+            }
 
-                for (int i = 0; i < 2; i++)
-                {
-                    printf("%s's board:\n", players[i].name);
-                    displayBoard(players[i].board);
-                    printf("%s's action board:\n", players[i].name);
-                    displayBoard(players[i].actionBoard);
-                    printf("\n\n");
-                }
+            appendOutput(output, "Press ENTER to let player %d play...", game->playerTurn == 1 ? 2 : 1);
+            break;
 
-                printf("%s wins!\n", players[_playerTurn - 1].name);
-                resetVariables();
-                
-                char playAgain;
-                
-                while (1) // loop breaks after valid input ('Y' / 'N')
-                {
-                    while (!checkInputValidity(
-                        takeNInputWithPropmt("Play again? (Y/N): ", &playAgain, CHAR, 1),
-                        NULL, "Please enter only 'Y' or 'N'.", NULL, NULL ));
-                    
-                    playAgain = tolower(playAgain);
-
-                    if (playAgain != 'y' && playAgain != 'n')
-                        printf("Please enter only 'Y' or 'N'.\n");
-                    else
-                        return playAgain == 'y';
-                }
-            }
+        case PLAY_AGAIN:
+            appendOutput(output, "Play again? (Y/N): ");
+            break;
 
-            playUserTurn = false;
-            _playerTurn = _playerTurn == 1 ? _playerTurn + 1 : _playerTurn - 1; // next player's turn
-            clearScreen();
-            continue;
-        }
+        case GAME_OVER:
+            break;
+    }
+}
+
+/*
+    Produces the menu shown at the start of a player's turn.
 
-        printf("\nOpponent's last move: ");
-        printf(_opponentMove != '\0' ? (_opponentMove == 'H' ? "HIT!" : "MISS!") : "Not played");
-        printf("\nOpponent ships left: ");
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game whose turn menu is to be shown.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+    
+    `bool showBoard`:
+        Whether to show the player's own board, along with the hits made on it, above the menu.
 
-        for (int i = 0; i < SHIPS; i++)
-        {
-            if (players[_playerTurn % 2].shipsHP[i] != 0)
-            {
-                switch (i)
-                {
-                    case CARRIER:
-                        printf("Carrier ");
-                        break;
-                    case BATTLESHIP:
-                        printf("Battleship ");
-                        break;
-                    case DESTROYER:
-                        printf("Destroyer ");
-                        break;
-                    case SUBMARINE:
-                        printf("Submarine ");
-                        break;
-                    case PATROL:
-                        printf("Patrol ");
-                        break;
-                }
-            }
-        }
+    `bool showHint`:
+        Whether to show the player's action board shaded by the odds of every cell holding a ship, above the
+        menu.
+*/
+void showTurnMenu(struct Game *game, struct GameOutput *output, bool showBoard, bool showHint)
+{
+    struct Player *player = &game->players[game->playerTurn - 1];
+    struct Player *opponent = &game->players[game->playerTurn % 2];
 
-        printf("\n");
-        printf("\n1. Play Turn\n2. Show my board's status\n");
+    output->clearScreen = true;
+    appendOutput(output, "Player %d's turn (%s):\n", game->playerTurn, player->name);
 
-        while (1) // breaks after valid input (1 / 2)
-        {
-            short choice = 0;
-            printf("Enter choice: ");
+    if (showBoard)
+    {
+        char mergedBoard[BOARD_SIZE][BOARD_SIZE];
+        mergeBoards(player->board, opponent->actionBoard, mergedBoard);
+        appendBoard(output, mergedBoard);
+    }
 
-            checkInputValidity(
-                takeNInput(&choice, SHORT, 1), 
-                NULL, "Please enter only one digit.",
-                "Please enter only a number.", NULL
-            );
+    if (showHint)
+        appendHint(game, output);
 
-            switch (choice)
-            {
-                case 1:
-                    playUserTurn = true;
-                    break;
-                
-                case 2:
-                    showBoard = true;
-                    break;
-
-                default:
-                    printf("Enter only 1 or 2.\n\n");
-                    break;
-            }
+    appendOutput(output, "\nOpponent's last move: ");
 
-            if (playUserTurn || showBoard) // breaking infinite loop after valid input
-                break;
-        }
+    if (game->lastSalvo.shots == 0)
+        appendOutput(output, "Not played");
+    else if (game->mode == SALVO)
+        appendOutput(output, "%d hit(s) out of %d shot(s)", game->lastSalvo.hits, game->lastSalvo.shots);
+    else
+        appendOutput(output, game->lastSalvo.statuses[0] == 'H' ? "HIT!" : "MISS!");
+    appendOutput(output, "\nOpponent ships left: ");
 
-        clearScreen();
+    for (int i = 0; i < SHIPS; i++)
+    {
+        if (opponent->shipsHP[i] != 0)
+            appendOutput(output, "%s ", getShipName(i));
     }
+
+    appendOutput(output, "\n");
+    appendOutput(output, "\n1. Play Turn\n2. Show my board's status\n3. Show hint\n");
+    appendOutput(output, "Enter choice: ");
 }
 
 /*
-    This function allows player to make a guess at where the opponent's ship is located.
+    Handles the player's choice of which ship to place.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
     
-    Returns
-    -------
-    Returns `true` if the move makes player win, else returns `false`.
+    `char *input`:
+        The player's choice.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
 */
-bool playTurn()
+void stepChooseShip(struct Game *game, char *input, struct GameOutput *output)
 {
-    int playerTurn = _playerTurn - 1; // converting to index friendly number
-    char position[4];
-    int row, col;
+    Ships ship = getShipFromIcon(toupper(*input));
+
+    if (ship == -1)
+    {
+        appendOutput(output, "Please only enter a choice from the above given list.\n");
+    }
+    else if (!game->shipsAvailable[ship])
+    {
+        appendOutput(output, "Ship already placed!\n");
+    }
+    else
+    {
+        game->shipsAvailable[ship] = false; // making selected ship unavailable
+        game->chosenShip = ship;
+        game->phase = PLACE_START;
+        showPhase(game, output);
+        return;
+    }
+
+    appendOutput(output, "Which piece do you want to place? (Type in the first letter of the piece): ");
+}
+
+/*
+    Handles the starting and ending positions given for the ship being placed. Once both positions are given,
+    the ship is placed if it fits, else the player is asked for both positions again.
 
-    displayBoard(players[playerTurn].actionBoard);
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
     
-    while (1)
+    `char *input`:
+        The position given by the player.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void stepPlacePosition(struct Game *game, char *input, struct GameOutput *output)
+{
+    if (strlen(input) > 3 || !validatePosition(input))
     {
-        printf("\nEnter your guess: ");
-        takePosition(position, "");
-        convertToIndex(position, &row, &col);
+        appendOutput(output, "Incorrect input format. Please give input in the following range: [A-J][1-10].\n");
+        showPhase(game, output);
+        return;
+    }
 
-        // checking if player already guessed at this location
-        if (players[playerTurn].actionBoard[row][col] != ' ')
+    if (game->phase == PLACE_START)
+    {
+        strcpy(game->startPosition, input);
+        game->phase = PLACE_END;
+        showPhase(game, output);
+        return;
+    }
+
+    switch (canPlaceShipOnBoard(&game->players[game->playerTurn - 1], game->startPosition, input, game->chosenShip))
+    {
+        case PLACEMENT_OK:
         {
-            printf("Already guessed at this position.\n");
-            continue;
+            int row, col;
+
+            convertToIndex(game->startPosition, &row, &col);
+            emitGameEvent(EVENT_SHIP_PLACED, game, game->playerTurn - 1, (row * 10) + col, getShipIcon(game->chosenShip));
+            TRACE_MARK("placeShip");
+            game->shipsPlaced += 1;
+            game->phase = game->shipsPlaced == SHIPS ? PLACE_DONE : PLACE_CHOOSE_SHIP;
+            showPhase(game, output);
+            return;
         }
-
-        break;
+        
+        case PLACEMENT_START_OCCUPIED:
+            appendOutput(output, "%s is already occupied, please enter another.\n\n", game->startPosition);
+            break;
+
+        case PLACEMENT_END_OCCUPIED:
+            appendOutput(output, "%s is already occupied, please enter another.\n\n", input);
+            break;
+
+        case PLACEMENT_DIAGONAL:
+            appendOutput(output, "Cannot place ships diagonally\n\n");
+            break;
+
+        case PLACEMENT_WRONG_LENGTH:
+            appendOutput(output, "Cannot fit ship in given positions.\n\n");
+            break;
+
+        case PLACEMENT_OVERLAP:
+            appendOutput(output, "Ships cannot overlap.\n\n");
+            break;
     }
 
-    bool hit = false, shipSunk = false;
-    char *sunkenShip;
+    game->phase = PLACE_START;
+    showPhase(game, output);
+}
 
-    // checking if the location at which the guess was made contains a part of a ship
-    if (players[(playerTurn + 1) % 2].board[row][col] != ' ')
+/*
+    Moves the game on once a player has placed all their ships. In PvP games player 2 places their ships after
+    player 1, after which the game begins.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void stepPlaceDone(struct Game *game, struct GameOutput *output)
+{
+    if (!game->cpuPlayer && game->playerTurn == 1)
     {
-        players[playerTurn].actionBoard[row][col] = 'X';
-        hit = true;
+        beginPlacement(game, 2);
+        showPhase(game, output);
+        return;
+    }
 
-        // reducing ship hit points and checking if the respective ship has sank
-        switch (players[(playerTurn + 1) % 2].board[row][col])
-        {
-            case 'C':
-                if ((--players[(playerTurn + 1) % 2].shipsHP[CARRIER]) == 0)
-                {
-                    shipSunk = true;
-                    sunkenShip = "Carrier";
-                }
-                break;
-            case 'B':
-                if ((--players[(playerTurn + 1) % 2].shipsHP[BATTLESHIP]) == 0)
-                {
-                    shipSunk = true;
-                    sunkenShip = "Battleship";
-                }
-                break;
-            case 'D':
-                if ((--players[(playerTurn + 1) % 2].shipsHP[DESTROYER]) == 0)
-                {
-                    shipSunk = true;
-                    sunkenShip = "Destroyer";
-                }
-                break;
-            case 'S':
-                if ((--players[(playerTurn + 1) % 2].shipsHP[SUBMARINE]) == 0)
-                {
-                    shipSunk = true;
-                    sunkenShip = "Submarine";
-                }
-                break;
-            case 'P':
-                if ((--players[(playerTurn + 1) % 2].shipsHP[PATROL]) == 0)
-                {
-                    shipSunk = true;
-                    sunkenShip = "Patrol";
-                }
-                break;
-        }
+    emitGameEvent(EVENT_GAME_STARTED, game, -1, -1, '\0');
+    beginTurn(game, 1, output);
+}
 
-        if (checkWin(playerTurn))
-            return true;
+/*
+    Handles the player's choice from the turn menu.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `char *input`:
+        The player's choice.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void stepTurnMenu(struct Game *game, char *input, struct GameOutput *output)
+{
+    // anything but a single digit is turned down before it is looked at, so that "12" does not play option 1
+    if (strlen(input) > 1 || !isdigit((unsigned char) *input))
+    {
+        appendOutput(output, "%s\nEnter only 1, 2 or 3.\n\nEnter choice: ",
+                     strlen(input) > 1 ? "Please enter only one digit." : "Please enter only a number.");
+        return;
     }
-    else
+
+    switch (*input)
     {
-        players[playerTurn].actionBoard[row][col] = 'O';
+        case '1':
+            game->phase = GUESS;
+            showPhase(game, output);
+            return;
+        
+        case '2':
+            showTurnMenu(game, output, true, false);
+            return;
+
+        case '3':
+            showTurnMenu(game, output, false, true);
+            return;
     }
 
-    clearScreen();
+    appendOutput(output, "Enter only 1, 2 or 3.\n\nEnter choice: ");
+}
+
+/*
+    This function allows player to make a guess at where the opponent's ship is located.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `char *input`:
+        The position guessed by the player.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void stepGuess(struct Game *game, char *input, struct GameOutput *output)
+{
+    struct Player *player = &game->players[game->playerTurn - 1];
+    struct Player *opponent = &game->players[game->playerTurn % 2];
+    int row, col;
 
-    printf("Player %d's turn (%s):\n", playerTurn + 1, players[playerTurn].name);
-    displayBoard(players[playerTurn].actionBoard);
-    printf(hit ? "\nHIT!\n" : "\nMISS!\n");
-    _opponentMove = hit ? 'H' : 'M';
+    if (strlen(input) > 3 || !validatePosition(input))
+    {
+        appendOutput(output, "Incorrect input format. Please give input in the following range: [A-J][1-10].\n");
+        showGuessPrompt(game, output);
+        return;
+    }
+
+    convertToIndex(input, &row, &col);
 
-    if (shipSunk)
+    // checking if player already guessed at this location
+    if (player->actionBoard[row][col] != ' ')
     {
-        printf("You sunk their %s!\n", sunkenShip);
+        appendOutput(output, "Already guessed at this position.\n");
+        showGuessPrompt(game, output);
+        return;
     }
 
-    printf("Press ENTER to let player %d play...", ((playerTurn + 1) % 2) + 1);
-    clearInputBuffer();
+    int cell = (row * 10) + col;
+    fireSalvo(player, opponent, &cell, 1, &game->lastSalvo);
+
+    if (finishSalvo(game, game->playerTurn - 1, output))
+        return;
 
-    return false;
+    game->phase = GUESS_DONE;
+    showPhase(game, output);
 }
 
 /*
-    This functions prompts the user to place all the available ships.
+    This function allows player to fire a salvo at the opponent, i.e., make one guess for every ship they have 
+    left, all of which are resolved together.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `char *input`:
+        The positions guessed by the player, separated by spaces or commas.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
 */
-void placeShips()
+void stepSalvo(struct Game *game, char *input, struct GameOutput *output)
 {
-    short shipsPlaced = 0;
-    Ships shipsAvailable[] = { CARRIER, BATTLESHIP, DESTROYER, SUBMARINE, PATROL };
+    struct Player *player = &game->players[game->playerTurn - 1];
+    struct Player *opponent = &game->players[game->playerTurn % 2];
+    int shots = countSalvoShots(player), cells[SHIPS], guessed = 0;
+    char *position = strtok(input, " ,");
 
-    while (shipsPlaced < 5)
+    while (position != NULL)
     {
-        printf("For %s:\n", players[_playerTurn - 1].name);
-        displayBoard(players[_playerTurn - 1].board);
+        int row, col;
 
-        printf("\nShips available:\n");
+        if (guessed == shots)
+        {
+            appendOutput(output, "You can only fire %d shot(s) this turn.\n", shots);
+            showGuessPrompt(game, output);
+            return;
+        }
 
-        for (int i = 0; i < SHIPS; i++)
+        if (strlen(position) > 3 || !validatePosition(position))
         {
-            switch (shipsAvailable[i]) // prints all available ships
-            {
-                case CARRIER:
-                    printf("(C)arrier (5 spaces)\n");
-                    break;
-                case BATTLESHIP:
-                    printf("(B)attleship (4 spaces)\n");
-                    break;
-                case DESTROYER:
-                    printf("(D)estroyer (3 spaces)\n");
-                    break;
-                case SUBMARINE:
-                    printf("(S)ubmarine (3 spaces)\n");
-                    break;
-                case PATROL:
-                    printf("(P)atrol Boat (2 spaces)\n");
-                    break;
-            }
+            appendOutput(output, "Incorrect input format. Please give input in the following range: [A-J][1-10].\n");
+            showGuessPrompt(game, output);
+            return;
         }
 
-        char choice;
-        bool breakLoop = false;
-        Ships ship;
+        convertToIndex(position, &row, &col);
+
+        // checking if player already guessed at this location, either in an earlier turn or in this salvo
+        bool repeated = player->actionBoard[row][col] != ' ';
 
-        do
+        for (int i = 0; i < guessed; i++)
+            repeated = repeated || cells[i] == (row * 10) + col;
+
+        if (repeated)
         {
-            printf("Which piece do you want to place? (Type in the first letter of the piece): ");
-            takeInput(&choice, CHAR);
+            appendOutput(output, "Already guessed at %s.\n", position);
+            showGuessPrompt(game, output);
+            return;
+        }
 
-            switch(tolower(choice))
-            {
-                case 'c':
-                    if (shipsAvailable[CARRIER] == -1)
-                    {
-                        printf("Ship already placed!\n");
-                        break;
-                    }
-                    shipsAvailable[CARRIER] = -1; // making selected ship unavailable
-                    breakLoop = true;
-                    ship = CARRIER;
-                    break;
-                case 'b':
-                    if (shipsAvailable[BATTLESHIP] == -1)
-                    {
-                        printf("Ship already placed!\n");
-                        break;
-                    }
-                    shipsAvailable[BATTLESHIP] = -1;
-                    breakLoop = true;
-                    ship = BATTLESHIP;
-                    break;
-                case 'd':
-                    if (shipsAvailable[DESTROYER] == -1)
-                    {
-                        printf("Ship already placed!\n");
-                        break;
-                    }
-                    shipsAvailable[DESTROYER] = -1;
-                    breakLoop = true;
-                    ship = DESTROYER;
-                    break;
-                case 's':
-                    if (shipsAvailable[SUBMARINE] == -1)
-                    {
-                        printf("Ship already placed!\n");
-                        break;
-                    }
-                    shipsAvailable[SUBMARINE] = -1;
-                    breakLoop = true;
-                    ship = SUBMARINE;
-                    break;
-                case 'p':
-                    if (shipsAvailable[PATROL] == -1)
-                    {
-                        printf("Ship already placed!\n");
-                        break;
-                    }
-                    shipsAvailable[PATROL] = -1;
-                    breakLoop = true;
-                    ship = PATROL;
-                    break;
-                default: printf("Please only enter a choice from the above given list.\n");
-            }
-        } while (!breakLoop);
+        cells[guessed++] = (row * 10) + col;
+        position = strtok(NULL, " ,");
+    }
 
-        breakLoop = false;
+    if (guessed != shots)
+    {
+        appendOutput(output, "You have to fire all %d shot(s).\n", shots);
+        showGuessPrompt(game, output);
+        return;
+    }
 
-        do
-        {
-            char startPosition[4], endPosition[4];
-            takePosition(startPosition, "starting ");
-            takePosition(endPosition, "ending ");
+    fireSalvo(player, opponent, cells, shots, &game->lastSalvo);
 
-            if (canPlaceShipOnBoard(_playerTurn, startPosition, endPosition, ship))
-            {
-                breakLoop = 1;
-                shipsPlaced += 1;
-            }
-        } while (!breakLoop);
+    if (finishSalvo(game, game->playerTurn - 1, output))
+        return;
 
-        clearScreen();
-    } // end of while (shipsPlaced < 5), control comes out of this loop when all 5 ships have been placed
+    game->phase = GUESS_DONE;
+    showPhase(game, output);
 }
 
 /*
-    Allows user to enter a valid position on the game board.
+    Handles the players' choice of whether to play again.
 
     Parameters
     ----------
-    `char *positionArr`:
-        Array in which to store the valid position.
+    `struct Game *game`:
+        The game being played.
     
-    `char *positionPrompt`:
-        Function prompts user with string "Enter %sposition (ex: A5): ". positionArr replaces %s in this 
-        string.
+    `char *input`:
+        The players' choice.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
 */
-void takePosition(char *positionArr, char *positionPrompt)
+void stepPlayAgain(struct Game *game, char *input, struct GameOutput *output)
 {
-    short breakLoop = 0;
+    char playAgain = tolower(*input);
 
-    do 
+    if (strlen(input) != 1 || (playAgain != 'y' && playAgain != 'n'))
     {
-        printf("Enter %sposition (ex: A5): ", positionPrompt);
+        appendOutput(output, "Please enter only 'Y' or 'N'.\n");
+        showPhase(game, output);
+        return;
+    }
+
+    game->playAgain = playAgain == 'y';
+    game->phase = GAME_OVER;
+}
+
+/*
+    Lets the given player place their ships.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
     
-        takeNInput(positionArr, STRING, 3);
+    `short playerTurn`:
+        The player who is to place their ships (1 or 2).
+*/
+void beginPlacement(struct Game *game, short playerTurn)
+{
+    game->playerTurn = playerTurn;
+    game->phase = PLACE_CHOOSE_SHIP;
+    game->shipsPlaced = 0;
 
-        if (validatePosition(positionArr))
-            breakLoop = 1;
-        else
-            printf("Incorrect input format. Please give input in the following range: [A-J][1-10].\n");
+    for (int i = 0; i < SHIPS; i++)
+        game->shipsAvailable[i] = true;
+}
 
-    } while (!breakLoop);
+/*
+    Starts the given player's turn. If the player is the CPU, the CPU plays its turn right away and the turn 
+    passes back to the other player.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `short playerTurn`:
+        The player whose turn it is (1 or 2).
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void beginTurn(struct Game *game, short playerTurn, struct GameOutput *output)
+{
+    game->playerTurn = playerTurn;
+
+    if (game->cpuPlayer && (game->cpu.turn + 1) == game->playerTurn) // if it is CPU's turn
+    {
+        struct Player *cpuPlayer = &game->players[game->cpu.turn];
+        int shots = game->mode == SALVO ? countSalvoShots(cpuPlayer) : 1;
+        playCPUSalvo(&game->cpu, cpuPlayer, &game->players[(game->cpu.turn + 1) % 2], shots, &game->lastSalvo);
+
+        if (finishSalvo(game, game->cpu.turn, output))
+            return;
+
+        game->playerTurn = game->playerTurn == 1 ? 2 : 1; // next player's turn
+    }
+
+    game->phase = TURN_MENU;
+    showPhase(game, output);
+}
+
+/*
+    Shows the boards of both players along with the winner, and asks whether to play again.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `char *winnerName`:
+        Name of the player who won, `NULL` if the CPU won.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void endGame(struct Game *game, char *winnerName, struct GameOutput *output)
+{
+    output->clearScreen = true;
+
+    for (int i = 0; i < 2; i++)
+    {
+        appendOutput(output, "%s's board:\n", game->players[i].name);
+        appendBoard(output, game->players[i].board);
+        appendOutput(output, "%s's action board:\n", game->players[i].name);
+        appendBoard(output, game->players[i].actionBoard);
+        appendOutput(output, "\n\n");
+    }
+
+    if (winnerName == NULL)
+        appendOutput(output, "CPU Wins!\n");
+    else
+        appendOutput(output, "%s wins!\n", winnerName);
+
+    emitGameEvent(EVENT_GAME_OVER, game, game->playerTurn - 1, -1, '\0');
+    game->phase = PLAY_AGAIN;
+    showPhase(game, output);
+}
+
+/*
+    Prompts the player whose turn it is for their guess, or for all the guesses of their salvo.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+    
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void showGuessPrompt(struct Game *game, struct GameOutput *output)
+{
+    if (game->mode == SALVO)
+    {
+        appendOutput(output, "Enter your %d guess(es) separated by spaces (ex: A5 B6): ", 
+            countSalvoShots(&game->players[game->playerTurn - 1]));
+    }
+    else
+    {
+        appendOutput(output, "Enter your guess (ex: A5): ");
+    }
+}
+
+/*
+    Returns the number of shots the given player fires in their salvo: one for every ship they have left, but
+    never more than the number of cells they have not guessed yet.
+*/
+int countSalvoShots(struct Player *player)
+{
+    int shots = countShipsLeft(player), unguessed = countUnguessedCells(&player->unguessed, -1);
+
+    return shots < unguessed ? shots : unguessed;
 }
 
 /*
@@ -620,23 +1104,266 @@ void convertToIndex(char *position, int *row, int *col)
 */
 void resetVariables()
 {
-    _opponentMove = '\0';
     _cpuPlayer = false;
-    _playerTurn = 0;
 
     for (int player = 0; player < 2; player++)
+        resetPlayer(&players[player]);
+}
+
+/*
+    Plays the given game on the terminal, feeding every line typed by the player(s) into `gameStep` and printing
+    whatever the game produces, until the game is over. The game is saved after every step, so that it can be 
+    resumed if it is left before it is over, and is freed at the end.
+
+    Parameter
+    ---------
+    `struct Game *game`:
+        The game to play, set up or loaded.
+
+    Returns
+    -------
+    Returns `true` if after finishing the game, player(s) want to keep playing, else it returns `false`.
+*/
+bool playGame(struct Game *game)
+{
+    struct GameOutput output;
+    char input[INPUT_SIZE];
+    bool left = false;
+
+    game->spectators = _spectatorServer;
+
+    // the hints are kept up to date by an observer of the game's events, subscribed with the first game played
+    if (!_hintsSubscribed)
     {
-        for (int i = 0; i < BOARD_SIZE; i++)
+        subscribeGameEvents(hintGameEvent, EVENT_BIT(EVENT_SALVO_RESOLVED));
+        _hintsSubscribed = true;
+    }
+
+    if (game->phase >= TURN_MENU && game->phase < PLAY_AGAIN) // a resumed game is shown as it stands
+        publishGame(game->spectators, game, -1);
+
+    gameStep(game, NULL, &output);
+
+    while (1) // breaks once the game is over
+    {
+        TRACE_BEGIN("render");
+
+        if (output.clearScreen)
+            clearScreen();
+
+        fputs(output.text, stdout);
+        fflush(stdout); // the frame is written here rather than when input is next read, which it would be anyway
+        TRACE_END("render");
+
+        if (output.finished)
+            break;
+
+        TRACE_BEGIN("input");
+        ReturnCode read = takeLine(input, INPUT_SIZE);
+        TRACE_END("input");
+
+        if (read == ERR_CANNOT_READ) // stdin was closed, nobody is left to play
         {
-            for (int j = 0; j < BOARD_SIZE; j++)
-            {
-                players[player].board[i][j] = ' ';
-                players[player].actionBoard[i][j] = ' ';
-            }
+            game->playAgain = false;
+            left = game->phase < PLAY_AGAIN;
+            break;
         }
 
-        players[player].shipsHP[CARRIER] = 5; players[player].shipsHP[BATTLESHIP] = 4;
-        players[player].shipsHP[DESTROYER] = 3; players[player].shipsHP[SUBMARINE] = 3;
-        players[player].shipsHP[PATROL] = 2;
+        TRACE_BEGIN("gameStep");
+        gameStep(game, input, &output);
+        TRACE_END("gameStep");
+
+        if (game->phase < PLAY_AGAIN && !saveSnapshot(SNAPSHOT_PATH, game))
+            printf("Could not save the game to %s.\n", SNAPSHOT_PATH);
+    }
+
+    if (!left) // a game that is over cannot be resumed
+        remove(SNAPSHOT_PATH);
+
+    bool playAgain = game->playAgain;
+
+    if (game->record != NULL && game->record->winner != -1 && !appendRecord(_recordPath, game->record))
+        printf("Could not save the game to %s.\n", _recordPath);
+
+    free(game->record);
+    freeGame(game);
+    resetVariables();
+
+    return playAgain;
+}
+
+/*
+    Emits the events of the salvo a player just fired and ends the game if the salvo sank the last ship of the
+    other player.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played, whose lastSalvo is the salvo fired.
+
+    `int shooter`:
+        The player who fired the salvo (0 or 1), which is also the player whose turn it is.
+
+    `struct GameOutput *output`:
+        Stores the text produced.
+
+    Returns
+    -------
+    Returns `true` if the game is over, else it returns `false`.
+*/
+bool finishSalvo(struct Game *game, int shooter, struct GameOutput *output)
+{
+    emitSalvoEvents(game, shooter);
+
+    if (!checkWin(&game->players[(shooter + 1) % 2]))
+        return false;
+
+    bool cpuWon = game->cpuPlayer && game->cpu.turn == shooter;
+
+    endGame(game, cpuWon ? NULL : game->players[shooter].name, output);
+
+    return true;
+}
+
+/*
+    Keeps the record of a game up to date with its events, if the game is being recorded. Subscribed to the
+    game's events when games are recorded.
+
+    Parameter
+    ---------
+    `struct GameEvent *event`:
+        The event, the game starting, a salvo being resolved or the game ending.
+*/
+void recordGameEvent(struct GameEvent *event)
+{
+    struct Game *game = event->game;
+
+    if (game->record == NULL)
+        return;
+
+    switch (event->kind)
+    {
+        case EVENT_GAME_STARTED:
+            beginRecord(game->record, game);
+            break;
+
+        case EVENT_SALVO_RESOLVED:
+            recordSalvo(game->record, event->player, &game->lastSalvo);
+            break;
+
+        case EVENT_GAME_OVER:
+            finishRecord(game->record, event->player);
+            break;
+
+        default:
+            break;
     }
-}
\ No newline at end of file
+}
+
+/*
+    Shows spectators the game as it stands whenever it starts and after every salvo. Subscribed to the game's 
+    events when games are watched.
+
+    Parameter
+    ---------
+    `struct GameEvent *event`:
+        The event, the game starting or a salvo being resolved.
+*/
+void spectateGameEvent(struct GameEvent *event)
+{
+    publishGame(event->game->spectators, event->game, event->kind == EVENT_SALVO_RESOLVED ? event->player : -1);
+}
+
+/*
+    Hands a player's hint their board whenever they fire, once the player has asked for a hint, so that the odds
+    are ready by the time they are asked for again. Subscribed to the game's events with the first game played.
+
+    Parameter
+    ---------
+    `struct GameEvent *event`:
+        The event, a salvo being resolved.
+*/
+void hintGameEvent(struct GameEvent *event)
+{
+    // players who never ask for a hint cost the game no thread and no expert
+    if (event->game->hints[event->player] != NULL)
+        refreshHint(event->game, event->player);
+}
+
+/*
+    Hands the hint of the given player their board as it is now, starting the hint if it has not been started.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+
+    `int player`:
+        The player (0 or 1).
+*/
+void refreshHint(struct Game *game, int player)
+{
+    bool sunk[SHIPS];
+
+    for (int i = 0; i < SHIPS; i++)
+        sunk[i] = game->players[(player + 1) % 2].shipsHP[i] == 0;
+
+    if (game->hints[player] == NULL)
+        game->hints[player] = startHint(game->players[player].actionBoard, sunk);
+    else
+        updateHint(game->hints[player], game->players[player].actionBoard, sunk);
+}
+
+/*
+    Appends the action board of the player whose turn it is, with every cell not guessed yet showing the chance
+    that it holds a ship, as last worked out by the player's hint. Never waits on the hint.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+
+    `struct GameOutput *output`:
+        Stores the text produced.
+*/
+void appendHint(struct Game *game, struct GameOutput *output)
+{
+    struct Player *player = &game->players[game->playerTurn - 1];
+    struct HintView view;
+
+    // a hint is only started once it is first asked for, the first odds being ready a moment later
+    if (game->hints[game->playerTurn - 1] == NULL)
+        refreshHint(game, game->playerTurn - 1);
+
+    if (game->hints[game->playerTurn - 1] == NULL || !readHint(game->hints[game->playerTurn - 1], &view))
+    {
+        appendOutput(output, "\nThe odds are still being worked out, choose 3 again in a moment.\n");
+        return;
+    }
+
+    char shaded[BOARD_SIZE][BOARD_SIZE];
+
+    // the chance is shown in tenths, rounded down, and - marks a cell that cannot hold a ship
+    for (int cell = 0; cell < CELLS; cell++)
+    {
+        char mark = player->actionBoard[cell / BOARD_SIZE][cell % BOARD_SIZE];
+        int tenths = (int) (view.odds[cell] * 10);
+
+        if (mark != ' ')
+            shaded[cell / BOARD_SIZE][cell % BOARD_SIZE] = mark;
+        else
+            shaded[cell / BOARD_SIZE][cell % BOARD_SIZE] = view.odds[cell] <= 0 ? '-' : '0' + (tenths > 9 ? 9 : tenths);
+    }
+
+    appendBoard(output, shaded);
+    appendOutput(output, "\nHint: every cell not guessed yet shows the chance it holds a ship in tenths, - if it cannot.\n");
+    appendOutput(output, "The chances are %s%s.\n", view.exact ? "counted over every possible layout" : "estimated from the layouts drawn",
+        view.current ? "" : ", and are still catching up with your last guess");
+
+    // the best cell was worked out for the board the odds are for, which may since have been guessed
+    if (view.current && view.best != -1 && player->actionBoard[view.best / BOARD_SIZE][view.best % BOARD_SIZE] == ' ')
+    {
+        appendOutput(output, "Suggested guess: %c%d (%.0f%% chance of a hit)\n", 'A' + view.best % BOARD_SIZE, 
+            view.best / BOARD_SIZE + 1, view.odds[view.best] * 100);
+    }
+}
@@ -0,0 +1,159 @@
+/*
+
+File Name: game_event.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the game's event bus, through which a game tells whoever is interested what happens in it (ships
+    being placed, shots being fired, hitting, missing and sinking ships, and the game ending) without having to
+    know who that is.
+
+    Observers subscribe to the kinds of events they want when the program starts, before any game is played,
+    and are kept in a fixed array of MAX_GAME_OBSERVERS. Emitting an event builds it on the stack and calls the
+    observers subscribed to its kind in the order they subscribed, so that no memory is allocated and no lock is
+    taken while a game is played. As the kinds anyone subscribed to are also kept as a single set, an event no
+    observer wants is dropped with a single test, and a game played with no observers pays nothing else for them.
+
+    INCLUDES (user-defined)
+    -----------------------
+    game_event.h
+
+    GLOBAL VARIABLES
+    ----------------
+    1. struct GameSubscriber _gameObservers[MAX_GAME_OBSERVERS]
+    2. int _gameObserverCount
+    3. unsigned int _gameEventKinds
+
+    STRUCTS
+    -------
+    GameSubscriber
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool subscribeGameEvents(void (*observer)(struct GameEvent *event), unsigned int kinds)
+    2. void emitGameEvent(GameEventKind kind, struct Game *game, int player, int cell, char ship)
+    3. void emitSalvoEvents(struct Game *game, int player)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <game_event.h>
+
+/*
+    GameSubscriber struct, contains an observer subscribed to game events. Contains:
+    - void (*observer)(struct GameEvent *event): the observer, called with every event it subscribed to.
+    - unsigned int kinds: the kinds of events it subscribed to, a set of EVENT_BIT.
+*/
+struct GameSubscriber {
+    void (*observer)(struct GameEvent *event);
+    unsigned int kinds;
+};
+
+// stores the observers subscribed to game events, in the order they subscribed
+struct GameSubscriber _gameObservers[MAX_GAME_OBSERVERS];
+// stores the number of observers in _gameObservers
+int _gameObserverCount = 0;
+// stores every kind of event at least one observer subscribed to, a set of EVENT_BIT
+unsigned int _gameEventKinds = 0;
+
+/*
+    Subscribes an observer to the given kinds of game events. Observers are read while games are played without
+    any lock, so they may only subscribe before the first game is started.
+
+    Parameters
+    ----------
+    `void (*observer)(struct GameEvent *event)`:
+        The observer, which must return quickly, as the game waits on it.
+
+    `unsigned int kinds`:
+        The kinds of events to call it with, a set of EVENT_BIT.
+
+    Returns
+    -------
+    Returns `true` if the observer was subscribed, or `false` if MAX_GAME_OBSERVERS are subscribed already.
+*/
+bool subscribeGameEvents(void (*observer)(struct GameEvent *event), unsigned int kinds)
+{
+    if (_gameObserverCount == MAX_GAME_OBSERVERS)
+        return false;
+
+    _gameObservers[_gameObserverCount].observer = observer;
+    _gameObservers[_gameObserverCount].kinds = kinds;
+    _gameObserverCount++;
+    _gameEventKinds |= kinds;
+
+    return true;
+}
+
+/*
+    Calls every observer subscribed to the given kind of event with it.
+
+    Parameters
+    ----------
+    `GameEventKind kind`:
+        What happened.
+
+    `struct Game *game`:
+        The game it happened in.
+
+    `int player`:
+        The player who placed the ship, fired the shot or won the game (0 or 1), -1 if there is none.
+
+    `int cell`:
+        Cell of the shot or first cell of the ship placed, given as (row * 10) + col, -1 if there is none.
+
+    `char ship`:
+        Icon of the ship placed, hit or sunk, '\0' if there is none.
+*/
+void emitGameEvent(GameEventKind kind, struct Game *game, int player, int cell, char ship)
+{
+    if ((_gameEventKinds & EVENT_BIT(kind)) == 0)
+        return;
+
+    struct GameEvent event = { .kind = kind, .game = game, .player = player, .cell = cell, .ship = ship };
+
+    for (int i = 0; i < _gameObserverCount; i++)
+    {
+        if (_gameObservers[i].kinds & EVENT_BIT(kind))
+            _gameObservers[i].observer(&event);
+    }
+}
+
+/*
+    Emits the events of the salvo a player just fired, which is the game's lastSalvo: for every shot, the shot
+    being fired, its hit or miss and the ship it sank if any, followed by the salvo being resolved.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game being played.
+
+    `int player`:
+        The player who fired the salvo (0 or 1).
+*/
+void emitSalvoEvents(struct Game *game, int player)
+{
+    struct SalvoResult *salvo = &game->lastSalvo;
+
+    if (_gameEventKinds & SHOT_EVENTS)
+    {
+        struct Player *target = &game->players[(player + 1) % 2];
+
+        for (int i = 0; i < salvo->shots; i++)
+        {
+            int cell = salvo->cells[i];
+            bool hit = salvo->statuses[i] == 'H';
+            char ship = hit ? target->board[cell / 10][cell % 10] : '\0';
+
+            emitGameEvent(EVENT_SHOT_FIRED, game, player, cell, '\0');
+            emitGameEvent(hit ? EVENT_HIT : EVENT_MISS, game, player, cell, ship);
+
+            if (salvo->sunkShips[i] != '\0')
+                emitGameEvent(EVENT_SUNK, game, player, cell, salvo->sunkShips[i]);
+        }
+    }
+
+    emitGameEvent(EVENT_SALVO_RESOLVED, game, player, -1, '\0');
+}
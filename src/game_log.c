@@ -0,0 +1,571 @@
+/*
+
+File Name: game_log.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the game log, which appends every game played by the match, the tournament and the arena to one
+    file, in the record format of record.c, without the games having to wait on the disk.
+
+    Every thread playing games opens a stage of its own, which holds two buffers of LOG_BUFFER_BYTES. Games are
+    encoded straight into the stage's current buffer without taking any lock, as no other thread touches it. Once
+    the buffer has no room left for another game, it is handed to the log's writer thread and the thread goes on
+    with the other buffer, so that the lock is only taken once for every full buffer. If the other buffer has not
+    been written yet, the thread waits until it has, which keeps a disk that cannot keep up from taking more than
+    two buffers of memory per thread. A thread may also flush its stage, handing over what it holds and waiting
+    until it is written, when the games have to be in the file before it goes on.
+
+    The writer thread takes every full buffer handed to it, up to LOG_BATCH_BUFFERS at a time, and writes them
+    with a single call on Linux, asking for them to be put on disk after every batch, when the log is closed or
+    never, as set by LogSync. The file is opened unbuffered, as the buffers are already far larger than what
+    the C library would gather.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. game_log.h
+    2. thread.h
+
+    GLOBAL VARIABLES
+    ----------------
+    1. char *_logPath
+    2. LogSync _logSync
+
+    STRUCTS
+    -------
+    1. LogBuffer
+    2. LogStage
+    3. GameLog
+
+    FUNCTIONS (global)
+    ------------------
+    1. void setLogPath(char *path, LogSync sync)
+    2. char *getLogPath(void)
+    3. bool parseLogSync(char *name, LogSync *sync)
+    4. struct GameLog *openGameLog(void)
+    5. bool closeGameLog(struct GameLog *log)
+    6. struct LogStage *openLogStage(struct GameLog *log)
+    7. void closeLogStage(struct LogStage *stage)
+    8. void logGame(struct LogStage *stage, struct GameRecord *record)
+    9. void logEncodedGame(struct LogStage *stage, unsigned char *bytes, size_t size)
+    10. void flushLogStage(struct LogStage *stage)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *runLogWriter(void *argument)
+    2. bool writeLogBatch(struct GameLog *log, struct LogBuffer *batch[LOG_BATCH_BUFFERS], int count)
+    3. bool syncLog(struct GameLog *log)
+    4. void handOffBuffer(struct LogStage *stage)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+    #include <errno.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#else
+    #include <io.h>
+#endif
+
+#include <game_log.h>
+#include <thread.h>
+#include <string.h>
+
+#define LOG_QUEUE_SIZE (2 * LOG_MAX_STAGES) // no. of buffers that can be waiting on the writer, two per stage
+
+// stores the file games are logged to, NULL if games are not logged
+char *_logPath = NULL;
+// stores when what is written to the log is put on disk
+LogSync _logSync = LOG_SYNC_NONE;
+
+/*
+    LogBuffer struct, contains one of the two buffers of a stage. Contains:
+    - unsigned char *bytes: the encoded games, LOG_BUFFER_BYTES long.
+    - size_t size: number of bytes used.
+    - bool queued: whether the buffer has been handed to the writer and not written yet.
+*/
+struct LogBuffer {
+    unsigned char *bytes;
+    size_t size;
+    bool queued;
+};
+
+/*
+    LogStage struct, contains the buffers a single thread logs its games into. Contains:
+    - struct GameLog *log: the log the stage belongs to.
+    - struct LogBuffer buffers[2]: the two buffers.
+    - int current: index of the buffer games are encoded into.
+*/
+struct LogStage {
+    struct GameLog *log;
+    struct LogBuffer buffers[2];
+    int current;
+};
+
+/*
+    GameLog struct, contains a log and its writer thread. Contains:
+    - FILE *file: the file games are appended to, unbuffered.
+    - LogSync sync: when what is written is put on disk.
+    - struct Thread writer: the writer thread.
+    - struct Mutex mutex: guards everything below, as well as whether the buffers of the stages are queued.
+    - struct ConditionVariable filled: signalled when a buffer is handed to the writer, or when the log is closed.
+    - struct ConditionVariable drained: signalled when the writer has written a batch of buffers.
+    - struct LogBuffer *queue[LOG_QUEUE_SIZE]: the buffers waiting on the writer, in the order they were handed.
+    - int head: index in queue of the buffer handed first.
+    - int queued: number of buffers in queue.
+    - int stages: number of stages open.
+    - bool closing: whether the writer should stop once queue is empty.
+    - bool failed: whether anything could not be written.
+*/
+struct GameLog {
+    FILE *file;
+    LogSync sync;
+    struct Thread writer;
+    struct Mutex mutex;
+    struct ConditionVariable filled;
+    struct ConditionVariable drained;
+    struct LogBuffer *queue[LOG_QUEUE_SIZE];
+    int head;
+    int queued;
+    int stages;
+    bool closing;
+    bool failed;
+};
+
+void *runLogWriter(void *argument);
+bool writeLogBatch(struct GameLog *log, struct LogBuffer *batch[LOG_BATCH_BUFFERS], int count);
+bool syncLog(struct GameLog *log);
+void handOffBuffer(struct LogStage *stage);
+
+/*
+    Sets the file games are logged to by the match, the tournament and the arena.
+
+    Parameters
+    ----------
+    `char *path`:
+        The file to append games to, NULL to not log games.
+
+    `LogSync sync`:
+        When what is written is put on disk.
+*/
+void setLogPath(char *path, LogSync sync)
+{
+    _logPath = path;
+    _logSync = sync;
+}
+
+/*
+    Returns the file games are logged to, NULL if games are not logged.
+*/
+char *getLogPath()
+{
+    return _logPath;
+}
+
+/*
+    Parses the name of a LogSync.
+
+    Parameters
+    ----------
+    `char *name`:
+        The name, none, batch or close.
+
+    `LogSync *sync`:
+        Stores the LogSync named.
+
+    Returns
+    -------
+    Returns `true` if name is the name of a LogSync, else it returns `false`.
+*/
+bool parseLogSync(char *name, LogSync *sync)
+{
+    char *names[] = { "none", "batch", "close" };
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            *sync = (LogSync) i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+    Opens the file set by setLogPath and starts its writer thread.
+
+    Returns
+    -------
+    Returns the log, or NULL if no file is set or if it could not be opened, in which case the reason is printed.
+*/
+struct GameLog *openGameLog()
+{
+    if (_logPath == NULL)
+        return NULL;
+
+    struct GameLog *log = (struct GameLog *) calloc(1, sizeof(struct GameLog));
+
+    if (log == NULL)
+    {
+        printf("Could not allocate memory for the log.\n");
+        return NULL;
+    }
+
+    if ((log->file = fopen(_logPath, "ab")) == NULL)
+    {
+        printf("Could not open %s to log games to.\n", _logPath);
+        free(log);
+        return NULL;
+    }
+
+    setvbuf(log->file, NULL, _IONBF, 0);
+    log->sync = _logSync;
+    initMutex(&log->mutex);
+    initCondition(&log->filled);
+    initCondition(&log->drained);
+
+    if (!startThread(&log->writer, runLogWriter, log))
+    {
+        printf("Could not start the thread writing the log.\n");
+        destroyCondition(&log->drained);
+        destroyCondition(&log->filled);
+        destroyMutex(&log->mutex);
+        fclose(log->file);
+        free(log);
+        return NULL;
+    }
+
+    return log;
+}
+
+/*
+    Writes whatever is still waiting on the writer thread, stops it and closes the file. Every stage of the log
+    must have been closed first.
+
+    Parameter
+    ---------
+    `struct GameLog *log`:
+        The log to close.
+
+    Returns
+    -------
+    Returns `true` if every game handed to the log was written, else it returns `false`.
+*/
+bool closeGameLog(struct GameLog *log)
+{
+    lockMutex(&log->mutex);
+    log->closing = true;
+    signalCondition(&log->filled);
+    unlockMutex(&log->mutex);
+    joinThread(&log->writer);
+
+    bool written = !log->failed && (log->sync != LOG_SYNC_CLOSE || syncLog(log));
+
+    written = fclose(log->file) == 0 && written;
+    destroyCondition(&log->drained);
+    destroyCondition(&log->filled);
+    destroyMutex(&log->mutex);
+    free(log);
+
+    return written;
+}
+
+/*
+    Opens a stage on the given log, for a single thread to log its games into.
+
+    Parameter
+    ---------
+    `struct GameLog *log`:
+        The log.
+
+    Returns
+    -------
+    Returns the stage, or NULL if its buffers could not be allocated or if LOG_MAX_STAGES stages are open.
+*/
+struct LogStage *openLogStage(struct GameLog *log)
+{
+    struct LogStage *stage = (struct LogStage *) calloc(1, sizeof(struct LogStage));
+
+    if (stage == NULL)
+        return NULL;
+
+    stage->log = log;
+    stage->buffers[0].bytes = (unsigned char *) malloc(LOG_BUFFER_BYTES);
+    stage->buffers[1].bytes = (unsigned char *) malloc(LOG_BUFFER_BYTES);
+    lockMutex(&log->mutex);
+
+    bool opened = stage->buffers[0].bytes != NULL && stage->buffers[1].bytes != NULL && log->stages < LOG_MAX_STAGES;
+
+    log->stages += opened ? 1 : 0;
+    unlockMutex(&log->mutex);
+
+    if (!opened)
+    {
+        free(stage->buffers[0].bytes);
+        free(stage->buffers[1].bytes);
+        free(stage);
+        return NULL;
+    }
+
+    return stage;
+}
+
+/*
+    Hands what is left in a stage to the writer thread and waits until it has been written, then frees the stage.
+
+    Parameter
+    ---------
+    `struct LogStage *stage`:
+        The stage to close.
+*/
+void closeLogStage(struct LogStage *stage)
+{
+    flushLogStage(stage);
+    lockMutex(&stage->log->mutex);
+    stage->log->stages--;
+    unlockMutex(&stage->log->mutex);
+    free(stage->buffers[0].bytes);
+    free(stage->buffers[1].bytes);
+    free(stage);
+}
+
+/*
+    Logs a finished game. Only waits if both buffers of the stage are full and the writer thread has not caught up.
+
+    Parameters
+    ----------
+    `struct LogStage *stage`:
+        The stage of the calling thread.
+
+    `struct GameRecord *record`:
+        The record of the game.
+*/
+void logGame(struct LogStage *stage, struct GameRecord *record)
+{
+    struct LogBuffer *buffer = &stage->buffers[stage->current];
+
+    if (LOG_BUFFER_BYTES - buffer->size < MAX_RECORD_BYTES)
+    {
+        handOffBuffer(stage);
+        buffer = &stage->buffers[stage->current];
+    }
+
+    buffer->size += encodeRecord(record, buffer->bytes + buffer->size);
+}
+
+/*
+    Logs a game already encoded with encodeRecord, such as one held back until it is known it should be logged.
+    Only waits as logGame does.
+
+    Parameters
+    ----------
+    `struct LogStage *stage`:
+        The stage of the calling thread.
+
+    `unsigned char *bytes`:
+        The encoded game.
+
+    `size_t size`:
+        Number of bytes the game takes, at most MAX_RECORD_BYTES.
+*/
+void logEncodedGame(struct LogStage *stage, unsigned char *bytes, size_t size)
+{
+    struct LogBuffer *buffer = &stage->buffers[stage->current];
+
+    if (LOG_BUFFER_BYTES - buffer->size < size)
+    {
+        handOffBuffer(stage);
+        buffer = &stage->buffers[stage->current];
+    }
+
+    memcpy(buffer->bytes + buffer->size, bytes, size);
+    buffer->size += size;
+}
+
+/*
+    Hands what is in a stage to the writer thread and waits until it has been written.
+
+    Parameter
+    ---------
+    `struct LogStage *stage`:
+        The stage to flush.
+*/
+void flushLogStage(struct LogStage *stage)
+{
+    struct GameLog *log = stage->log;
+
+    if (stage->buffers[stage->current].size > 0)
+        handOffBuffer(stage);
+
+    lockMutex(&log->mutex);
+
+    while (stage->buffers[0].queued || stage->buffers[1].queued)
+        waitCondition(&log->drained, &log->mutex);
+
+    unlockMutex(&log->mutex);
+}
+
+/*
+    Writes the buffers handed to the log until it is closed. Runs on the writer thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The GameLog to write.
+*/
+void *runLogWriter(void *argument)
+{
+    struct GameLog *log = (struct GameLog *) argument;
+    struct LogBuffer *batch[LOG_BATCH_BUFFERS];
+
+    lockMutex(&log->mutex);
+
+    while (true)
+    {
+        while (log->queued == 0 && !log->closing)
+            waitCondition(&log->filled, &log->mutex);
+
+        if (log->queued == 0)
+            break;
+
+        int count = log->queued < LOG_BATCH_BUFFERS ? log->queued : LOG_BATCH_BUFFERS;
+
+        for (int i = 0; i < count; i++)
+            batch[i] = log->queue[(log->head + i) % LOG_QUEUE_SIZE];
+
+        log->head = (log->head + count) % LOG_QUEUE_SIZE;
+        log->queued -= count;
+        unlockMutex(&log->mutex);
+
+        // written without the lock, so that the stages can go on handing over buffers in the meantime
+        bool written = writeLogBatch(log, batch, count);
+
+        lockMutex(&log->mutex);
+        log->failed = log->failed || !written;
+
+        for (int i = 0; i < count; i++)
+            batch[i]->queued = false;
+
+        signalCondition(&log->drained);
+    }
+
+    unlockMutex(&log->mutex);
+
+    return NULL;
+}
+
+/*
+    Appends the given buffers to the file of the log, putting them on disk afterwards on LOG_SYNC_BATCH.
+
+    Parameters
+    ----------
+    `struct GameLog *log`:
+        The log.
+
+    `struct LogBuffer *batch[LOG_BATCH_BUFFERS]`:
+        The buffers, in the order they are to be written.
+
+    `int count`:
+        Number of buffers in batch.
+
+    Returns
+    -------
+    Returns `true` if every buffer was written, else it returns `false`.
+*/
+bool writeLogBatch(struct GameLog *log, struct LogBuffer *batch[LOG_BATCH_BUFFERS], int count)
+{
+#ifdef _WIN32
+    for (int i = 0; i < count; i++)
+    {
+        if (fwrite(batch[i]->bytes, 1, batch[i]->size, log->file) != batch[i]->size)
+            return false;
+    }
+#else
+    struct iovec vectors[LOG_BATCH_BUFFERS];
+    int first = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        vectors[i].iov_base = batch[i]->bytes;
+        vectors[i].iov_len = batch[i]->size;
+    }
+
+    while (first < count)
+    {
+        ssize_t written = writev(fileno(log->file), vectors + first, count - first);
+
+        if (written <= 0)
+        {
+            if (written < 0 && errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        // a write may stop short, in which case it goes on from where it stopped
+        while (first < count && (size_t) written >= vectors[first].iov_len)
+            written -= vectors[first++].iov_len;
+
+        if (first < count)
+        {
+            vectors[first].iov_base = (char *) vectors[first].iov_base + written;
+            vectors[first].iov_len -= written;
+        }
+    }
+#endif
+
+    return log->sync != LOG_SYNC_BATCH || syncLog(log);
+}
+
+/*
+    Asks the operating system to put everything written to the file of the given log on disk.
+
+    Parameter
+    ---------
+    `struct GameLog *log`:
+        The log.
+
+    Returns
+    -------
+    Returns `true` if the file was put on disk, else it returns `false`.
+*/
+bool syncLog(struct GameLog *log)
+{
+#ifdef _WIN32
+    return _commit(_fileno(log->file)) == 0;
+#else
+    return fsync(fileno(log->file)) == 0;
+#endif
+}
+
+/*
+    Hands the current buffer of a stage to the writer thread and makes the other buffer the current one, waiting
+    until the other buffer has been written if it has not been yet.
+
+    Parameter
+    ---------
+    `struct LogStage *stage`:
+        The stage.
+*/
+void handOffBuffer(struct LogStage *stage)
+{
+    struct GameLog *log = stage->log;
+    struct LogBuffer *buffer = &stage->buffers[stage->current];
+
+    lockMutex(&log->mutex);
+    log->queue[(log->head + log->queued++) % LOG_QUEUE_SIZE] = buffer;
+    buffer->queued = true;
+    signalCondition(&log->filled);
+    stage->current = 1 - stage->current;
+
+    while (stage->buffers[stage->current].queued)
+        waitCondition(&log->drained, &log->mutex);
+
+    unlockMutex(&log->mutex);
+    stage->buffers[stage->current].size = 0;
+}
@@ -0,0 +1,323 @@
+/*
+
+File Name: hint.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the hints offered to a human player, which show how likely every cell they have not guessed yet is
+    to hold a ship, given their hits, misses and the ships they have sunk.
+
+    Every hint works the odds out on a worker thread of its own, using the expert CPU's state (see expert.c) as
+    if the player's guesses had been made by the expert: the layouts are counted exactly whenever that can be
+    done in time, and estimated from the layouts drawn otherwise. Whenever the player's board changes, the
+    worker is handed the new board and feeds only the guesses it has not seen yet to the expert, which keeps
+    the layouts that still fit, so every update builds on the work done for the one before. The odds are worked
+    out once for every change, taking up to HINT_BUDGET_MS, and are then published for the game to read.
+
+    Reading a hint never waits on the worker: it returns the last odds published, marked as not current if the
+    worker has not caught up with the board yet, so that showing a hint is always instant.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. hint.h
+    2. thread.h
+    3. timing.h
+
+    STRUCTS
+    -------
+    Hint
+
+    FUNCTIONS (global)
+    ------------------
+    1. struct Hint *startHint(char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+    2. void updateHint(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+    3. bool readHint(struct Hint *hint, struct HintView *view)
+    4. void stopHint(struct Hint *hint)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *runHint(void *argument)
+    2. void applyHintBoard(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+
+*Compiled using C99 standards*
+
+*/
+
+#include <hint.h>
+#include <thread.h>
+#include <timing.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    Hint struct, contains a hint and its worker thread. Contains:
+    - struct Thread worker: the worker thread.
+    - struct Mutex mutex: guards everything below up to expert.
+    - struct ConditionVariable changed: signalled when the board changes or the hint is stopped.
+    - char board[BOARD_SIZE][BOARD_SIZE]: the player's action board, as of the last update.
+    - bool sunk[SHIPS]: the ships the player has sunk, as of the last update.
+    - unsigned int version: number of updates made.
+    - bool stopping: whether the worker should stop.
+    - struct HintView view: the odds last published.
+    - unsigned int viewVersion: the update the odds last published were worked out for.
+    - bool ready: whether any odds have been published.
+    - struct ExpertState *expert: the expert working out the odds, only touched by the worker.
+    - char applied[BOARD_SIZE][BOARD_SIZE]: the board as the expert has seen it, only touched by the worker.
+    - bool appliedSunk[SHIPS]: the ships the expert knows are sunk, only touched by the worker.
+*/
+struct Hint {
+    struct Thread worker;
+    struct Mutex mutex;
+    struct ConditionVariable changed;
+    char board[BOARD_SIZE][BOARD_SIZE];
+    bool sunk[SHIPS];
+    unsigned int version;
+    bool stopping;
+    struct HintView view;
+    unsigned int viewVersion;
+    bool ready;
+    struct ExpertState *expert;
+    char applied[BOARD_SIZE][BOARD_SIZE];
+    bool appliedSunk[SHIPS];
+};
+
+void *runHint(void *argument);
+void applyHintBoard(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS]);
+
+/*
+    Starts working out the odds for a player's board on a worker thread.
+
+    Parameters
+    ----------
+    `char board[BOARD_SIZE][BOARD_SIZE]`:
+        The player's action board, holding 'X' for a hit, 'O' for a miss and ' ' for a cell not guessed yet.
+
+    `bool sunk[SHIPS]`:
+        The ships the player has sunk.
+
+    Returns
+    -------
+    Returns the hint, or `NULL` if it could not be started.
+*/
+struct Hint *startHint(char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+{
+    struct Hint *hint = (struct Hint *) malloc(sizeof(struct Hint));
+
+    if (hint == NULL)
+        return NULL;
+
+    hint->expert = createExpert(randomSeed());
+
+    if (hint->expert == NULL)
+    {
+        free(hint);
+        return NULL;
+    }
+
+    // the hint shares the processors with the game and its CPU, so it counts on a single thread
+    hint->expert->threads = 1;
+    memcpy(hint->board, board, sizeof hint->board);
+    memcpy(hint->sunk, sunk, sizeof hint->sunk);
+    memset(hint->applied, ' ', sizeof hint->applied);
+    memset(hint->appliedSunk, 0, sizeof hint->appliedSunk);
+    hint->version = 1;
+    hint->viewVersion = 0;
+    hint->stopping = false;
+    hint->ready = false;
+
+    initMutex(&hint->mutex);
+    initCondition(&hint->changed);
+
+    if (!startThread(&hint->worker, runHint, hint))
+    {
+        destroyCondition(&hint->changed);
+        destroyMutex(&hint->mutex);
+        destroyExpert(hint->expert);
+        free(hint);
+        return NULL;
+    }
+
+    return hint;
+}
+
+/*
+    Hands the worker the player's board as it is now. Returns at once, the odds being worked out in the
+    background.
+
+    Parameters
+    ----------
+    `struct Hint *hint`:
+        The hint.
+
+    `char board[BOARD_SIZE][BOARD_SIZE]`:
+        The player's action board, which only ever gains guesses.
+
+    `bool sunk[SHIPS]`:
+        The ships the player has sunk.
+*/
+void updateHint(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+{
+    lockMutex(&hint->mutex);
+    memcpy(hint->board, board, sizeof hint->board);
+    memcpy(hint->sunk, sunk, sizeof hint->sunk);
+    hint->version++;
+    signalCondition(&hint->changed);
+    unlockMutex(&hint->mutex);
+}
+
+/*
+    Reads the odds last worked out, without waiting on the worker.
+
+    Parameters
+    ----------
+    `struct Hint *hint`:
+        The hint.
+
+    `struct HintView *view`:
+        Stores the odds.
+
+    Returns
+    -------
+    Returns `true` if any odds have been worked out, `false` if the worker has not finished its first pass yet.
+*/
+bool readHint(struct Hint *hint, struct HintView *view)
+{
+    lockMutex(&hint->mutex);
+
+    bool ready = hint->ready;
+
+    *view = hint->view;
+    view->current = hint->viewVersion == hint->version;
+    unlockMutex(&hint->mutex);
+
+    return ready;
+}
+
+/*
+    Stops the worker, once it is done with what it is working on, and frees the hint.
+
+    Parameter
+    ---------
+    `struct Hint *hint`:
+        The hint, which may be `NULL`.
+*/
+void stopHint(struct Hint *hint)
+{
+    if (hint == NULL)
+        return;
+
+    lockMutex(&hint->mutex);
+    hint->stopping = true;
+    signalCondition(&hint->changed);
+    unlockMutex(&hint->mutex);
+
+    joinThread(&hint->worker);
+    destroyCondition(&hint->changed);
+    destroyMutex(&hint->mutex);
+    destroyExpert(hint->expert);
+    free(hint);
+}
+
+/*
+    Works out the odds every time the board changes, until the hint is stopped. Runs on the hint's worker thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The hint.
+
+    Returns
+    -------
+    Returns `NULL`.
+*/
+void *runHint(void *argument)
+{
+    struct Hint *hint = (struct Hint *) argument;
+    char board[BOARD_SIZE][BOARD_SIZE];
+    bool sunk[SHIPS];
+
+    lockMutex(&hint->mutex);
+
+    while (true)
+    {
+        while (!hint->stopping && hint->viewVersion == hint->version)
+            waitCondition(&hint->changed, &hint->mutex);
+
+        if (hint->stopping)
+            break;
+
+        unsigned int version = hint->version;
+
+        memcpy(board, hint->board, sizeof board);
+        memcpy(sunk, hint->sunk, sizeof sunk);
+        unlockMutex(&hint->mutex);
+
+        struct HintView view;
+        struct ExpertState *expert = hint->expert;
+        int row, col;
+
+        applyHintBoard(hint, board, sunk);
+        chooseShotExpert(expert, hint->applied, monotonicMicroseconds() + HINT_BUDGET_MS * 1000LL, &row, &col);
+
+        double total = expert->counted ? expert->exact.total : expert->total;
+        double *hit = expert->counted ? expert->exact.hit : expert->hit;
+
+        for (int cell = 0; cell < CELLS; cell++)
+            view.odds[cell] = total > 0 ? hit[cell] / total : 0;
+
+        view.best = hint->applied[row][col] == ' ' ? (row * BOARD_SIZE) + col : -1;
+        view.exact = expert->counted;
+
+        lockMutex(&hint->mutex);
+        hint->view = view;
+        hint->viewVersion = version;
+        hint->ready = true;
+    }
+
+    unlockMutex(&hint->mutex);
+
+    return NULL;
+}
+
+/*
+    Lets the hint's expert see the guesses made on the board since it last looked at it.
+
+    Parameters
+    ----------
+    `struct Hint *hint`:
+        The hint.
+
+    `char board[BOARD_SIZE][BOARD_SIZE]`:
+        The player's action board.
+
+    `bool sunk[SHIPS]`:
+        The ships the player has sunk.
+*/
+void applyHintBoard(struct Hint *hint, char board[BOARD_SIZE][BOARD_SIZE], bool sunk[SHIPS])
+{
+    int anyHit = -1;
+
+    for (int cell = 0; cell < CELLS; cell++)
+    {
+        char mark = board[cell / BOARD_SIZE][cell % BOARD_SIZE];
+
+        anyHit = mark == 'X' ? cell : anyHit;
+
+        if (hint->applied[cell / BOARD_SIZE][cell % BOARD_SIZE] != ' ' || (mark != 'X' && mark != 'O'))
+            continue;
+
+        hint->applied[cell / BOARD_SIZE][cell % BOARD_SIZE] = mark;
+        observeShotExpert(hint->expert, cell / BOARD_SIZE, cell % BOARD_SIZE, mark == 'X' ? 'H' : 'M', '\0');
+    }
+
+    // which hit sank a ship is not on the board, but the expert only needs a hit to tell it the ship is sunk
+    for (int i = 0; i < SHIPS; i++)
+    {
+        if (sunk[i] && !hint->appliedSunk[i] && anyHit != -1)
+        {
+            hint->appliedSunk[i] = true;
+            observeShotExpert(hint->expert, anyHit / BOARD_SIZE, anyHit % BOARD_SIZE, 'H', getShipIcon(i));
+        }
+    }
+}
@@ -0,0 +1,724 @@
+/*
+
+File Name: latency.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains a benchmark of how quickly the game answers a player, measured the way a player would see it: the
+    game is started under a pseudo-terminal, as if it were run in a terminal, and complete games against the
+    CPU and between two players are typed into it, one line at a time.
+
+    The benchmark reads everything the game writes to the terminal and waits for one of the prompts it knows,
+    answering it with the line a player would type: a fixed fleet, guesses going over the board cell by cell and
+    an empty line whenever the game asks for ENTER. The time from a line being written to the terminal until the
+    next prompt has been read in full is taken as the latency of that line, so that it covers the game reading
+    the line, doing what it asks for and drawing the whole frame that follows. Lines are timed by what they are
+    (a choice in a menu, a name, a ship placement, a guess or an empty line) and by whether the game is played
+    against the CPU or between two players, and the number of bytes written between two turn menus is taken as
+    the size of a turn. Once every game has been played, the 50th, 90th and 99th percentile and the largest of
+    each are printed.
+
+    Lines are typed whole rather than a key at a time, as the game reads what is typed a line at a time and a
+    key pressed before ENTER is never seen by it. Echo is turned off on the terminal, so that only what the game
+    writes is counted. The game is run in a new directory of its own, removed once it has exited, so that the
+    game it saves while being played is never written over one the player has saved in their own directory.
+
+    Pseudo-terminals are not available on Windows, and neither is the benchmark.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. latency.h
+    2. timing.h
+    3. snapshot.h
+
+    STRUCTS
+    -------
+    1. LatencySamples
+    2. LatencyBench
+
+    FUNCTIONS (global)
+    ------------------
+    bool runLatencyBenchmark(char *program, int games)
+
+    FUNCTIONS (local)
+    -----------------
+    1. bool startUnderTerminal(struct LatencyBench *bench, char *program)
+    2. bool playLatencyGames(struct LatencyBench *bench, int games)
+    3. int waitForPrompt(struct LatencyBench *bench)
+    4. bool answerPrompt(struct LatencyBench *bench, char *line, LatencyStep step)
+    5. void addLatencySample(struct LatencySamples *samples, long long value)
+    6. int compareSamples(const void *first, const void *second)
+    7. void printLatencyRow(char *label, struct LatencySamples *samples, double scale)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _XOPEN_SOURCE 700
+#endif
+
+#include <latency.h>
+#include <timing.h>
+#include <snapshot.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <termios.h>
+    #include <unistd.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+#endif
+
+// prompts the benchmark answers, as written by the game, only as much of each as is the same every time
+char *_latencyPrompts[LATENCY_PROMPTS] = {
+    "Enter choice: ",
+    "Enter difficulty: ",
+    "Do you want to go first? (Y/N): ",
+    "'s name: ",
+    "Which piece do you want to place? (Type in the first letter of the piece): ",
+    "Enter starting position (ex: A5): ",
+    "Enter ending position (ex: A5): ",
+    "Press ENTER to continue...",
+    " play...",
+    "Enter your guess (ex: A5): ",
+    "Play again? (Y/N): "
+};
+
+// index of each prompt in _latencyPrompts
+enum {
+    PROMPT_CHOICE,
+    PROMPT_DIFFICULTY,
+    PROMPT_FIRST,
+    PROMPT_NAME,
+    PROMPT_PIECE,
+    PROMPT_START,
+    PROMPT_END,
+    PROMPT_CONTINUE,
+    PROMPT_NEXT_PLAYER,
+    PROMPT_GUESS,
+    PROMPT_AGAIN
+};
+
+// names of the kinds of lines, in the order of LatencyStep
+char *_latencyStepNames[STEP_KINDS] = { "menu", "name", "placement", "guess", "continue" };
+
+/*
+    LatencySamples struct, contains the values measured for one kind of line. Contains:
+    - long long *values: the values, in the order they were measured.
+    - int count: number of values.
+    - int capacity: number of values there is room for in values.
+*/
+struct LatencySamples {
+    long long *values;
+    int count;
+    int capacity;
+};
+
+/*
+    LatencyBench struct, contains the state of the benchmark. Contains:
+    - int terminal: the pseudo-terminal the game runs under, the side the benchmark reads and writes.
+    - long pid: process ID of the game.
+    - char directory[]: directory the game is run in, made from LATENCY_DIRECTORY.
+    - char *buffer: what the game has written and the benchmark has not yet gone through, LATENCY_BUFFER_BYTES
+      long and ending in a '\0'.
+    - size_t used: number of bytes of buffer used.
+    - char *frame: everything the game wrote up to and including the last prompt found.
+    - long long sent: time the last line was written to the terminal, in microseconds, -1 if it is not timed.
+    - LatencyStep step: kind of the last line written.
+    - bool vsCPU: whether the game being played is against the CPU.
+    - long long turnBytes: number of bytes read since the last turn menu.
+    - bool inTurn: whether a turn menu has been read in the game being played.
+    - struct LatencySamples latencies[2][STEP_KINDS]: latency of every line, in microseconds, against the CPU
+      and between two players.
+    - struct LatencySamples turns[2]: size of every turn, in bytes, against the CPU and between two players.
+*/
+struct LatencyBench {
+    int terminal;
+    long pid;
+    char directory[sizeof(LATENCY_DIRECTORY)];
+    char *buffer;
+    size_t used;
+    char *frame;
+    long long sent;
+    LatencyStep step;
+    bool vsCPU;
+    long long turnBytes;
+    bool inTurn;
+    struct LatencySamples latencies[2][STEP_KINDS];
+    struct LatencySamples turns[2];
+};
+
+bool startUnderTerminal(struct LatencyBench *bench, char *program);
+bool playLatencyGames(struct LatencyBench *bench, int games);
+int waitForPrompt(struct LatencyBench *bench);
+bool answerPrompt(struct LatencyBench *bench, char *line, LatencyStep step);
+void addLatencySample(struct LatencySamples *samples, long long value);
+int compareSamples(const void *first, const void *second);
+void printLatencyRow(char *label, struct LatencySamples *samples, double scale);
+
+/*
+    Plays games on a copy of the game run under a pseudo-terminal and prints how long it took to answer every
+    kind of line typed. See the top of this file for how.
+
+    Parameters
+    ----------
+    `char *program`:
+        Path of the game's executable.
+
+    `int games`:
+        Number of games to play, every other one against the CPU, starting with one.
+
+    Returns
+    -------
+    Returns `true` if every game was played, else it returns `false`.
+*/
+bool runLatencyBenchmark(char *program, int games)
+{
+#ifdef _WIN32
+    (void) program;
+    (void) games;
+    printf("The latency benchmark is not available on Windows.\n");
+    return false;
+#else
+    struct LatencyBench bench = { .terminal = -1, .pid = -1, .sent = -1 };
+
+    bench.buffer = (char *) malloc(LATENCY_BUFFER_BYTES + 1);
+    bench.frame = (char *) malloc(LATENCY_BUFFER_BYTES + 1);
+
+    if (bench.buffer == NULL || bench.frame == NULL)
+    {
+        printf("Not enough memory to run the benchmark.\n");
+        free(bench.buffer);
+        free(bench.frame);
+        return false;
+    }
+
+    bool played = false;
+
+    if (startUnderTerminal(&bench, program))
+    {
+        played = playLatencyGames(&bench, games);
+        close(bench.terminal);
+
+        // a game that has not exited by now is stuck, and is not waited on any longer
+        if (!played)
+            kill((pid_t) bench.pid, SIGKILL);
+
+        int status;
+
+        waitpid((pid_t) bench.pid, &status, 0);
+        played = played && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+        // a game left unfinished is still saved in the directory, which has to be empty to be removed
+        char path[sizeof(bench.directory) + sizeof(SNAPSHOT_PATH) + 8];
+
+        snprintf(path, sizeof(path), "%s/%s", bench.directory, SNAPSHOT_PATH);
+        remove(path);
+        snprintf(path, sizeof(path), "%s/%s.tmp", bench.directory, SNAPSHOT_PATH);
+        remove(path);
+        rmdir(bench.directory);
+    }
+    else
+        printf("Could not start %s under a pseudo-terminal.\n", program);
+
+    if (played)
+    {
+        printf("\nLatency of every line typed into %s, from the line being written until the next prompt was read, over %d games:\n",
+               program, games);
+        printf("%-24s %8s %10s %10s %10s %10s\n", "", "lines", "p50 (ms)", "p90 (ms)", "p99 (ms)", "max (ms)");
+
+        for (int i = 0; i < 2; i++)
+        {
+            for (int j = 0; j < STEP_KINDS; j++)
+            {
+                char label[32];
+
+                snprintf(label, sizeof(label), "%s %s", i == 0 ? "vs CPU" : "vs player", _latencyStepNames[j]);
+                printLatencyRow(label, &bench.latencies[i][j], 1000.0);
+            }
+        }
+
+        printf("\nBytes written per turn:\n");
+        printf("%-24s %8s %10s %10s %10s %10s\n", "", "turns", "p50", "p90", "p99", "max");
+        printLatencyRow("vs CPU", &bench.turns[0], 1.0);
+        printLatencyRow("vs player", &bench.turns[1], 1.0);
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < STEP_KINDS; j++)
+            free(bench.latencies[i][j].values);
+
+        free(bench.turns[i].values);
+    }
+
+    free(bench.buffer);
+    free(bench.frame);
+
+    return played;
+#endif
+}
+
+#ifndef _WIN32
+
+/*
+    Starts the game with a new pseudo-terminal as its standard input and output, in a new directory.
+
+    Parameters
+    ----------
+    `struct LatencyBench *bench`:
+        The benchmark, whose terminal, pid and directory are set.
+
+    `char *program`:
+        Path of the game's executable.
+
+    Returns
+    -------
+    Returns `true` if the game was started, else it returns `false`.
+*/
+bool startUnderTerminal(struct LatencyBench *bench, char *program)
+{
+    int terminal = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (terminal < 0)
+        return false;
+
+    char *name = grantpt(terminal) == 0 && unlockpt(terminal) == 0 ? ptsname(terminal) : NULL;
+
+    if (name == NULL)
+    {
+        close(terminal);
+        return false;
+    }
+
+    // the program is found before the game is moved out of the directory the path may be relative to
+    char *executable = realpath(program, NULL);
+
+    strcpy(bench->directory, LATENCY_DIRECTORY);
+
+    if (executable == NULL || mkdtemp(bench->directory) == NULL)
+    {
+        free(executable);
+        close(terminal);
+        return false;
+    }
+
+    fflush(stdout); // or the child would print whatever the benchmark has not printed yet
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        // a new session, so that the pseudo-terminal becomes the game's controlling terminal
+        setsid();
+        close(terminal);
+
+        int player = open(name, O_RDWR);
+
+        if (player < 0)
+            _exit(127);
+
+        struct termios settings;
+
+        if (tcgetattr(player, &settings) == 0)
+        {
+            settings.c_lflag &= ~(tcflag_t) ECHO;
+            tcsetattr(player, TCSANOW, &settings);
+        }
+
+        dup2(player, STDIN_FILENO);
+        dup2(player, STDOUT_FILENO);
+        dup2(player, STDERR_FILENO);
+
+        if (player > STDERR_FILENO)
+            close(player);
+
+        if (chdir(bench->directory) != 0)
+            _exit(127);
+
+        execl(executable, program, (char *) NULL);
+        _exit(127);
+    }
+
+    free(executable);
+
+    if (pid < 0)
+    {
+        rmdir(bench->directory);
+        close(terminal);
+        return false;
+    }
+
+    bench->terminal = terminal;
+    bench->pid = (long) pid;
+
+    return true;
+}
+
+/*
+    Answers every prompt of the game until the given number of games have been played, timing every line.
+
+    Parameters
+    ----------
+    `struct LatencyBench *bench`:
+        The benchmark, whose game has been started.
+
+    `int games`:
+        Number of games to play.
+
+    Returns
+    -------
+    Returns `true` if every game was played, else it returns `false`.
+*/
+bool playLatencyGames(struct LatencyBench *bench, int games)
+{
+    int played = 0, placed = 0, guesses[2] = { 0, 0 };
+    char line[16];
+
+    while (true)
+    {
+        int prompt = waitForPrompt(bench);
+
+        if (prompt < 0)
+        {
+            printf("%s prompt was not shown within %d ms, or the game exited, after:\n%s\n", played == 0 ? "The first" : "The next",
+                   LATENCY_TIMEOUT_MS, bench->frame);
+            return false;
+        }
+
+        switch (prompt)
+        {
+            case PROMPT_CHOICE:
+                if (strstr(bench->frame, "Play Turn") != NULL)
+                {
+                    // a turn is everything written from one turn menu to the next
+                    if (bench->inTurn)
+                        addLatencySample(&bench->turns[bench->vsCPU ? 0 : 1], bench->turnBytes);
+
+                    bench->inTurn = true;
+                    bench->turnBytes = 0;
+
+                    if (!answerPrompt(bench, "1", STEP_MENU))
+                        return false;
+                }
+                else
+                {
+                    bench->vsCPU = played % 2 == 0;
+                    bench->inTurn = false;
+                    placed = 0;
+                    guesses[0] = guesses[1] = 0;
+
+                    if (!answerPrompt(bench, bench->vsCPU ? "2" : "1", STEP_MENU))
+                        return false;
+                }
+
+                break;
+
+            case PROMPT_DIFFICULTY:
+                if (!answerPrompt(bench, "2", STEP_MENU))
+                    return false;
+
+                break;
+
+            case PROMPT_FIRST:
+                if (!answerPrompt(bench, "Y", STEP_MENU))
+                    return false;
+
+                break;
+
+            case PROMPT_NAME:
+                if (!answerPrompt(bench, "Bench", STEP_NAME))
+                    return false;
+
+                break;
+
+            case PROMPT_PIECE:
+            case PROMPT_START:
+            case PROMPT_END:
+            {
+                // every ship is placed down its own column from the top row, carrier first
+                Ships ship = (Ships) (placed / 3 % SHIPS);
+
+                if (prompt == PROMPT_PIECE)
+                    snprintf(line, sizeof(line), "%c", getShipIcon(ship));
+                else
+                    snprintf(line, sizeof(line), "%c%d", 'A' + (int) ship, prompt == PROMPT_START ? 1 : getShipLength(ship));
+
+                placed++;
+
+                if (!answerPrompt(bench, line, STEP_PLACEMENT))
+                    return false;
+
+                break;
+            }
+
+            case PROMPT_CONTINUE:
+            case PROMPT_NEXT_PLAYER:
+                if (!answerPrompt(bench, "", STEP_CONTINUE))
+                    return false;
+
+                break;
+
+            case PROMPT_GUESS:
+            {
+                // every player guesses the cells of the board in order, row after row
+                int player = strstr(bench->frame, "Player 2's turn") != NULL ? 1 : 0;
+                int cell = guesses[player]++ % 100;
+
+                snprintf(line, sizeof(line), "%c%d", 'A' + cell % 10, cell / 10 + 1);
+
+                if (!answerPrompt(bench, line, STEP_GUESS))
+                    return false;
+
+                break;
+            }
+
+            case PROMPT_AGAIN:
+                played++;
+
+                if (played == games)
+                {
+                    // the game exits once this line is read, so there is no prompt to time it by, and the terminal is
+                    // read until it closes rather than closed under the game before the line is read
+                    if (!answerPrompt(bench, "N", STEP_MENU))
+                        return false;
+
+                    bench->sent = -1;
+
+                    return waitForPrompt(bench) < 0;
+                }
+
+                if (!answerPrompt(bench, "Y", STEP_MENU))
+                    return false;
+
+                break;
+        }
+    }
+}
+
+/*
+    Reads what the game writes until one of the prompts in _latencyPrompts has been read in full, and times the
+    last line written by it.
+
+    Parameters
+    ----------
+    `struct LatencyBench *bench`:
+        The benchmark, whose frame is set to everything read up to and including the prompt.
+
+    Returns
+    -------
+    Returns the index of the prompt in _latencyPrompts, or -1 if none was read within LATENCY_TIMEOUT_MS or the
+    game exited.
+*/
+int waitForPrompt(struct LatencyBench *bench)
+{
+    long long deadline = monotonicMicroseconds() + LATENCY_TIMEOUT_MS * 1000LL;
+
+    while (true)
+    {
+        char *first = NULL;
+        int prompt = -1;
+
+        bench->buffer[bench->used] = '\0';
+
+        // the prompt read first is the one answered, as the game waits on it before writing anything else
+        for (int i = 0; i < LATENCY_PROMPTS; i++)
+        {
+            char *found = strstr(bench->buffer, _latencyPrompts[i]);
+
+            if (found != NULL && (first == NULL || found < first))
+            {
+                first = found;
+                prompt = i;
+            }
+        }
+
+        if (prompt >= 0)
+        {
+            long long now = monotonicMicroseconds();
+            size_t end = (size_t) (first - bench->buffer) + strlen(_latencyPrompts[prompt]);
+
+            if (bench->sent >= 0)
+                addLatencySample(&bench->latencies[bench->vsCPU ? 0 : 1][bench->step], now - bench->sent);
+
+            memcpy(bench->frame, bench->buffer, end);
+            bench->frame[end] = '\0';
+            memmove(bench->buffer, bench->buffer + end, bench->used - end);
+            bench->used -= end;
+
+            return prompt;
+        }
+
+        // a frame longer than the buffer cannot hold a prompt but in its last bytes
+        if (bench->used == LATENCY_BUFFER_BYTES)
+        {
+            memmove(bench->buffer, bench->buffer + LATENCY_BUFFER_BYTES / 2, LATENCY_BUFFER_BYTES / 2);
+            bench->used = LATENCY_BUFFER_BYTES / 2;
+        }
+
+        long long left = deadline - monotonicMicroseconds();
+
+        if (left <= 0)
+        {
+            strcpy(bench->frame, bench->buffer);
+            return -1;
+        }
+
+        struct pollfd ready = { .fd = bench->terminal, .events = POLLIN };
+
+        if (poll(&ready, 1, (int) ((left + 999) / 1000)) < 0 && errno != EINTR)
+            return -1;
+
+        if (ready.revents == 0)
+            continue;
+
+        ssize_t count = read(bench->terminal, bench->buffer + bench->used, LATENCY_BUFFER_BYTES - bench->used);
+
+        if (count < 0 && (errno == EINTR || errno == EAGAIN))
+            continue;
+
+        // the terminal reads as closed once the game has exited
+        if (count <= 0)
+        {
+            strcpy(bench->frame, bench->buffer);
+            return -1;
+        }
+
+        bench->used += (size_t) count;
+        bench->turnBytes += count;
+    }
+}
+
+/*
+    Types a line into the game, starting the time of the line.
+
+    Parameters
+    ----------
+    `struct LatencyBench *bench`:
+        The benchmark.
+
+    `char *line`:
+        The line, without its newline.
+
+    `LatencyStep step`:
+        Kind of the line.
+
+    Returns
+    -------
+    Returns `true` if the line was written, else it returns `false`.
+*/
+bool answerPrompt(struct LatencyBench *bench, char *line, LatencyStep step)
+{
+    char typed[32];
+    int length = snprintf(typed, sizeof(typed), "%s\n", line);
+
+    bench->step = step;
+    bench->sent = monotonicMicroseconds();
+
+    for (int written = 0; written < length;)
+    {
+        ssize_t count = write(bench->terminal, typed + written, (size_t) (length - written));
+
+        if (count < 0 && errno == EINTR)
+            continue;
+
+        if (count <= 0)
+        {
+            printf("Could not type into the game.\n");
+            return false;
+        }
+
+        written += (int) count;
+    }
+
+    return true;
+}
+
+/*
+    Adds a value to a set of samples, making room for it if needed.
+
+    Parameters
+    ----------
+    `struct LatencySamples *samples`:
+        The samples.
+
+    `long long value`:
+        The value.
+*/
+void addLatencySample(struct LatencySamples *samples, long long value)
+{
+    if (samples->count == samples->capacity)
+    {
+        int capacity = samples->capacity == 0 ? 256 : samples->capacity * 2;
+        long long *values = (long long *) realloc(samples->values, capacity * sizeof(long long));
+
+        // a sample that does not fit is dropped rather than the benchmark
+        if (values == NULL)
+            return;
+
+        samples->values = values;
+        samples->capacity = capacity;
+    }
+
+    samples->values[samples->count++] = value;
+}
+
+/*
+    Compares two samples for qsort, putting the smaller one first.
+*/
+int compareSamples(const void *first, const void *second)
+{
+    long long a = *(const long long *) first, b = *(const long long *) second;
+
+    return (a > b) - (a < b);
+}
+
+/*
+    Prints the percentiles of a set of samples on one line.
+
+    Parameters
+    ----------
+    `char *label`:
+        What the samples are of.
+
+    `struct LatencySamples *samples`:
+        The samples, which are sorted.
+
+    `double scale`:
+        What every value is divided by before it is printed.
+*/
+void printLatencyRow(char *label, struct LatencySamples *samples, double scale)
+{
+    if (samples->count == 0)
+    {
+        printf("%-24s %8d %10s %10s %10s %10s\n", label, 0, "-", "-", "-", "-");
+        return;
+    }
+
+    qsort(samples->values, samples->count, sizeof(long long), compareSamples);
+
+    // the nearest-rank percentile, the smallest value with at least that share of the samples at or below it
+    double percentiles[3] = { 0.5, 0.9, 0.99 };
+    long long values[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        int rank = (int) (percentiles[i] * samples->count + 0.999999);
+
+        values[i] = samples->values[(rank < 1 ? 1 : rank) - 1];
+    }
+
+    // values that are scaled down are shown with three decimals, the others as they are
+    int decimals = scale > 1.0 ? 3 : 0;
+
+    printf("%-24s %8d %10.*f %10.*f %10.*f %10.*f\n", label, samples->count, decimals, values[0] / scale, decimals,
+           values[1] / scale, decimals, values[2] / scale, decimals, samples->values[samples->count - 1] / scale);
+}
+
+#endif
@@ -0,0 +1,288 @@
+/*
+
+File Name: layout.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the building blocks shared by the CPU strategies that reason about where the opponent's ships can
+    be: every placement of every ship as a mask of cells, and a random number generator that each strategy
+    owns.
+
+    INCLUDES (user-defined)
+    -----------------------
+    layout.h
+
+    GLOBAL VARIABLES
+    ----------------
+    1. struct Placement _placements[SHIPS][MAX_PLACEMENTS]
+    2. int _placementCounts[SHIPS]
+    3. short _placementIndices[SHIPS][2][CELLS]
+
+    FUNCTIONS (global)
+    ------------------
+    1. void initPlacements(void)
+    2. int getPlacements(Ships ship, const struct Placement **placements)
+    3. int findPlacement(Ships ship, int row, int col, bool vertical)
+    4. void drawFleet(struct Random *random, unsigned char fleet[SHIPS])
+    5. void placeFleet(struct Player *player, unsigned char fleet[SHIPS])
+    6. struct CellMask maskFromBoard(char board[BOARD_SIZE][BOARD_SIZE], char icon)
+    7. void seedRandom(struct Random *random, unsigned long long seed)
+    8. unsigned int nextRandom(struct Random *random, unsigned int bound)
+    9. unsigned long long nextSeed(struct Random *random)
+    10. unsigned long long randomSeed(void)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <layout.h>
+#include <stdlib.h>
+
+// every placement of every ship, filled in by initPlacements
+struct Placement _placements[SHIPS][MAX_PLACEMENTS];
+int _placementCounts[SHIPS] = { 0 };
+// index of the placement of every ship starting at every cell in either direction, -1 if it does not fit
+short _placementIndices[SHIPS][2][CELLS];
+
+/*
+    Fills in the placements of every ship. Must be called before any thread uses getPlacements, initCPUState
+    calls it.
+*/
+void initPlacements()
+{
+    if (_placementCounts[0] != 0)
+        return;
+
+    for (int ship = 0; ship < SHIPS; ship++)
+    {
+        int length = getShipLength(ship);
+
+        for (int i = 0; i < CELLS; i++)
+            _placementIndices[ship][0][i] = _placementIndices[ship][1][i] = -1;
+
+        for (int vertical = 0; vertical < 2; vertical++)
+        {
+            for (int row = 0; row + (vertical ? length - 1 : 0) < BOARD_SIZE; row++)
+            {
+                for (int col = 0; col + (vertical ? 0 : length - 1) < BOARD_SIZE; col++)
+                {
+                    _placementIndices[ship][vertical][(row * 10) + col] = _placementCounts[ship];
+
+                    struct Placement *placement = &_placements[ship][_placementCounts[ship]++];
+
+                    placement->mask.bits[0] = placement->mask.bits[1] = 0;
+                    placement->first = (row * 10) + col;
+                    placement->length = length;
+                    placement->vertical = vertical;
+
+                    for (int i = 0; i < length; i++)
+                        maskSet(&placement->mask, placement->first + (vertical ? i * 10 : i));
+                }
+            }
+        }
+    }
+}
+
+/*
+    Gives every placement of the given ship.
+
+    Parameters
+    ----------
+    `Ships ship`:
+        The ship.
+
+    `const struct Placement **placements`:
+        Stores the array of placements.
+
+    Returns
+    -------
+    Returns the number of placements.
+*/
+int getPlacements(Ships ship, const struct Placement **placements)
+{
+    initPlacements();
+    *placements = _placements[ship];
+
+    return _placementCounts[ship];
+}
+
+/*
+    Finds the placement of a ship with the given top-left cell and direction.
+
+    Parameters
+    ----------
+    `Ships ship`:
+        The ship.
+
+    `int row`:
+        Row of the top-left cell, may lie off the board.
+
+    `int col`:
+        Column of the top-left cell, may lie off the board.
+
+    `bool vertical`:
+        Whether the ship runs down from the cell, instead of to the right.
+
+    Returns
+    -------
+    Returns the index of the placement in the array given by getPlacements, or -1 if the ship does not fit on
+    the board there.
+*/
+int findPlacement(Ships ship, int row, int col, bool vertical)
+{
+    initPlacements();
+
+    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE)
+        return -1;
+
+    return _placementIndices[ship][vertical][(row * 10) + col];
+}
+
+/*
+    Draws a random fleet layout: every ship in turn is given one of the placements that do not overlap the ships
+    placed before it, each as likely as the others.
+
+    Parameters
+    ----------
+    `struct Random *random`:
+        Generator used to draw the layout.
+
+    `unsigned char fleet[SHIPS]`:
+        Stores the placement of every ship, an index into getPlacements.
+*/
+void drawFleet(struct Random *random, unsigned char fleet[SHIPS])
+{
+    struct CellMask occupied = { { 0, 0 } };
+    unsigned char fits[MAX_PLACEMENTS];
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        int count = getPlacements(i, &placements), options = 0;
+
+        // ships are placed longest first, so the shorter ones always have somewhere left to go
+        for (int j = 0; j < count; j++)
+        {
+            if (!masksOverlap(placements[j].mask, occupied))
+                fits[options++] = j;
+        }
+
+        fleet[i] = fits[nextRandom(random, options)];
+        occupied = maskUnion(occupied, placements[fleet[i]].mask);
+    }
+}
+
+/*
+    Places a fleet layout on the given player's board, which must be empty.
+
+    Parameters
+    ----------
+    `struct Player *player`:
+        The player whose ships are placed.
+
+    `unsigned char fleet[SHIPS]`:
+        The placement of every ship, an index into getPlacements.
+*/
+void placeFleet(struct Player *player, unsigned char fleet[SHIPS])
+{
+    for (int i = 0; i < SHIPS; i++)
+    {
+        const struct Placement *placements;
+        getPlacements(i, &placements);
+
+        const struct Placement *placement = &placements[fleet[i]];
+        int start[2] = { placement->first / 10, placement->first % 10 };
+        int end[2] = {
+            start[0] + (placement->vertical ? placement->length - 1 : 0),
+            start[1] + (placement->vertical ? 0 : placement->length - 1)
+        };
+
+        placeShipOnBoard(player, start, end, i);
+    }
+}
+
+/*
+    Returns the cells of the given board that contain the given icon.
+*/
+struct CellMask maskFromBoard(char board[BOARD_SIZE][BOARD_SIZE], char icon)
+{
+    struct CellMask mask = { { 0, 0 } };
+
+    for (int i = 0; i < CELLS; i++)
+    {
+        if (board[i / BOARD_SIZE][i % BOARD_SIZE] == icon)
+            maskSet(&mask, i);
+    }
+
+    return mask;
+}
+
+/*
+    Seeds the given random number generator.
+
+    Parameters
+    ----------
+    `struct Random *random`:
+        The generator to seed.
+
+    `unsigned long long seed`:
+        The seed, any value.
+*/
+void seedRandom(struct Random *random, unsigned long long seed)
+{
+    // splitmix64, so that close seeds still give unrelated states
+    seed += 0x9E3779B97F4A7C15ULL;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+    seed ^= seed >> 31;
+
+    random->state = seed != 0 ? seed : 1;
+}
+
+/*
+    Returns a random number from 0 to bound - 1, using xorshift64*.
+
+    Parameters
+    ----------
+    `struct Random *random`:
+        The generator to use.
+
+    `unsigned int bound`:
+        Upper bound of the number, must be greater than 0.
+*/
+unsigned int nextRandom(struct Random *random, unsigned int bound)
+{
+    random->state ^= random->state >> 12;
+    random->state ^= random->state << 25;
+    random->state ^= random->state >> 27;
+
+    return (unsigned int) (((random->state * 0x2545F4914F6CDD1DULL) >> 32) * bound >> 32);
+}
+
+/*
+    Returns a seed drawn from the given random number generator, to seed another generator or a CPU with.
+
+    Parameter
+    ---------
+    `struct Random *random`:
+        The generator to use.
+*/
+unsigned long long nextSeed(struct Random *random)
+{
+    unsigned long long high = nextRandom(random, 1U << 31);
+
+    return (high << 32) ^ nextRandom(random, 1U << 31);
+}
+
+/*
+    Returns a seed drawn from rand, which the program seeds from the time it starts, for work that is not meant to
+    be repeated.
+*/
+unsigned long long randomSeed()
+{
+    unsigned long long high = (unsigned long long) rand() << 32;
+    unsigned long long middle = (unsigned long long) rand() << 16;
+
+    return high ^ middle ^ (unsigned long long) rand();
+}
@@ -9,30 +9,263 @@ ________________________________________________________________________________
 
     INCLUDES (User-defined)
     -----------------------
-    game.h
+    1. game.h
+    2. replay.h
+    3. query.h
+    4. thread.h
+    5. spectate.h
+    6. plugin.h
+    7. arena.h
+    8. train.h
+    9. match.h
+    10. tune.h
+    11. tournament.h
+    12. game_log.h
+    13. notation.h
+    14. latency.h
+    15. trace.h
+    16. ffa.h
 
     FUNCTIONS (Local)
     ----------------
-    1. int main(void)
+    1. int main(int argc, char *argv[])
     2. int menuFunctionality(void)
     3. vod printBanner(void)
     4. void mainMenu(void)
     5. void chooseDifficulty(short *difficulty)
+    6. void printUsage(char *program)
 
 *Compiled using C99 standards*
 
 */
 
 #include <game.h>
+#include <replay.h>
+#include <query.h>
+#include <thread.h>
+#include <spectate.h>
+#include <plugin.h>
+#include <arena.h>
+#include <train.h>
+#include <match.h>
+#include <tune.h>
+#include <tournament.h>
+#include <game_log.h>
+#include <notation.h>
+#include <latency.h>
+#include <trace.h>
+#include <ffa.h>
 #include <ctype.h>
+#include <string.h>
 #include <time.h>
 
 void menuFunctionality(void);
 void chooseDifficulty(short *difficulty);
+void printUsage(char *program);
 
-int main()
+int main(int argc, char *argv[])
 {
+    char *queryPath = NULL, *query = NULL, *spectateAddress = NULL, *botName = NULL, *arenaSides[2] = { NULL, NULL };
+    int threads = countProcessors(), arenaGames = 0, pool = countProcessors();
+    long long trainingGames = 0, matchGames = 0, tuningGames = 0, tournamentGames = 0, ffaGames = 0;
+    int ffaPlayers = 0;
+    int workers = countProcessors(), shardGames = TOURNAMENT_SHARD_GAMES;
+    char *matchSides[2] = { NULL, NULL }, *tournamentSides[2] = { NULL, NULL }, *ffaCPUs = NULL;
+    MatchMetric matchMetric = MATCH_WINS;
+    GameMode arenaMode = CLASSIC;
+    LogSync logSync = LOG_SYNC_NONE;
+    char *logPath = NULL, *trainingPath = POLICY_TABLE_PATH;
+
+    struct HardParameters parameters = getHardParameters();
+
     srand((unsigned int) time(NULL));
+
+    if (loadHardParameters(HARD_PARAMETERS_PATH, &parameters))
+        setHardParameters(parameters);
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            setRecordPath(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            if (!startTrace(argv[++i]))
+            {
+                printf("Could not trace to %s.\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            char *path = argv[++i];
+
+            // the game to replay may follow the file, so that any game of a long log can be picked at once
+            runReplay(path, i + 1 < argc && isdigit((unsigned char) argv[i + 1][0]) ? atoll(argv[++i]) : 0);
+            return 0;
+        }
+        else if (strcmp(argv[i], "--export") == 0 && i + 2 < argc)
+        {
+            i += 2;
+            return exportNotation(argv[i - 1], argv[i]) ? 0 : 1;
+        }
+        else if (strcmp(argv[i], "--import") == 0 && i + 2 < argc)
+        {
+            i += 2;
+            return importNotation(argv[i - 1], argv[i]) ? 0 : 1;
+        }
+        else if (strcmp(argv[i], "--bench-latency") == 0 && i + 2 < argc && atoi(argv[i + 1]) > 0)
+        {
+            i += 2;
+            return runLatencyBenchmark(argv[i], atoi(argv[i - 1])) ? 0 : 1;
+        }
+        else if (strcmp(argv[i], "--query") == 0 && i + 2 < argc)
+        {
+            queryPath = argv[++i];
+            query = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+        {
+            threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--strategy") == 0 && i + 1 < argc)
+        {
+            if (loadStrategy(argv[++i]) == NULL)
+                return 1;
+        }
+        else if (strcmp(argv[i], "--spectate") == 0 && i + 1 < argc)
+        {
+            spectateAddress = argv[++i];
+        }
+        else if (strcmp(argv[i], "--bot") == 0 && i + 1 < argc)
+        {
+            botName = argv[++i];
+        }
+        else if (strcmp(argv[i], "--arena") == 0 && i + 3 < argc && atoi(argv[i + 1]) > 0)
+        {
+            arenaGames = atoi(argv[++i]);
+            arenaSides[0] = argv[++i];
+            arenaSides[1] = argv[++i];
+        }
+        else if (strcmp(argv[i], "--pool") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+        {
+            pool = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--salvo") == 0)
+        {
+            arenaMode = SALVO;
+        }
+        else if (strcmp(argv[i], "--match") == 0 && i + 3 < argc && atoll(argv[i + 1]) > 0)
+        {
+            matchGames = atoll(argv[++i]);
+            matchSides[0] = argv[++i];
+            matchSides[1] = argv[++i];
+        }
+        else if (strcmp(argv[i], "--ffa") == 0 && i + 3 < argc && atoll(argv[i + 1]) > 0)
+        {
+            ffaGames = atoll(argv[++i]);
+            ffaPlayers = atoi(argv[++i]);
+            ffaCPUs = argv[++i];
+        }
+        else if (strcmp(argv[i], "--tournament") == 0 && i + 3 < argc && atoll(argv[i + 1]) > 0)
+        {
+            tournamentGames = atoll(argv[++i]);
+            tournamentSides[0] = argv[++i];
+            tournamentSides[1] = argv[++i];
+        }
+        else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+        {
+            workers = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--shard") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+        {
+            shardGames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--metric") == 0 && i + 1 < argc && (strcmp(argv[i + 1], "wins") == 0 || strcmp(argv[i + 1], "shots") == 0))
+        {
+            matchMetric = strcmp(argv[++i], "wins") == 0 ? MATCH_WINS : MATCH_SHOTS;
+        }
+        else if (strcmp(argv[i], "--log") == 0 && i + 1 < argc)
+        {
+            logPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--log-sync") == 0 && i + 1 < argc && parseLogSync(argv[i + 1], &logSync))
+        {
+            i++;
+        }
+        else if (strcmp(argv[i], "--tune-hard") == 0 && i + 1 < argc && atoll(argv[i + 1]) > 1)
+        {
+            tuningGames = atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--train-policy") == 0 && i + 1 < argc && atoll(argv[i + 1]) > 0)
+        {
+            trainingGames = atoll(argv[++i]);
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                trainingPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cpu-budget-ms") == 0 && i + 1 < argc && isdigit((unsigned char) argv[i + 1][0]))
+        {
+            setCPUBudget(atoi(argv[++i]));
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    setLogPath(logPath, logSync);
+
+    if (query != NULL)
+        return runQuery(queryPath, query, threads) ? 0 : 1;
+
+    if (trainingGames > 0)
+        return runTraining(trainingGames, trainingPath, threads) ? 0 : 1;
+
+    if (botName != NULL)
+    {
+        Difficulty difficulty;
+        const struct Strategy *strategy;
+
+        if (!parseCPU(botName, &difficulty, &strategy))
+        {
+            printf("Unknown CPU \"%s\", expected easy, hard, expert, policy or plugin:NAME.\n", botName);
+            return 1;
+        }
+
+        return runBot(difficulty, strategy);
+    }
+
+    if (tuningGames > 0)
+        return runTuning(tuningGames, HARD_PARAMETERS_PATH, threads) ? 0 : 1;
+
+    if (tournamentGames > 0)
+        return runTournament(tournamentGames, tournamentSides, workers, shardGames, arenaMode) ? 0 : 1;
+
+    if (matchGames > 0)
+        return runMatch(matchGames, matchSides, matchMetric, threads, arenaMode) ? 0 : 1;
+
+    if (ffaGames > 0)
+        return runFreeForAll(ffaGames, ffaPlayers, ffaCPUs, threads) ? 0 : 1;
+
+    if (arenaGames > 0)
+        return runArena(arenaGames, arenaSides, pool, arenaMode) ? 0 : 1;
+
+    if (spectateAddress != NULL)
+    {
+        struct SpectatorServer *server = openSpectatorServer(spectateAddress);
+
+        if (server == NULL)
+        {
+            printf("Could not let spectators watch on %s.\n", spectateAddress);
+            return 1;
+        }
+
+        setSpectatorServer(server);
+    }
+
     menuFunctionality();
 
     return 0;
@@ -57,7 +290,7 @@ void printBanner()
 */
 void mainMenu()
 {
-    printf("\n1. Play PvP\n2. Play PvE\n3. Exit\n");
+    printf("\n1. Play PvP\n2. Play PvE\n3. Play PvP (Salvo)\n4. Play PvE (Salvo)\n5. Resume game\n6. Exit\n");
 }
 
 /*
@@ -82,23 +315,27 @@ void menuFunctionality()
                     "Enter only a number.", NULL
             ))
             {
+                GameMode mode = (choice == 3 || choice == 4) ? SALVO : CLASSIC;
+
                 switch (choice)
                 {
                     case 1:
+                    case 3:
                         createPlayer(1, false);
                         createPlayer(2, false);
                         clearScreen();
 
-                        keepPlaying = start(0, 0);
+                        keepPlaying = start(0, 0, mode);
 
                         break;
                     
                     case 2:
+                    case 4:
                     {
                         short difficulty;
                         chooseDifficulty(&difficulty);
 
-                        if (difficulty == 3)
+                        if (difficulty == 0)
                         {
                             printBanner();
                             mainMenu();
@@ -132,17 +369,26 @@ void menuFunctionality()
                         createPlayer(playerTurn, false);
                         clearScreen();
                         
-                        keepPlaying = start(playerTurn, difficulty == 1 ? EASY : HARD);
+                        keepPlaying = start(playerTurn, (Difficulty) difficulty, mode);
 
                         break;
                     }
 
-                    case 3: 
+                    case 5:
+                        if (!resumeGame(&keepPlaying))
+                        {
+                            printf("There is no saved game that can be resumed.\n");
+                            continue;
+                        }
+
+                        break;
+
+                    case 6: 
                         keepPlaying = false;
                         break;
 
                     default:
-                        printf("Enter only numbers between 1 - 3\n");
+                        printf("Enter only numbers between 1 - 6\n");
                         continue;
                 }
 
@@ -166,30 +412,120 @@ void menuFunctionality()
 }
 
 /*
-    Allows user to choose CPU difficulty.
+    Allows user to choose CPU difficulty. Every strategy loaded with --strategy is offered after the built-in
+    difficulties, and choosing one sets it as the CPU's strategy.
 
     Parameter
     ---------
     `short *difficulty`:
-        Stores the user's choice of difficulty.
+        Stores the user's choice of difficulty, 0 if they chose to go back.
 */
 void chooseDifficulty(short *difficulty)
 {
+    int firstStrategy = 5; // options before it are the built-in difficulties
+    int back = firstStrategy + countStrategies();
+
     printBanner();
-    printf("\nChoose difficulty:\n1. Easy\n2. Hard\n3. Go back\n");
+    printf("\nChoose difficulty:\n1. Easy\n2. Hard\n3. Expert\n4. Policy\n");
+
+    for (int i = 0; i < countStrategies(); i++)
+        printf("%d. %s\n", firstStrategy + i, getStrategy(i)->name);
+
+    printf("%d. Go back\n", back);
 
     while (1)
     {
         while (!checkInputValidity(
-            takeNInputWithPropmt("Enter difficulty: ", difficulty, SHORT, 1),
+            takeNInputWithPropmt("Enter difficulty: ", difficulty, SHORT, 2),
             NULL, "Enter only one number.", "Enter only a number.", NULL ));
         printf("Difficulty: %d\n", *difficulty);
-        if (*difficulty < 1 || *difficulty > 3)
+        if (*difficulty < 1 || *difficulty > back)
         {
-            printf("Enter only numbers from 1 - 3.\n");
+            printf("Enter only numbers from 1 - %d.\n", back);
             continue;
         }
 
         break;
     }
-}
\ No newline at end of file
+
+    if (*difficulty == back)
+    {
+        *difficulty = 0;
+    }
+    else if (*difficulty >= firstStrategy)
+    {
+        setCPUStrategy(getStrategy(*difficulty - firstStrategy));
+        *difficulty = PLUGIN;
+    }
+    else if (*difficulty == 4)
+    {
+        *difficulty = POLICY;
+    }
+}
+
+/*
+    Prints the command line options supported by the program.
+
+    Parameter
+    ---------
+    `char *program`:
+        Name with which the program was run.
+*/
+void printUsage(char *program)
+{
+    printf("Usage: %s [--trace FILE] [--record FILE] [--strategy NAME]... [--spectate ADDRESS] [--cpu-budget-ms N] [--replay FILE [GAME]] [--query FILE QUERY [--threads N]]\n", program);
+    printf("       %s --export RECORDS TEXT | --import TEXT RECORDS\n", program);
+    printf("       %s --bench-latency GAMES PROGRAM\n", program);
+    printf("       %s [--cpu-budget-ms N] --bot CPU\n", program);
+    printf("       %s [--threads N] --train-policy GAMES [FILE]\n", program);
+    printf("       %s [--threads N] --tune-hard GAMES\n", program);
+    printf("       %s [--cpu-budget-ms N] [--pool N] [--salvo] [--log FILE [--log-sync WHEN]] --arena GAMES PLAYER PLAYER\n", program);
+    printf("       %s [--cpu-budget-ms N] [--threads N] [--salvo] [--metric wins|shots] [--log FILE [--log-sync WHEN]] --match GAMES CPU CPU\n", program);
+    printf("       %s [--cpu-budget-ms N] [--threads N] --ffa GAMES PLAYERS CPU[,CPU]...\n", program);
+    printf("       %s [--cpu-budget-ms N] [--workers N] [--shard N] [--salvo] [--log FILE [--log-sync WHEN]] --tournament GAMES CPU CPU\n", program);
+    printf("  --trace FILE         write a timeline of the CPU's moves, drawing and waiting on input to FILE on\n");
+    printf("                       exit, as Chrome trace JSON to open in Perfetto, with any other option\n");
+    printf("  --record FILE        append every finished game to FILE\n");
+    printf("  --strategy NAME      offer the CPU strategy in NAME, or in %s/NAME%s, as a difficulty\n", STRATEGY_DIRECTORY, STRATEGY_SUFFIX);
+    printf("  --spectate ADDRESS   let spectators watch games on unix:PATH or tcp:[HOST:]PORT\n");
+    printf("  --cpu-budget-ms N    let the CPU think for at most N milliseconds per move (default %d)\n", DEFAULT_CPU_BUDGET_MS);
+    printf("  --replay FILE [GAME] replay game number GAME recorded in FILE, or a game chosen from a list\n");
+    printf("  --export RECORDS TEXT\n");
+    printf("                       write the games recorded in RECORDS to TEXT in plain-text notation\n");
+    printf("  --import TEXT RECORDS\n");
+    printf("                       append the games written in notation in TEXT to RECORDS\n");
+    printf("  --bench-latency GAMES PROGRAM\n");
+    printf("                       play GAMES games on PROGRAM under a pseudo-terminal, every other one against the\n");
+    printf("                       CPU, and print how long it took to answer every line typed\n");
+    printf("  --query FILE QUERY   answer QUERY over the games recorded in FILE, for example\n");
+    printf("                       \"median sunk1:C where difficulty=hard and cpu=2\"\n");
+    printf("  --threads N          number of threads a query, training, tuning, match or free-for-all runs on\n");
+    printf("  --bot CPU            play as a bot on standard input and output, CPU being easy, hard, expert,\n");
+    printf("                       policy or plugin:NAME\n");
+    printf("  --arena GAMES PLAYER PLAYER\n");
+    printf("                       play GAMES games between two players, each a CPU or bot:COMMAND for a bot\n");
+    printf("  --pool N             number of arena games played at the same time (default: one per processor)\n");
+    printf("  --salvo              play the arena, match or tournament games with the salvo rules\n");
+    printf("  --match GAMES CPU CPU\n");
+    printf("                       play at most GAMES games between two CPUs, stopping as soon as a sequential\n");
+    printf("                       test decides whether the first is stronger\n");
+    printf("  --metric wins|shots  compare the CPUs of a match on games won or on shots taken to sink the same\n");
+    printf("                       fleet (default wins)\n");
+    printf("  --ffa GAMES PLAYERS CPU[,CPU]...\n");
+    printf("                       simulate GAMES free-for-all games between PLAYERS CPUs (at most %d), the CPUs\n", FFA_MAX_PLAYERS);
+    printf("                       given taking the seats in turn, and print how every CPU placed; CPUs only, the\n");
+    printf("                       interactive game stays two-player\n");
+    printf("  --tournament GAMES CPU CPU\n");
+    printf("                       play GAMES games between two CPUs on worker processes, which are restarted if\n");
+    printf("                       they crash or hang\n");
+    printf("  --workers N          number of tournament worker processes (default: one per processor)\n");
+    printf("  --shard N            number of games handed to a tournament worker at a time (default %d)\n", TOURNAMENT_SHARD_GAMES);
+    printf("  --log FILE           append every arena, match or tournament game to FILE, as --record does\n");
+    printf("  --log-sync WHEN      put the log on disk after every batch written, when it is closed or never\n");
+    printf("                       (batch, close or none, default none)\n");
+    printf("  --train-policy GAMES [FILE]\n");
+    printf("                       train the policy CPU on GAMES games of self-play and write it to FILE\n");
+    printf("                       (default %s)\n", POLICY_TABLE_PATH);
+    printf("  --tune-hard GAMES    tune the choices of the hard CPU on GAMES fleets per setting and write them to\n");
+    printf("                       %s, which is read whenever the program starts\n", HARD_PARAMETERS_PATH);
+}
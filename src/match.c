@@ -0,0 +1,617 @@
+/*
+
+File Name: match.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the match, which compares two CPUs by playing games between them until a sequential probability
+    ratio test (SPRT) decides whether the first is stronger, so that a clear difference takes only as many games
+    as it needs to show, and only a close one takes the whole number given.
+
+    Games are played in batches of MATCH_BATCH_GAMES on every thread, the first share of each batch on the
+    calling thread, and the test is looked at after every batch. It weighs the hypothesis that the first player
+    is stronger by a margin against the hypothesis that it is no stronger at all, adding up the log of how much
+    likelier every game is under the first than under the second, and stops once the sum leaves the bounds set
+    by MATCH_ALPHA and MATCH_BETA, the chances of the test deciding wrongly either way.
+
+    On wins, a game counts as a win or a loss for the first player and the two hypotheses are win rates of
+    one half and of one half plus MATCH_WIN_MARGIN. On shots, every game draws one random fleet, which both
+    players sink on their own one shot at a time, and counts how many fewer shots the first took; the two
+    hypotheses are means of this of 0 and of MATCH_SHOT_MARGIN, taken as normally distributed with the variance
+    of the games played so far. Sinking the same fleet takes away the luck of the draw, so that shots decide
+    sooner than wins. The side moving first changes from one game to the next.
+
+    Matches are played between CPUs only, with the expert CPU given a share of the processors, and strategies
+    played on more than one thread have to keep no state outside of the state they create. On wins, every game
+    is logged if a log is set, each thread logging into a stage of its own.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. match.h
+    2. defence.h
+    3. expert.h
+    4. thread.h
+    5. timing.h
+    6. game_log.h
+    7. trace.h
+
+    STRUCTS
+    -------
+    1. MatchSide
+    2. MatchTally
+    3. MatchTask
+
+    FUNCTIONS (global)
+    ------------------
+    bool runMatch(long long games, char *sides[2], MatchMetric metric, int threads, GameMode mode)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *playBatch(void *argument)
+    2. int playMatchGame(struct MatchTask *task, int first)
+    3. int sinkFleet(struct MatchTask *task, int side, unsigned char fleet[SHIPS])
+    4. void setUpCPU(struct MatchTask *task, struct CPUState *cpu, int side, int turn)
+    5. void placeSide(struct MatchTask *task, struct Player *player, int side)
+    6. double logLikelihoodRatio(MatchMetric metric, struct MatchTally *tally)
+    7. void estimateStrength(MatchMetric metric, struct MatchTally *tally, double *value, double *error)
+    8. void printMatchResult(
+            char *sides[2], MatchMetric metric, struct MatchTally *tally, long long games, double ratio,
+            double seconds, int threads
+        )
+
+*Compiled using C99 standards*
+
+*/
+
+#include <match.h>
+#include <defence.h>
+#include <expert.h>
+#include <thread.h>
+#include <timing.h>
+#include <game_log.h>
+#include <trace.h>
+#include <math.h>
+
+/*
+    MatchSide struct, contains one of the two CPUs of a match. Contains:
+    - Difficulty difficulty: difficulty of the CPU.
+    - const struct Strategy *strategy: strategy of the CPU on plugin difficulty.
+    - char *name: the CPU as it was given, which its games are logged under.
+*/
+struct MatchSide {
+    Difficulty difficulty;
+    const struct Strategy *strategy;
+    char *name;
+};
+
+/*
+    MatchTally struct, contains what the games played so far came to. Contains:
+    - long long games: number of games played.
+    - long long wins: number of games won by the first player, on wins.
+    - long long shots[2]: total shots each player took to sink the fleets, on shots.
+    - double differences: sum of how many fewer shots the first player took than the second, on shots.
+    - double squares: sum of the squares of the same, on shots.
+*/
+struct MatchTally {
+    long long games;
+    long long wins;
+    long long shots[2];
+    double differences;
+    double squares;
+};
+
+/*
+    MatchTask struct, contains the games played by one thread in one batch. Contains:
+    - const struct MatchSide *sides: the two CPUs.
+    - MatchMetric metric: what the games are played for.
+    - GameMode mode: rules the games are played with, on wins.
+    - long long games: number of games to play.
+    - int first: side moving first in the first game.
+    - int threads: number of threads the expert CPU may think on.
+    - struct Random random: generator of the thread.
+    - struct MatchTally tally: what the games came to.
+    - struct LogStage *stage: stage of the thread the games are logged into, NULL if they are not logged.
+    - struct GameRecord *record: record of the game being played, when the games are logged.
+*/
+struct MatchTask {
+    const struct MatchSide *sides;
+    MatchMetric metric;
+    GameMode mode;
+    long long games;
+    int first;
+    int threads;
+    struct Random random;
+    struct MatchTally tally;
+    struct LogStage *stage;
+    struct GameRecord *record;
+};
+
+void *playBatch(void *argument);
+int playMatchGame(struct MatchTask *task, int first);
+int sinkFleet(struct MatchTask *task, int side, unsigned char fleet[SHIPS]);
+void setUpCPU(struct MatchTask *task, struct CPUState *cpu, int side, int turn);
+void placeSide(struct MatchTask *task, struct Player *player, int side);
+double logLikelihoodRatio(MatchMetric metric, struct MatchTally *tally);
+void estimateStrength(MatchMetric metric, struct MatchTally *tally, double *value, double *error);
+void printMatchResult(
+    char *sides[2], MatchMetric metric, struct MatchTally *tally, long long games, double ratio,
+    double seconds, int threads
+);
+
+/*
+    Plays games between two CPUs until the test decides whether the first is stronger, or until games have been
+    played, and prints the result. See the top of this file for how.
+
+    Parameters
+    ----------
+    `long long games`:
+        Most games to play.
+
+    `char *sides[2]`:
+        The CPUs, each easy, hard, expert, policy or plugin:NAME.
+
+    `MatchMetric metric`:
+        What the CPUs are compared on.
+
+    `int threads`:
+        Number of threads to play on, at most MATCH_MAX_THREADS are used.
+
+    `GameMode mode`:
+        Rules the games are played with, on wins. On shots the fleets are always sunk one shot at a time.
+
+    Returns
+    -------
+    Returns `true` if the games were played, else it returns `false`.
+*/
+bool runMatch(long long games, char *sides[2], MatchMetric metric, int threads, GameMode mode)
+{
+    struct MatchSide matchSides[2];
+    struct MatchTask tasks[MATCH_MAX_THREADS];
+    struct MatchTally tally = { 0 };
+    struct Random random;
+    struct GameLog *gameLog = NULL;
+    struct LogStage *stages[MATCH_MAX_THREADS] = { NULL };
+    struct GameRecord *records = NULL;
+    double lower = log(MATCH_BETA / (1 - MATCH_ALPHA)), upper = log((1 - MATCH_BETA) / MATCH_ALPHA), ratio = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (!parseCPU(sides[i], &matchSides[i].difficulty, &matchSides[i].strategy))
+        {
+            printf("Unknown CPU \"%s\", expected easy, hard, expert, policy or plugin:NAME.\n", sides[i]);
+            return false;
+        }
+
+        matchSides[i].name = sides[i];
+    }
+
+    initPlacements();
+    seedRandom(&random, randomSeed());
+    threads = threads < 1 ? 1 : (threads > MATCH_MAX_THREADS ? MATCH_MAX_THREADS : threads);
+
+    if (metric == MATCH_WINS && getLogPath() != NULL)
+    {
+        if ((gameLog = openGameLog()) == NULL)
+            return false;
+
+        bool opened = (records = (struct GameRecord *) malloc(threads * sizeof(struct GameRecord))) != NULL;
+
+        for (int i = 0; i < threads && opened; i++)
+            opened = (stages[i] = openLogStage(gameLog)) != NULL;
+
+        if (!opened)
+        {
+            printf("Could not allocate memory to log the games.\n");
+
+            for (int i = 0; i < threads && stages[i] != NULL; i++)
+                closeLogStage(stages[i]);
+
+            closeGameLog(gameLog);
+            free(records);
+            return false;
+        }
+    }
+
+    long long start = monotonicMicroseconds();
+
+    while (tally.games < games && ratio > lower && ratio < upper)
+    {
+        long long batch = games - tally.games < (long long) threads * MATCH_BATCH_GAMES ? games - tally.games : (long long) threads * MATCH_BATCH_GAMES;
+
+        for (int i = 0; i < threads; i++)
+        {
+            tasks[i] = (struct MatchTask) { .sides = matchSides, .metric = metric, .mode = mode, .stage = stages[i] };
+            tasks[i].record = records != NULL ? &records[i] : NULL;
+            tasks[i].games = (batch * (i + 1)) / threads - (batch * i) / threads;
+            tasks[i].first = (int) ((tally.games + (batch * i) / threads) % 2);
+            tasks[i].threads = countProcessors() / threads > 1 ? countProcessors() / threads : 1;
+            seedRandom(&tasks[i].random, nextSeed(&random));
+        }
+
+        runShares(playBatch, tasks, sizeof(struct MatchTask), threads);
+
+        for (int i = 0; i < threads; i++)
+        {
+            tally.games += tasks[i].tally.games;
+            tally.wins += tasks[i].tally.wins;
+            tally.shots[0] += tasks[i].tally.shots[0];
+            tally.shots[1] += tasks[i].tally.shots[1];
+            tally.differences += tasks[i].tally.differences;
+            tally.squares += tasks[i].tally.squares;
+        }
+
+        ratio = logLikelihoodRatio(metric, &tally);
+        printf("%lld games: log-likelihood ratio %.2f, deciding at %.2f or %.2f\n", tally.games, ratio, lower, upper);
+    }
+
+    printMatchResult(sides, metric, &tally, games, ratio, (monotonicMicroseconds() - start) / 1e6, threads);
+
+    if (gameLog == NULL)
+        return true;
+
+    for (int i = 0; i < threads; i++)
+        closeLogStage(stages[i]);
+
+    free(records);
+
+    if (!closeGameLog(gameLog))
+    {
+        printf("Could not write every game to %s.\n", getLogPath());
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Plays one thread's share of a batch of games. Runs on its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The MatchTask to run.
+*/
+void *playBatch(void *argument)
+{
+    struct MatchTask *task = (struct MatchTask *) argument;
+
+    for (long long i = 0; i < task->games; i++)
+    {
+        int first = (int) ((task->first + i) % 2);
+
+        if (task->metric == MATCH_WINS)
+        {
+            task->tally.wins += playMatchGame(task, first) == 0;
+        }
+        else
+        {
+            unsigned char fleet[SHIPS];
+            int shots[2];
+
+            drawFleet(&task->random, fleet);
+
+            for (int side = 0; side < 2; side++)
+            {
+                shots[side] = sinkFleet(task, side, fleet);
+                task->tally.shots[side] += shots[side];
+            }
+
+            task->tally.differences += shots[1] - shots[0];
+            task->tally.squares += (double) (shots[1] - shots[0]) * (shots[1] - shots[0]);
+        }
+
+        task->tally.games++;
+    }
+
+    return NULL;
+}
+
+/*
+    Plays one game between the two CPUs.
+
+    Parameters
+    ----------
+    `struct MatchTask *task`:
+        The task the game is played for.
+
+    `int first`:
+        Side moving first.
+
+    Returns
+    -------
+    Returns the side that won.
+*/
+int playMatchGame(struct MatchTask *task, int first)
+{
+    struct Player players[2];
+    struct CPUState cpus[2];
+    int turn = first;
+
+    TRACE_BEGIN("playMatchGame");
+
+    for (int side = 0; side < 2; side++)
+    {
+        resetPlayer(&players[side]);
+        setUpCPU(task, &cpus[side], side, side);
+        placeSide(task, &players[side], side);
+        snprintf(players[side].name, MAX_SIZE, "%s", task->sides[side].name);
+    }
+
+    if (task->stage != NULL)
+        beginPlayersRecord(task->record, task->mode, players, false);
+
+    while (true)
+    {
+        int left = countUnguessedCells(&players[turn].unguessed, -1);
+        int shots = task->mode == SALVO ? countShipsLeft(&players[turn]) : 1;
+        struct SalvoResult result;
+
+        shots = shots < left ? shots : left;
+
+        bool won = playCPUSalvo(&cpus[turn], &players[turn], &players[1 - turn], shots, &result);
+
+        if (task->stage != NULL)
+            recordSalvo(task->record, turn, &result);
+
+        if (won)
+            break;
+
+        turn = 1 - turn;
+    }
+
+    if (task->stage != NULL)
+    {
+        finishRecord(task->record, turn);
+        logGame(task->stage, task->record);
+    }
+
+    resetCPUVariables(&cpus[0]);
+    resetCPUVariables(&cpus[1]);
+    TRACE_END("playMatchGame");
+
+    return turn;
+}
+
+/*
+    Lets one of the CPUs sink a fleet on its own.
+
+    Parameters
+    ----------
+    `struct MatchTask *task`:
+        The task the fleet is sunk for.
+
+    `int side`:
+        Side of the CPU.
+
+    `unsigned char fleet[SHIPS]`:
+        The fleet, as drawn by drawFleet.
+
+    Returns
+    -------
+    Returns the number of shots the CPU took.
+*/
+int sinkFleet(struct MatchTask *task, int side, unsigned char fleet[SHIPS])
+{
+    struct Player attacker, defender;
+    struct CPUState cpu;
+    char moveStatus;
+    int shots = 1;
+
+    resetPlayer(&attacker);
+    resetPlayer(&defender);
+    placeFleet(&defender, fleet);
+    setUpCPU(task, &cpu, side, 0);
+
+    while (!playCPUTurn(&cpu, &attacker, &defender, &moveStatus))
+        shots++;
+
+    resetCPUVariables(&cpu);
+
+    return shots;
+}
+
+/*
+    Sets up the state of one of the CPUs for a new game.
+
+    Parameters
+    ----------
+    `struct MatchTask *task`:
+        The task the game is played for.
+
+    `struct CPUState *cpu`:
+        The CPUState to set up.
+
+    `int side`:
+        Side of the CPU.
+
+    `int turn`:
+        Turn of the CPU in the game, either 0 or 1.
+*/
+void setUpCPU(struct MatchTask *task, struct CPUState *cpu, int side, int turn)
+{
+    initCPUState(cpu, turn, task->sides[side].difficulty, nextSeed(&task->random));
+    cpu->strategy = task->sides[side].strategy;
+
+    // the expert's state is created here rather than on its first shot, so that it thinks on its share of threads
+    if (cpu->difficulty == EXPERT && (cpu->expert = createExpert(nextSeed(&task->random))) != NULL)
+        cpu->expert->threads = task->threads;
+}
+
+/*
+    Places the fleet of one of the CPUs.
+
+    Parameters
+    ----------
+    `struct MatchTask *task`:
+        The task the game is played for.
+
+    `struct Player *player`:
+        The CPU player, whose board is empty.
+
+    `int side`:
+        Side of the CPU.
+*/
+void placeSide(struct MatchTask *task, struct Player *player, int side)
+{
+    unsigned char fleet[SHIPS];
+
+    if (task->sides[side].difficulty == EXPERT)
+    {
+        placeShipsExpert(player, task->threads, monotonicMicroseconds() + getCPUBudget() * 1000LL);
+        return;
+    }
+
+    drawFleet(&task->random, fleet);
+    placeFleet(player, fleet);
+}
+
+/*
+    Works out the log of how much likelier the games played so far are if the first player is stronger by the
+    margin than if it is no stronger.
+
+    Parameters
+    ----------
+    `MatchMetric metric`:
+        What the games were played for.
+
+    `struct MatchTally *tally`:
+        What the games came to.
+
+    Returns
+    -------
+    Returns the log-likelihood ratio, 0 while too few games have been played to work it out.
+*/
+double logLikelihoodRatio(MatchMetric metric, struct MatchTally *tally)
+{
+    long long n = tally->games;
+
+    if (metric == MATCH_WINS)
+    {
+        double even = 0.5, stronger = 0.5 + MATCH_WIN_MARGIN;
+
+        return tally->wins * log(stronger / even) + (n - tally->wins) * log((1 - stronger) / (1 - even));
+    }
+
+    if (n < 2)
+        return 0;
+
+    double mean = tally->differences / n;
+    double variance = (tally->squares - tally->differences * mean) / (n - 1);
+
+    // players that always take the same shots differ by nothing, which no margin explains
+    variance = variance > 1e-9 ? variance : 1e-9;
+
+    return n * (MATCH_SHOT_MARGIN / variance) * (mean - MATCH_SHOT_MARGIN / 2);
+}
+
+/*
+    Estimates how much stronger the first player is from the games played so far.
+
+    Parameters
+    ----------
+    `MatchMetric metric`:
+        What the games were played for.
+
+    `struct MatchTally *tally`:
+        What the games came to, at least one game.
+
+    `double *value`:
+        Stores the estimate, the first player's win rate on wins, and how many fewer shots it takes on shots.
+
+    `double *error`:
+        Stores the standard error of the estimate.
+*/
+void estimateStrength(MatchMetric metric, struct MatchTally *tally, double *value, double *error)
+{
+    long long n = tally->games;
+
+    if (metric == MATCH_WINS)
+    {
+        *value = (double) tally->wins / n;
+        *error = sqrt(*value * (1 - *value) / n);
+        return;
+    }
+
+    *value = tally->differences / n;
+    *error = n > 1 ? sqrt((tally->squares - tally->differences * *value) / (n - 1) / n) : 0;
+}
+
+/*
+    Prints what the test decided, how strongly, and how much stronger the first player was in the games played.
+
+    Parameters
+    ----------
+    `char *sides[2]`:
+        Names of the CPUs.
+
+    `MatchMetric metric`:
+        What the games were played for.
+
+    `struct MatchTally *tally`:
+        What the games came to.
+
+    `long long games`:
+        Most games that were to be played.
+
+    `double ratio`:
+        Log-likelihood ratio of the games played.
+
+    `double seconds`:
+        Time the games took.
+
+    `int threads`:
+        Number of threads the games were played on.
+*/
+void printMatchResult(
+    char *sides[2], MatchMetric metric, struct MatchTally *tally, long long games, double ratio,
+    double seconds, int threads
+)
+{
+    double value, error, null = metric == MATCH_WINS ? 0.5 : 0;
+
+    if (tally->games == 0)
+        return;
+
+    estimateStrength(metric, tally, &value, &error);
+
+    // how sure the games make it that the first player is stronger at all, as the share of a normal distribution
+    // around the estimateStrength lying above no difference
+    double confidence = error > 0 ? 0.5 * erfc(-(value - null) / error / sqrt(2)) : (value > null ? 1 : (value < null ? 0 : 0.5));
+
+    printf("\n%lld of at most %lld games played in %.2f s (%.1f games/s) on %d thread%s.\n", tally->games, games, seconds,
+           seconds > 0 ? tally->games / seconds : 0.0, threads, threads == 1 ? "" : "s");
+
+    if (metric == MATCH_WINS)
+    {
+        // the Wilson score interval, which unlike value +- 1.96 * error does not shrink to a point when one side
+        // wins every game
+        double z = 1.96, n = (double) tally->games, scale = 1 + z * z / n;
+        double centre = (value + z * z / (2 * n)) / scale;
+        double spread = z * sqrt(value * (1 - value) / n + z * z / (4 * n * n)) / scale;
+
+        printf("%s won %.1f%% of the games (95%% interval %.1f%% to %.1f%%).\n", sides[0], 100 * value,
+               100 * (centre - spread), 100 * (centre + spread));
+    }
+    else
+    {
+        // the difference and its interval are given as shots more when the first player took more, so that they
+        // read the same way whichever side took fewer
+        double shown = fabs(value);
+
+        printf("%s took %.2f %s shots than %s to sink a fleet (95%% interval %.2f to %.2f), %.2f against %.2f.\n",
+               sides[0], shown, value < 0 ? "more" : "fewer", sides[1], shown - 1.96 * error, shown + 1.96 * error,
+               (double) tally->shots[0] / tally->games, (double) tally->shots[1] / tally->games);
+    }
+
+    if (ratio >= log((1 - MATCH_BETA) / MATCH_ALPHA))
+        printf("Decided: %s is stronger than %s, ", sides[0], sides[1]);
+    else if (ratio <= log(MATCH_BETA / (1 - MATCH_ALPHA)) && metric == MATCH_WINS)
+        printf("Decided: %s is not stronger than %s by %.0f%% of the games, ", sides[0], sides[1], 100 * MATCH_WIN_MARGIN);
+    else if (ratio <= log(MATCH_BETA / (1 - MATCH_ALPHA)))
+        printf("Decided: %s is not stronger than %s by %.1f shots, ", sides[0], sides[1], MATCH_SHOT_MARGIN);
+    else
+        printf("Undecided: the log-likelihood ratio reached %.2f, ", ratio);
+
+    printf("%.2f%% confident %s is stronger at all.\n", 100 * confidence, sides[0]);
+}
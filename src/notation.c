@@ -0,0 +1,801 @@
+/*
+
+File Name: notation.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to export recorded games to a plain-text notation and to import them back, so that games
+    can be exchanged with other tools.
+
+    A game in notation is a sequence of lines:
+        game classic                       rules of the game, classic or salvo, starting the game
+        cpu 2 hard                         optional, the player (1 or 2) who was a CPU and its difficulty
+        player1 Alice                      name of each player, everything after the first space
+        player2 Bob
+        fleet1 C A1-A5 B C3-F3 ...         fleet of each player, every ship as its icon and its two ends
+        fleet2 ...
+        1 B7x                              a turn, the player firing followed by every shot of the turn
+        2 C3o D4x D5x#
+        winner 1                           the player who won (1 or 2), or - if the game was not finished,
+                                           ending the game
+    Cells are given as a column from A and a row from 1, and every shot is followed by x for a hit, o for a miss
+    and x# for a hit sinking a ship. Empty lines are ignored and lines may end in \r\n.
+
+    Importing reads the text through a single buffer of NOTATION_BUFFER_BYTES, parsing every line where it lies
+    in the buffer without copying it or calling sscanf, and plays every shot on the game's boards to check it
+    against the outcome given, storing keyframes as it goes. The games are then encoded into a second buffer,
+    which is appended to the record file whenever it is full. A game that does not parse or whose outcomes do
+    not match its fleets is skipped, and the import goes on with the next game.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. notation.h
+    2. timing.h
+
+    STRUCTS
+    -------
+    NotationParser
+
+    FUNCTIONS (global)
+    ------------------
+    1. size_t formatNotation(struct GameRecord *record, char *buffer)
+    2. bool exportNotation(char *recordPath, char *textPath)
+    3. bool importNotation(char *textPath, char *recordPath)
+
+    FUNCTIONS (local)
+    -----------------
+    1. char *writeNotationCell(char *text, int cell)
+    2. void parseNotationLine(struct NotationParser *parser, char *line, char *end)
+    3. void startNotationGame(struct NotationParser *parser, char *line, char *end)
+    4. bool readNotationFleet(struct NotationParser *parser, int player, char *text, char *end)
+    5. bool readNotationTurn(struct NotationParser *parser, int player, char *text, char *end)
+    6. bool readNotationCell(char **text, char *end, int *cell)
+    7. void storeNotationKeyframe(struct NotationParser *parser)
+    8. void finishNotationGame(struct NotationParser *parser, char *text, char *end)
+    9. void rejectNotationGame(struct NotationParser *parser, char *reason)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <notation.h>
+#include <timing.h>
+#include <string.h>
+
+/*
+    NotationParser struct, contains the state of an import. Contains:
+    - struct GameRecord record: the game being read.
+    - struct Player state[2]: boards of both players as of the last shot read.
+    - bool reading: whether a game is being read, i.e., a game line has been read and the game has neither been
+      finished nor skipped.
+    - int seen: the lines of the game read so far, bits 0 and 1 for the names, 2 and 3 for the fleets.
+    - long long line: number of the line being read, counting from 1.
+    - long long games: number of games imported.
+    - long long skipped: number of games skipped.
+    - unsigned char *output: buffer the games imported are encoded into.
+    - size_t used: number of bytes of output used.
+    - FILE *file: the record file the games are appended to.
+    - bool failed: whether anything could not be written to file.
+*/
+struct NotationParser {
+    struct GameRecord record;
+    struct Player state[2];
+    bool reading;
+    int seen;
+    long long line;
+    long long games;
+    long long skipped;
+    unsigned char *output;
+    size_t used;
+    FILE *file;
+    bool failed;
+};
+
+char *writeNotationCell(char *text, int cell);
+void parseNotationLine(struct NotationParser *parser, char *line, char *end);
+void startNotationGame(struct NotationParser *parser, char *line, char *end);
+bool readNotationFleet(struct NotationParser *parser, int player, char *text, char *end);
+bool readNotationTurn(struct NotationParser *parser, int player, char *text, char *end);
+bool readNotationCell(char **text, char *end, int *cell);
+void storeNotationKeyframe(struct NotationParser *parser);
+void finishNotationGame(struct NotationParser *parser, char *text, char *end);
+void rejectNotationGame(struct NotationParser *parser, char *reason);
+
+/*
+    Writes the given recorded game in notation, as described at the top of this file.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The game to write.
+
+    `char *buffer`:
+        Buffer of at least MAX_NOTATION_BYTES bytes to write the game to. It is not terminated by '\0'.
+
+    Returns
+    -------
+    Returns the number of bytes written.
+*/
+size_t formatNotation(struct GameRecord *record, char *buffer)
+{
+    static const char *difficulties[] = { "easy", "hard", "expert", "plugin", "policy" };
+    char *text = buffer;
+
+    text += sprintf(text, "game %s\n", record->mode == SALVO ? "salvo" : "classic");
+
+    if (record->cpuPlayer && record->difficulty >= EASY && record->difficulty <= POLICY)
+        text += sprintf(text, "cpu %d %s\n", record->cpuTurn + 1, difficulties[record->difficulty - EASY]);
+
+    for (int i = 0; i < 2; i++)
+        text += sprintf(text, "player%d %.*s\n", i + 1, MAX_SIZE - 1, record->names[i]);
+
+    for (int i = 0; i < 2; i++)
+    {
+        text += sprintf(text, "fleet%d", i + 1);
+
+        for (int ship = 0; ship < SHIPS; ship++)
+        {
+            char icon = getShipIcon(ship);
+            int first = -1, last = -1;
+
+            for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; cell++)
+            {
+                if (record->boards[i][cell / BOARD_SIZE][cell % BOARD_SIZE] == icon)
+                {
+                    first = first == -1 ? cell : first;
+                    last = cell;
+                }
+            }
+
+            if (first == -1)
+                continue;
+
+            *text++ = ' ';
+            *text++ = icon;
+            *text++ = ' ';
+            text = writeNotationCell(text, first);
+            *text++ = '-';
+            text = writeNotationCell(text, last);
+        }
+
+        *text++ = '\n';
+    }
+
+    for (int turn = 0; turn < record->turnCount; turn++)
+    {
+        // a turn in which no shots were fired is left out, as it cannot be told apart from no turn at all
+        if (record->turnStarts[turn] == record->turnStarts[turn + 1])
+            continue;
+
+        *text++ = '1' + record->shots[record->turnStarts[turn]].player;
+
+        for (int i = record->turnStarts[turn]; i < record->turnStarts[turn + 1]; i++)
+        {
+            char outcome = record->shots[i].outcome;
+
+            *text++ = ' ';
+            text = writeNotationCell(text, record->shots[i].cell);
+            *text++ = outcome == 'M' ? 'o' : 'x';
+
+            if (outcome != 'M' && outcome != 'H')
+                *text++ = '#';
+        }
+
+        *text++ = '\n';
+    }
+
+    text += sprintf(text, "winner %c\n\n", record->winner == -1 ? '-' : '1' + record->winner);
+
+    return text - buffer;
+}
+
+/*
+    Writes every game of a record file in notation to a text file.
+
+    Parameters
+    ----------
+    `char *recordPath`:
+        The record file to read.
+
+    `char *textPath`:
+        The text file to write, which is replaced if it exists.
+
+    Returns
+    -------
+    Returns `true` if every game was written, else it returns `false`.
+*/
+bool exportNotation(char *recordPath, char *textPath)
+{
+    FILE *input = fopen(recordPath, "rb");
+
+    if (input == NULL)
+    {
+        printf("Could not open %s.\n", recordPath);
+        return false;
+    }
+
+    FILE *output = fopen(textPath, "wb");
+    struct GameRecord *record = (struct GameRecord *) malloc(sizeof(struct GameRecord));
+    char *buffer = (char *) malloc(NOTATION_BUFFER_BYTES);
+    bool written = output != NULL && record != NULL && buffer != NULL;
+    long long games = 0;
+    size_t used = 0;
+
+    if (output == NULL)
+        printf("Could not open %s to write to.\n", textPath);
+    else if (!written)
+        printf("Could not allocate memory to export the games.\n");
+
+    while (written && readRecord(input, record))
+    {
+        if (NOTATION_BUFFER_BYTES - used < MAX_NOTATION_BYTES)
+        {
+            written = fwrite(buffer, 1, used, output) == used;
+            used = 0;
+        }
+
+        used += formatNotation(record, buffer + used);
+        games++;
+    }
+
+    if (written)
+    {
+        if (!feof(input))
+            printf("Could not read past game %lld of %s, the rest of the file will not be exported.\n", games, recordPath);
+
+        written = fwrite(buffer, 1, used, output) == used;
+    }
+
+    if (output != NULL && fclose(output) != 0)
+        written = false;
+
+    fclose(input);
+    free(record);
+    free(buffer);
+
+    if (written)
+        printf("Exported %lld game(s) to %s.\n", games, textPath);
+    else if (output != NULL)
+        printf("Could not write every game to %s.\n", textPath);
+
+    return written;
+}
+
+/*
+    Reads every game in notation from a text file and appends it to a record file. See the top of this file for
+    how.
+
+    Parameters
+    ----------
+    `char *textPath`:
+        The text file to read.
+
+    `char *recordPath`:
+        The record file to append to, which is created if it does not exist.
+
+    Returns
+    -------
+    Returns `true` if every game read was written, even if some were skipped, else it returns `false`.
+*/
+bool importNotation(char *textPath, char *recordPath)
+{
+    FILE *input = fopen(textPath, "rb");
+
+    if (input == NULL)
+    {
+        printf("Could not open %s.\n", textPath);
+        return false;
+    }
+
+    struct NotationParser *parser = (struct NotationParser *) calloc(1, sizeof(struct NotationParser));
+    char *buffer = (char *) malloc(NOTATION_BUFFER_BYTES);
+
+    if (parser == NULL || buffer == NULL || (parser->output = (unsigned char *) malloc(NOTATION_BUFFER_BYTES)) == NULL)
+    {
+        printf("Could not allocate memory to import the games.\n");
+        fclose(input);
+        free(buffer);
+        free(parser);
+        return false;
+    }
+
+    if ((parser->file = fopen(recordPath, "ab")) == NULL)
+    {
+        printf("Could not open %s to write to.\n", recordPath);
+        fclose(input);
+        free(parser->output);
+        free(buffer);
+        free(parser);
+        return false;
+    }
+
+    long long start = monotonicMicroseconds(), bytes = 0;
+    size_t kept = 0;
+
+    while (true)
+    {
+        if (kept == NOTATION_BUFFER_BYTES)
+        {
+            // a line that does not fit in the buffer is thrown away along with its game
+            parser->line++;
+
+            if (parser->reading)
+                rejectNotationGame(parser, "line too long");
+
+            kept = 0;
+        }
+
+        size_t count = fread(buffer + kept, 1, NOTATION_BUFFER_BYTES - kept, input);
+        char *line = buffer, *end = buffer + kept + count;
+
+        bytes += count;
+
+        for (char *newline; (newline = (char *) memchr(line, '\n', end - line)) != NULL; line = newline + 1)
+            parseNotationLine(parser, line, newline);
+
+        kept = end - line;
+
+        if (count == 0)
+        {
+            if (kept > 0)
+                parseNotationLine(parser, line, end);
+
+            break;
+        }
+
+        memmove(buffer, line, kept);
+    }
+
+    if (parser->reading)
+        rejectNotationGame(parser, "the file ends before the game's winner line");
+
+    if (ferror(input))
+        printf("Could not read past byte %lld of %s.\n", bytes, textPath);
+
+    bool written = !parser->failed && fwrite(parser->output, 1, parser->used, parser->file) == parser->used;
+    double seconds = (monotonicMicroseconds() - start) / 1e6;
+
+    written = fclose(parser->file) == 0 && written;
+    printf("Imported %lld game(s) to %s, skipped %lld, in %.2f s (%.1f MB/s).\n", parser->games, recordPath,
+           parser->skipped, seconds, seconds > 0 ? bytes / seconds / 1e6 : 0.0);
+
+    if (!written)
+        printf("Could not write every game to %s.\n", recordPath);
+
+    fclose(input);
+    free(parser->output);
+    free(buffer);
+    free(parser);
+
+    return written;
+}
+
+/*
+    Writes a cell in notation, as its column letter followed by its row number.
+
+    Parameters
+    ----------
+    `char *text`:
+        Where to write the cell.
+
+    `int cell`:
+        The cell, given as (row * 10) + col.
+
+    Returns
+    -------
+    Returns the byte after the cell written.
+*/
+char *writeNotationCell(char *text, int cell)
+{
+    int row = cell / BOARD_SIZE + 1;
+
+    *text++ = 'A' + cell % BOARD_SIZE;
+
+    if (row >= 10)
+        *text++ = '0' + row / 10;
+
+    *text++ = '0' + row % 10;
+
+    return text;
+}
+
+/*
+    Parses a line of notation.
+
+    Parameters
+    ----------
+    `struct NotationParser *parser`:
+        The import.
+
+    `char *line`:
+        First byte of the line.
+
+    `char *end`:
+        Byte after the last byte of the line, not including the '\n'.
+*/
+void parseNotationLine(struct NotationParser *parser, char *line, char *end)
+{
+    parser->line++;
+
+    if (end > line && end[-1] == '\r')
+        end--;
+
+    if (end == line)
+        return;
+
+    size_t length = end - line;
+
+    if (length >= 5 && memcmp(line, "game ", 5) == 0)
+    {
+        if (parser->reading)
+            rejectNotationGame(parser, "the game before has no winner line");
+
+        startNotationGame(parser, line + 5, end);
+        return;
+    }
+
+    // lines of a game being skipped are thrown away until the next game begins
+    if (!parser->reading)
+        return;
+
+    if ((line[0] == '1' || line[0] == '2') && length >= 2 && line[1] == ' ')
+    {
+        if (parser->seen != 15)
+            rejectNotationGame(parser, "a turn comes before the names and fleets of both players");
+        else if (!readNotationTurn(parser, line[0] - '1', line + 2, end))
+            rejectNotationGame(parser, "wrong shot");
+    }
+    else if (length >= 8 && memcmp(line, "player", 6) == 0 && (line[6] == '1' || line[6] == '2') && line[7] == ' ')
+    {
+        int player = line[6] - '1';
+
+        length = length - 8 < MAX_SIZE - 1 ? length - 8 : MAX_SIZE - 1;
+        memcpy(parser->record.names[player], line + 8, length);
+        parser->record.names[player][length] = '\0';
+        parser->seen |= 1 << player;
+    }
+    else if (length >= 7 && memcmp(line, "fleet", 5) == 0 && (line[5] == '1' || line[5] == '2') && line[6] == ' ')
+    {
+        if ((parser->seen & (4 << (line[5] - '1'))) || !readNotationFleet(parser, line[5] - '1', line + 7, end))
+            rejectNotationGame(parser, "wrong fleet");
+    }
+    else if (length >= 6 && memcmp(line, "cpu ", 4) == 0 && (line[4] == '1' || line[4] == '2') && line[5] == ' ')
+    {
+        static const char *difficulties[] = { "easy", "hard", "expert", "plugin", "policy" };
+        int found = -1;
+
+        for (int i = 0; i < 5; i++)
+        {
+            if (length - 6 == strlen(difficulties[i]) && memcmp(line + 6, difficulties[i], length - 6) == 0)
+                found = i;
+        }
+
+        if (found == -1)
+        {
+            rejectNotationGame(parser, "unknown difficulty");
+            return;
+        }
+
+        parser->record.cpuPlayer = true;
+        parser->record.cpuTurn = line[4] - '1';
+        parser->record.difficulty = EASY + found;
+    }
+    else if (length >= 7 && memcmp(line, "winner ", 7) == 0)
+    {
+        finishNotationGame(parser, line + 7, end);
+    }
+    else
+    {
+        rejectNotationGame(parser, "unknown line");
+    }
+}
+
+/*
+    Starts reading a game from its game line.
+
+    Parameters
+    ----------
+    `struct NotationParser *parser`:
+        The import.
+
+    `char *text`:
+        The game line after "game ".
+
+    `char *end`:
+        Byte after the last byte of the line.
+*/
+void startNotationGame(struct NotationParser *parser, char *text, char *end)
+{
+    struct GameRecord *record = &parser->record;
+
+    if (end - text == 7 && memcmp(text, "classic", 7) == 0)
+        record->mode = CLASSIC;
+    else if (end - text == 5 && memcmp(text, "salvo", 5) == 0)
+        record->mode = SALVO;
+    else
+    {
+        parser->reading = true;
+        rejectNotationGame(parser, "unknown rules");
+        return;
+    }
+
+    record->cpuPlayer = false;
+    record->cpuTurn = 0;
+    record->difficulty = 0;
+    record->winner = -1;
+    record->shotCount = 0;
+    record->turnCount = 0;
+    record->turnStarts[0] = 0;
+    record->keyframeCount = 0;
+    record->keyframed = true;
+    record->names[0][0] = record->names[1][0] = '\0';
+    resetPlayer(&parser->state[0]);
+    resetPlayer(&parser->state[1]);
+    parser->reading = true;
+    parser->seen = 0;
+}
+
+/*
+    Reads the fleet of a player and places it on their board.
+
+    Parameters
+    ----------
+    `struct NotationParser *parser`:
+        The import.
+
+    `int player`:
+        The player (0 or 1).
+
+    `char *text`:
+        The fleet line after "fleetN ".
+
+    `char *end`:
+        Byte after the last byte of the line.
+
+    Returns
+    -------
+    Returns `true` if every ship was given once, in a straight line of its length and without overlapping
+    another, else it returns `false`.
+*/
+bool readNotationFleet(struct NotationParser *parser, int player, char *text, char *end)
+{
+    struct Player *state = &parser->state[player];
+    int placed = 0;
+
+    while (text < end)
+    {
+        int first, last;
+        Ships ship = text + 1 < end && text[1] == ' ' ? getShipFromIcon(text[0]) : -1;
+
+        text += 2;
+
+        if ((int) ship == -1 || (placed & (1 << ship)) || !readNotationCell(&text, end, &first) || text == end
+            || *text++ != '-' || !readNotationCell(&text, end, &last) || (text < end && *text++ != ' '))
+        {
+            return false;
+        }
+
+        int low = first < last ? first : last, high = first < last ? last : first, length = getShipLength(ship);
+        int step = high - low == length - 1 && low / BOARD_SIZE == high / BOARD_SIZE ? 1 : BOARD_SIZE;
+
+        if (high - low != (length - 1) * step)
+            return false;
+
+        for (int cell = low; cell <= high; cell += step)
+        {
+            if (state->board[cell / BOARD_SIZE][cell % BOARD_SIZE] != ' ')
+                return false;
+
+            state->board[cell / BOARD_SIZE][cell % BOARD_SIZE] = getShipIcon(ship);
+        }
+
+        placed |= 1 << ship;
+    }
+
+    parser->seen |= 4 << player;
+
+    return placed == (1 << SHIPS) - 1;
+}
+
+/*
+    Reads a turn and plays its shots, checking them against the outcomes given.
+
+    Parameters
+    ----------
+    `struct NotationParser *parser`:
+        The import.
+
+    `int player`:
+        The player firing (0 or 1).
+
+    `char *text`:
+        The turn line after the player.
+
+    `char *end`:
+        Byte after the last byte of the line.
+
+    Returns
+    -------
+    Returns `true` if every shot was fired at a cell not fired at before and came out as given, else it returns
+    `false`.
+*/
+bool readNotationTurn(struct NotationParser *parser, int player, char *text, char *end)
+{
+    struct GameRecord *record = &parser->record;
+    struct Player *shooter = &parser->state[player], *target = &parser->state[1 - player];
+    int shots = 0;
+
+    if (record->turnCount == MAX_TURNS)
+        return false;
+
+    if (record->turnCount % KEYFRAME_INTERVAL == 0 && record->turnCount / KEYFRAME_INTERVAL == record->keyframeCount)
+        storeNotationKeyframe(parser);
+
+    while (text < end)
+    {
+        int cell;
+        char sunk = '\0';
+
+        if (++shots > SHIPS || !readNotationCell(&text, end, &cell) || text == end
+            || shooter->actionBoard[cell / BOARD_SIZE][cell % BOARD_SIZE] != ' ')
+        {
+            return false;
+        }
+
+        char hit = *text++;
+        bool sinks = text < end && *text == '#';
+
+        text += sinks ? 1 : 0;
+
+        if ((hit != 'x' && hit != 'o') || (text < end && *text++ != ' '))
+            return false;
+
+        char status = resolveShot(shooter, target, cell / BOARD_SIZE, cell % BOARD_SIZE, &sunk);
+
+        if ((status == 'H') != (hit == 'x') || (sunk != '\0') != sinks)
+            return false;
+
+        struct RecordedShot *shot = &record->shots[record->shotCount++];
+
+        shot->player = player;
+        shot->cell = cell;
+        shot->outcome = status == 'M' ? 'M' : (sunk != '\0' ? sunk : 'H');
+    }
+
+    record->turnStarts[++record->turnCount] = record->shotCount;
+
+    return shots > 0;
+}
+
+/*
+    Reads a cell given as its column letter followed by its row number.
+
+    Parameters
+    ----------
+    `char **text`:
+        Where the cell starts, moved past it once it is read.
+
+    `char *end`:
+        Byte after the last byte of the line.
+
+    `int *cell`:
+        Stores the cell, given as (row * 10) + col.
+
+    Returns
+    -------
+    Returns `true` if a cell on the board was read, else it returns `false`.
+*/
+bool readNotationCell(char **text, char *end, int *cell)
+{
+    char *next = *text;
+    int row = 0;
+
+    if (next >= end || *next < 'A' || *next >= 'A' + BOARD_SIZE)
+        return false;
+
+    int col = *next++ - 'A';
+
+    while (next < end && *next >= '0' && *next <= '9' && row <= BOARD_SIZE)
+        row = row * 10 + (*next++ - '0');
+
+    if (row < 1 || row > BOARD_SIZE)
+        return false;
+
+    *cell = (row - 1) * BOARD_SIZE + col;
+    *text = next;
+
+    return true;
+}
+
+/*
+    Stores a keyframe holding the state at the start of the turn about to be read.
+
+    Parameter
+    ---------
+    `struct NotationParser *parser`:
+        The import.
+*/
+void storeNotationKeyframe(struct NotationParser *parser)
+{
+    struct Keyframe *keyframe = &parser->record.keyframes[parser->record.keyframeCount++];
+
+    for (int i = 0; i < 2; i++)
+    {
+        memcpy(keyframe->actionBoards[i], parser->state[i].actionBoard, sizeof keyframe->actionBoards[i]);
+
+        for (int j = 0; j < SHIPS; j++)
+            keyframe->shipsHP[i][j] = parser->state[i].shipsHP[j];
+    }
+}
+
+/*
+    Finishes reading a game from its winner line and adds it to the games to write.
+
+    Parameters
+    ----------
+    `struct NotationParser *parser`:
+        The import.
+
+    `char *text`:
+        The winner line after "winner ".
+
+    `char *end`:
+        Byte after the last byte of the line.
+*/
+void finishNotationGame(struct NotationParser *parser, char *text, char *end)
+{
+    struct GameRecord *record = &parser->record;
+
+    if (end - text != 1 || (*text != '1' && *text != '2' && *text != '-'))
+    {
+        rejectNotationGame(parser, "wrong winner");
+        return;
+    }
+
+    if (parser->seen != 15)
+    {
+        rejectNotationGame(parser, "the game has no names or fleets");
+        return;
+    }
+
+    record->winner = *text == '-' ? -1 : *text - '1';
+
+    if (record->keyframeCount == 0)
+        storeNotationKeyframe(parser);
+
+    memcpy(record->boards[0], parser->state[0].board, sizeof record->boards[0]);
+    memcpy(record->boards[1], parser->state[1].board, sizeof record->boards[1]);
+
+    if (NOTATION_BUFFER_BYTES - parser->used < MAX_RECORD_BYTES)
+    {
+        parser->failed = parser->failed || fwrite(parser->output, 1, parser->used, parser->file) != parser->used;
+        parser->used = 0;
+    }
+
+    parser->used += encodeRecord(record, parser->output + parser->used);
+    parser->games++;
+    parser->reading = false;
+}
+
+/*
+    Skips the game being read, printing why for the first NOTATION_MAX_ERRORS games skipped.
+
+    Parameters
+    ----------
+    `struct NotationParser *parser`:
+        The import.
+
+    `char *reason`:
+        Why the game is skipped.
+*/
+void rejectNotationGame(struct NotationParser *parser, char *reason)
+{
+    if (parser->skipped < NOTATION_MAX_ERRORS)
+        printf("Line %lld: %s, skipping the game.\n", parser->line, reason);
+    else if (parser->skipped == NOTATION_MAX_ERRORS)
+        printf("Skipping more games without saying why.\n");
+
+    parser->skipped++;
+    parser->reading = false;
+}
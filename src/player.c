@@ -18,15 +18,28 @@ ________________________________________________________________________________
     FUNCTIONS (global)
     ------------------
     1. void createPlayer(int playerNum, bool createCPU)
-    2. void displayBoard(char board[BOARD_SIZE][BOARD_SIZE])
-    3. bool canPlaceShipOnBoard(int playerNum, char* startingPosition, char* endingPosition, Ships ship)
-    4. bool placeShipOnBoard(int playerNum, int *startArr, int *endArr, Ships ship)
-    5. bool checkWin(int playerTurn)
-    6. void mergeBoards(
+    2. void resetPlayer(struct Player *player)
+    3. void displayBoard(char board[BOARD_SIZE][BOARD_SIZE])
+    4. int formatBoard(char board[BOARD_SIZE][BOARD_SIZE], char *buffer, size_t bufferSize)
+    5. PlacementError canPlaceShipOnBoard(struct Player *player, char* startingPosition, char* endingPosition, Ships ship)
+    6. bool placeShipOnBoard(struct Player *player, int *startArr, int *endArr, Ships ship)
+    7. char resolveShot(struct Player *shooter, struct Player *target, int row, int col, char *sunkShip)
+    8. int fireSalvo(struct Player *shooter, struct Player *target, int *cells, int shots, struct SalvoResult *result)
+    9. bool checkWin(struct Player *opponent)
+    10. int countShipsLeft(struct Player *player)
+    11. char getShipIcon(Ships ship)
+    12. Ships getShipFromIcon(char icon)
+    13. char *getShipName(Ships ship)
+    14. int getShipLength(Ships ship)
+    15. void mergeBoards(
             char playerBoard[BOARD_SIZE][BOARD_SIZE], 
             char opponentActionBoard[BOARD_SIZE][BOARD_SIZE], 
             char merged[BOARD_SIZE][BOARD_SIZE]
         )
+    16. void indexUnguessedCells(struct Player *player)
+    17. void removeUnguessedCell(struct CellIndex *index, int cell)
+    18. int countUnguessedCells(struct CellIndex *index, int parity)
+    19. int pickUnguessedCell(struct CellIndex *index, int parity, unsigned int number)
 
 *Compiled using C99 standards*
 
@@ -35,6 +48,11 @@ ________________________________________________________________________________
 #include <game.h>
 #include <string.h>
 
+// lengths of the ships, indexed by the Ships enum
+static const int _shipLengths[SHIPS] = { 5, 4, 3, 3, 2 };
+
+static size_t remaining(size_t length, size_t bufferSize);
+
 // initiates default players values
 struct Player players[] = {
     { 
@@ -130,6 +148,26 @@ void createPlayer(int playerNum, bool createCPU)
     strncpy(players[playerNum - 1].name, createCPU ? "CPU" : name, MAX_SIZE);
 }
 
+/*
+    Clears both boards of the given player and restores the hit points of all of their ships. The player's
+    name is left untouched.
+
+    Parameter
+    ---------
+    `struct Player *player`:
+        The player to reset.
+*/
+void resetPlayer(struct Player *player)
+{
+    memset(player->board, ' ', sizeof player->board);
+    memset(player->actionBoard, ' ', sizeof player->actionBoard);
+
+    for (int i = 0; i < SHIPS; i++)
+        player->shipsHP[i] = _shipLengths[i];
+
+    indexUnguessedCells(player);
+}
+
 /*
     This function displays the specified game board.
 
@@ -140,25 +178,55 @@ void createPlayer(int playerNum, bool createCPU)
 */
 void displayBoard(char board[BOARD_SIZE][BOARD_SIZE])
 {
-    printf("\n     A    B    C    D    E    F    G    H    I    J  \n");
-    printf("   --------------------------------------------------\n");
+    char buffer[1024];
+
+    formatBoard(board, buffer, sizeof buffer);
+    fputs(buffer, stdout);
+}
+
+/*
+    Writes the specified game board into the given buffer, in the same format that `displayBoard` prints it in.
+
+    Parameters
+    ----------
+    `char board[BOARD_SIZE][BOARD_SIZE]`:
+        The game board to be formatted.
+    
+    `char *buffer`:
+        Buffer in which to store the formatted board. The output is truncated if the buffer is too small.
+    
+    `size_t bufferSize`:
+        Size of the buffer.
+    
+    Returns
+    -------
+    Returns the number of characters written into the buffer, excluding the terminating null character.
+*/
+int formatBoard(char board[BOARD_SIZE][BOARD_SIZE], char *buffer, size_t bufferSize)
+{
+    size_t length = 0;
+
+    length += snprintf(buffer, bufferSize, "\n     A    B    C    D    E    F    G    H    I    J  \n");
+    length += snprintf(buffer + length, remaining(length, bufferSize),
+        "   --------------------------------------------------\n");
 
     for (int i = 0; i < BOARD_SIZE; i++)
     {
-        if (i != 9)
-            printf(" %d ", i + 1);
-        else
-            printf("%d ", i + 1);
+        length += snprintf(buffer + length, remaining(length, bufferSize), 
+            i != 9 ? " %d " : "%d ", i + 1);
 
         for (int j = 0; j < BOARD_SIZE; j++)
         {
-            printf("| %c |", board[i][j]);
+            length += snprintf(buffer + length, remaining(length, bufferSize), "| %c |", board[i][j]);
         }
 
-        printf("\n");
+        length += snprintf(buffer + length, remaining(length, bufferSize), "\n");
     }
 
-    printf("   --------------------------------------------------\n");
+    length += snprintf(buffer + length, remaining(length, bufferSize),
+        "   --------------------------------------------------\n");
+
+    return length < bufferSize ? (int) length : (int) bufferSize - 1;
 }
 
 /*
@@ -208,8 +276,8 @@ void mergeBoards(
 
     Parameters
     ----------
-    `int playerNum`:
-        Contains player number (1 or 2).
+    `struct Player *player`:
+        The player on whose board the ship is to be placed.
     
     `char *startingPosition`:
         Starting coordinates from where to start placing the ship.
@@ -222,9 +290,10 @@ void mergeBoards(
     
     Returns
     -------
-    Returns `true` if the ship was successfully placed on the player's board, else it returns `false`.
+    Returns `PLACEMENT_OK` if the ship was successfully placed on the player's board, else it returns the reason
+    for which the ship could not be placed.
 */
-bool canPlaceShipOnBoard(int playerNum, char *startingPosition, char *endingPosition, Ships ship)
+PlacementError canPlaceShipOnBoard(struct Player *player, char *startingPosition, char *endingPosition, Ships ship)
 {
     int startRow, startCol, endRow, endCol, temp;
     int startArr[2], endArr[2];
@@ -240,55 +309,38 @@ bool canPlaceShipOnBoard(int playerNum, char *startingPosition, char *endingPosi
     startCol = startCol < endCol ? startCol : endCol;
     endCol = temp >= endCol ? temp : endCol;
 
-    if (players[playerNum - 1].board[startRow][startCol] != ' ')
-    {
-        printf("%s is already occupied, please enter another.\n\n", startingPosition);
-        return false;
-    }
-    if (players[playerNum - 1].board[endRow][endCol] != ' ')
-    {
-        printf("%s is already occupied, please enter another.\n\n", endingPosition);
-        return false;
-    }
+    if (player->board[startRow][startCol] != ' ')
+        return PLACEMENT_START_OCCUPIED;
+    if (player->board[endRow][endCol] != ' ')
+        return PLACEMENT_END_OCCUPIED;
     if ((startRow != endRow) && (startCol != endCol))
-    {
-        printf("Cannot place ships diagonally\n\n");
-        return false;
-    }
-    if ((endCol - startCol) + 1 != players[playerNum - 1].shipsHP[ship] 
-            && (endRow - startRow) + 1 != players[playerNum - 1].shipsHP[ship])
-    {
-        printf("Cannot fit ship in given positions.\n\n");
-        return false;
-    }
+        return PLACEMENT_DIAGONAL;
+    if ((endCol - startCol) + 1 != player->shipsHP[ship] && (endRow - startRow) + 1 != player->shipsHP[ship])
+        return PLACEMENT_WRONG_LENGTH;
 
     if (startRow == endRow)
     {
         for (int i = startCol; i <= endCol; i++)
         {
-            if (players[playerNum - 1].board[startRow][i] != ' ')
-            {
-                printf("Ships cannot overlap.\n\n");
-                return false;
-            }
+            if (player->board[startRow][i] != ' ')
+                return PLACEMENT_OVERLAP;
         }
     }
     else
     {
         for (int i = startRow; i <= endRow; i++)
         {
-            if (players[playerNum - 1].board[i][startCol] != ' ')
-            {
-                printf("Ships cannot overlap.\n\n");
-                return false;
-            }
+            if (player->board[i][startCol] != ' ')
+                return PLACEMENT_OVERLAP;
         }
     }
 
     startArr[0] = startRow; startArr[1] = startCol;
     endArr[0] = endRow; endArr[1] = endCol;
 
-    return placeShipOnBoard(playerNum, startArr, endArr, ship);
+    placeShipOnBoard(player, startArr, endArr, ship);
+
+    return PLACEMENT_OK;
 }
 
 /*
@@ -296,51 +348,30 @@ bool canPlaceShipOnBoard(int playerNum, char *startingPosition, char *endingPosi
 
     Parameters
     ----------
-    `int playerNum`:
-        Contains player number (1 or 2).
+    `struct Player *player`:
+        The player on whose board the ship is to be placed.
     
-    `char *startingPosition`:
-        Starting coordinates from where to start placing the ship.
+    `int *startArr`:
+        Row and column from where to start placing the ship.
 
-    `char *endingPosition`:
-        Ending coordinates from where to stop placing the ship.
+    `int *endArr`:
+        Row and column where to stop placing the ship.
 
     `Ships ships`:
         Ship to place.
 */
-bool placeShipOnBoard(int playerNum, int *startArr, int *endArr, Ships ship)
+bool placeShipOnBoard(struct Player *player, int *startArr, int *endArr, Ships ship)
 {
-    char shipIcon = '\0';
+    char shipIcon = getShipIcon(ship);
 
-    switch (ship)
+    if (shipIcon == '\0')
     {
-        case CARRIER:
-            shipIcon = 'C';
-            break;
-        
-        case BATTLESHIP:
-            shipIcon = 'B';
-            break;
-        
-        case DESTROYER:
-            shipIcon = 'D';
-            break;
-
-        case SUBMARINE:
-            shipIcon = 'S';
-            break;
-        
-        case PATROL:
-            shipIcon = 'P';
-            break;
-
-        default: printf("Invalid ship!\n");
-            break;
+        printf("Invalid ship!\n");
     }
 
     for (int i = startArr[0], j = startArr[1]; !(i == endArr[0] && j == endArr[1]);)
     {
-        players[playerNum - 1].board[i][j] = shipIcon;
+        player->board[i][j] = shipIcon;
 
         if (i != endArr[0])
             i++;
@@ -348,30 +379,301 @@ bool placeShipOnBoard(int playerNum, int *startArr, int *endArr, Ships ship)
             j++;
     }
 
-    players[playerNum - 1].board[endArr[0]][endArr[1]] = shipIcon;
+    player->board[endArr[0]][endArr[1]] = shipIcon;
 
     return true;
 }
 
 /*
-    Checks if the specified player has won the game or not.
+    Resolves a guess made by the shooter at the given cell of the target's board. The result of the guess is
+    written into the shooter's action board, and the hit points of the hit ship, if any, are reduced.
+
+    Parameters
+    ----------
+    `struct Player *shooter`:
+        The player making the guess.
+    
+    `struct Player *target`:
+        The player whose board is being guessed at.
+    
+    `int row`:
+        Row of the guessed cell.
+    
+    `int col`:
+        Column of the guessed cell.
+    
+    `char *sunkShip`:
+        Stores the icon of the ship which has sunk, if any. Can be `NULL`.
+    
+    Returns
+    -------
+    Returns 'H' if the guess results in a hit, else it returns 'M'.
+*/
+char resolveShot(struct Player *shooter, struct Player *target, int row, int col, char *sunkShip)
+{
+    char icon = target->board[row][col];
+
+    removeUnguessedCell(&shooter->unguessed, (row * 10) + col);
+
+    if (icon == ' ')
+    {
+        shooter->actionBoard[row][col] = 'O';
+        return 'M';
+    }
+
+    shooter->actionBoard[row][col] = 'X';
+
+    Ships ship = getShipFromIcon(icon);
+
+    if (ship != -1 && --target->shipsHP[ship] == 0 && sunkShip != NULL)
+        *sunkShip = icon;
+
+    return 'H';
+}
+
+/*
+    Fires several shots at the target's board at once and resolves all of them in a single pass. The cells must
+    not have been guessed before and must not repeat within the salvo.
+
+    Parameters
+    ----------
+    `struct Player *shooter`:
+        The player firing the salvo.
+    
+    `struct Player *target`:
+        The player whose board is being fired at.
+    
+    `int *cells`:
+        Cells to fire at, each given as (row * 10) + col.
+    
+    `int shots`:
+        Number of cells in `cells`, at most SHIPS.
+    
+    `struct SalvoResult *result`:
+        Stores the result of every shot along with the aggregated totals.
+    
+    Returns
+    -------
+    Returns the number of shots that hit a ship.
+*/
+int fireSalvo(struct Player *shooter, struct Player *target, int *cells, int shots, struct SalvoResult *result)
+{
+    result->shots = shots;
+    result->hits = 0;
+
+    for (int i = 0; i < shots; i++)
+    {
+        result->cells[i] = cells[i];
+        result->sunkShips[i] = '\0';
+        result->statuses[i] = resolveShot(shooter, target, cells[i] / 10, cells[i] % 10, &result->sunkShips[i]);
+        result->hits += result->statuses[i] == 'H';
+    }
+
+    return result->hits;
+}
+
+/*
+    Checks if the given player's fleet has been completely sunk, i.e., whether their opponent has won.
 
     Parameter
     ---------
-    `int playerTurn`:
-        Contains player turn number (0 or 1).
+    `struct Player *opponent`:
+        The player whose fleet is to be checked.
     
     Returns
     -------
-    Returns `true` if player has won, else it returns `false`.
+    Returns `true` if all of the player's ships have sunk, else it returns `false`.
 */
-bool checkWin(int playerTurn)
+bool checkWin(struct Player *opponent)
 {
     for (int i = 0; i < SHIPS; i++)
     {
-        if (players[(playerTurn + 1) % 2].shipsHP[i] != 0)
+        if (opponent->shipsHP[i] != 0)
             return false;
     }
 
     return true;
+}
+
+/*
+    Returns the number of ships of the given player that are still afloat.
+*/
+int countShipsLeft(struct Player *player)
+{
+    int shipsLeft = 0;
+
+    for (int i = 0; i < SHIPS; i++)
+        shipsLeft += player->shipsHP[i] != 0;
+
+    return shipsLeft;
+}
+
+/*
+    Returns the icon with which the given ship is drawn on a board, or '\0' if the ship is invalid.
+*/
+char getShipIcon(Ships ship)
+{
+    switch (ship)
+    {
+        case CARRIER: return 'C';
+        case BATTLESHIP: return 'B';
+        case DESTROYER: return 'D';
+        case SUBMARINE: return 'S';
+        case PATROL: return 'P';
+    }
+
+    return '\0';
+}
+
+/*
+    Returns the ship drawn with the given icon, or -1 if the icon does not belong to any ship.
+*/
+Ships getShipFromIcon(char icon)
+{
+    switch (icon)
+    {
+        case 'C': return CARRIER;
+        case 'B': return BATTLESHIP;
+        case 'D': return DESTROYER;
+        case 'S': return SUBMARINE;
+        case 'P': return PATROL;
+    }
+
+    return -1;
+}
+
+/*
+    Returns the name of the given ship.
+*/
+char *getShipName(Ships ship)
+{
+    switch (ship)
+    {
+        case CARRIER: return "Carrier";
+        case BATTLESHIP: return "Battleship";
+        case DESTROYER: return "Destroyer";
+        case SUBMARINE: return "Submarine";
+        case PATROL: return "Patrol";
+    }
+
+    return "";
+}
+
+/*
+    Returns the number of cells the given ship takes up on a board.
+*/
+int getShipLength(Ships ship)
+{
+    return _shipLengths[ship];
+}
+
+/*
+    Fills in the index of the cells the given player has not guessed yet from their action board.
+
+    Parameter
+    ---------
+    `struct Player *player`:
+        The player whose index is filled in.
+*/
+void indexUnguessedCells(struct Player *player)
+{
+    struct CellIndex *index = &player->unguessed;
+    index->counts[0] = index->counts[1] = 0;
+
+    for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; cell++)
+    {
+        int parity = ((cell / 10) + (cell % 10)) % 2;
+
+        if (player->actionBoard[cell / 10][cell % 10] == ' ')
+        {
+            index->positions[cell] = index->counts[parity];
+            index->cells[parity][index->counts[parity]++] = cell;
+        }
+    }
+}
+
+/*
+    Removes a cell from an index of unguessed cells by moving the last cell of its list into its place. Does
+    nothing if the cell is not in the index.
+
+    Parameters
+    ----------
+    `struct CellIndex *index`:
+        The index to remove the cell from.
+    
+    `int cell`:
+        The cell, given as (row * 10) + col.
+*/
+void removeUnguessedCell(struct CellIndex *index, int cell)
+{
+    int parity = ((cell / 10) + (cell % 10)) % 2;
+    int position = index->positions[cell];
+
+    if (position >= index->counts[parity] || index->cells[parity][position] != cell)
+        return;
+
+    int last = index->cells[parity][--index->counts[parity]];
+
+    index->cells[parity][position] = last;
+    index->positions[last] = position;
+}
+
+/*
+    Returns the number of cells in an index of unguessed cells.
+
+    Parameters
+    ----------
+    `struct CellIndex *index`:
+        The index.
+    
+    `int parity`:
+        If 0 or 1, only cells for which (row + col) % 2 equals parity are counted. If -1, every cell is counted.
+*/
+int countUnguessedCells(struct CellIndex *index, int parity)
+{
+    return parity == -1 ? index->counts[0] + index->counts[1] : index->counts[parity];
+}
+
+/*
+    Picks a cell from an index of unguessed cells, leaving it in the index.
+
+    Parameters
+    ----------
+    `struct CellIndex *index`:
+        The index to pick from.
+    
+    `int parity`:
+        If 0 or 1, only cells for which (row + col) % 2 equals parity are picked. If -1, any cell can be picked.
+    
+    `unsigned int number`:
+        A random number, which decides the cell picked.
+    
+    Returns
+    -------
+    Returns the picked cell, given as (row * 10) + col, or -1 if there is no cell left to pick from.
+*/
+int pickUnguessedCell(struct CellIndex *index, int parity, unsigned int number)
+{
+    int count = countUnguessedCells(index, parity);
+
+    if (count == 0)
+        return -1;
+
+    int pick = number % count;
+
+    if (parity == -1) // the two lists are treated as one, odd cells following the even ones
+    {
+        parity = pick < index->counts[0] ? 0 : 1;
+        pick -= parity == 1 ? index->counts[0] : 0;
+    }
+
+    return index->cells[parity][pick];
+}
+
+/*
+    Returns how much space is left in a buffer of the given size after `length` characters have been written.
+*/
+static size_t remaining(size_t length, size_t bufferSize)
+{
+    return length < bufferSize ? bufferSize - length : 0;
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+
+File Name: plugin.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to load CPU strategies from shared libraries, using dlopen on Linux and LoadLibrary on
+    Windows. See strategy.h for what a strategy has to provide. Strategies stay loaded until the program ends.
+
+    INCLUDES (user-defined)
+    -----------------------
+    plugin.h
+
+    GLOBAL VARIABLES
+    ----------------
+    1. const struct Strategy *_strategies[MAX_STRATEGIES]
+    2. int _strategyCount
+
+    FUNCTIONS (global)
+    ------------------
+    1. const struct Strategy *loadStrategy(char *name)
+    2. int countStrategies(void)
+    3. const struct Strategy *getStrategy(int index)
+    4. const struct Strategy *findStrategy(const char *name)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <plugin.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+#endif
+
+// stores the strategies loaded so far, in the order they were loaded
+const struct Strategy *_strategies[MAX_STRATEGIES];
+// stores the number of strategies loaded so far
+int _strategyCount = 0;
+
+/*
+    Loads a strategy, printing why if it cannot be loaded.
+
+    Parameter
+    ---------
+    `char *name`:
+        Path of the strategy's shared library, or if it has no directory, its name alone, in which case it is
+        loaded from STRATEGY_DIRECTORY/name followed by STRATEGY_SUFFIX.
+
+    Returns
+    -------
+    Returns the strategy, `NULL` if it could not be loaded.
+*/
+const struct Strategy *loadStrategy(char *name)
+{
+    char path[FILENAME_MAX];
+    const struct Strategy *(*entry)(void);
+    const struct Strategy *strategy;
+
+    if (_strategyCount == MAX_STRATEGIES)
+    {
+        printf("Cannot load more than %d strategies.\n", MAX_STRATEGIES);
+        return NULL;
+    }
+
+    if (strchr(name, '/') == NULL && strchr(name, '\\') == NULL)
+        snprintf(path, sizeof path, "%s/%s%s", STRATEGY_DIRECTORY, name, STRATEGY_SUFFIX);
+    else
+        snprintf(path, sizeof path, "%s", name);
+
+#ifdef _WIN32
+    HMODULE library = LoadLibraryA(path);
+
+    if (library == NULL)
+    {
+        printf("Could not load %s.\n", path);
+        return NULL;
+    }
+
+    entry = (const struct Strategy *(*)(void)) GetProcAddress(library, STRATEGY_ENTRY);
+#else
+    void *library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+
+    if (library == NULL)
+    {
+        printf("Could not load strategy: %s\n", dlerror());
+        return NULL;
+    }
+
+    // the way POSIX gives for turning what dlsym returns into a function pointer
+    *(void **) (&entry) = dlsym(library, STRATEGY_ENTRY);
+#endif
+
+    if (entry == NULL || (strategy = entry()) == NULL)
+    {
+        printf("%s does not export a strategy named %s.\n", path, STRATEGY_ENTRY);
+        return NULL;
+    }
+
+    if (strategy->abiVersion != STRATEGY_ABI_VERSION)
+    {
+        printf("%s was built for version %d of the strategy interface, not %d.\n", path, strategy->abiVersion, STRATEGY_ABI_VERSION);
+        return NULL;
+    }
+
+    if (strategy->name == NULL || strlen(strategy->name) >= STRATEGY_NAME_SIZE)
+    {
+        printf("The strategy in %s has no name, or one longer than %d characters.\n", path, STRATEGY_NAME_SIZE - 1);
+        return NULL;
+    }
+
+    if (strategy->init == NULL || strategy->chooseShot == NULL 
+        || strategy->observeResult == NULL || strategy->free == NULL)
+    {
+        printf("%s does not provide every hook of a strategy.\n", path);
+        return NULL;
+    }
+
+    if (findStrategy(strategy->name) != NULL)
+    {
+        printf("A strategy named %s is already loaded.\n", strategy->name);
+        return NULL;
+    }
+
+    _strategies[_strategyCount++] = strategy;
+
+    return strategy;
+}
+
+/*
+    Returns the number of strategies loaded.
+*/
+int countStrategies()
+{
+    return _strategyCount;
+}
+
+/*
+    Returns the strategy loaded at the given index, in the order strategies were loaded, `NULL` if there is
+    none.
+*/
+const struct Strategy *getStrategy(int index)
+{
+    return index >= 0 && index < _strategyCount ? _strategies[index] : NULL;
+}
+
+/*
+    Returns the loaded strategy with the given name, `NULL` if there is none.
+*/
+const struct Strategy *findStrategy(const char *name)
+{
+    for (int i = 0; i < _strategyCount; i++)
+    {
+        if (strcmp(_strategies[i]->name, name) == 0)
+            return _strategies[i];
+    }
+
+    return NULL;
+}
@@ -0,0 +1,246 @@
+/*
+
+File Name: policy.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the policy CPU, which chooses its shots with two tables learned by the trainer (see train.c) instead
+    of searching.
+
+    Every unguessed cell is scored by where it is on the board and by its neighbourhood: the POLICY_REACH cells
+    next to it in each of the four directions, each either unknown, blocked (off the board, a miss, or part of a
+    ship already sunk) or a hit on a ship still afloat. The tables hold the log-odds of a ship being at a cell
+    given each of the two, so that adding them up scores the cell, and the cell with the highest score is
+    guessed. The state of every cell is worked out once per shot into a grid with a blocked border, so that the
+    neighbourhood of a cell takes 4 * POLICY_REACH lookups. Which cells belonged to a sunk ship is worked out
+    from the hits in line with the shot that sank it.
+
+    INCLUDES (user-defined)
+    -----------------------
+    policy.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. void policyStates(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, unsigned char *states)
+    2. int policyPattern(const unsigned char *states, int cell)
+    3. void choosePolicyShot(
+            const short *patterns, const short *cells, char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk,
+            struct CellIndex *unguessed, struct Random *random, int *row, int *col
+        )
+    4. void markPolicySunk(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask *sunk, int row, int col, int length)
+
+    FUNCTIONS (local)
+    -----------------
+    1. int cellState(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, int row, int col)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <policy.h>
+
+// steps to the next cell in each direction, up, right, down and left
+static const int _rowSteps[4] = { -1, 0, 1, 0 };
+static const int _colSteps[4] = { 0, 1, 0, -1 };
+
+int cellState(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, int row, int col);
+
+/*
+    Works out the state of every cell as the policy sees it (see cellState), for policyPattern to look up.
+
+    Parameters
+    ----------
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The action board of the player choosing the shot.
+
+    `struct CellMask sunk`:
+        Cells of ships the player has sunk.
+
+    `unsigned char *states`:
+        Stores the states, POLICY_GRID * POLICY_GRID of them, cell (row, col) being at
+        ((row + POLICY_REACH) * POLICY_GRID) + col + POLICY_REACH and the cells around the board blocked.
+*/
+void policyStates(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, unsigned char *states)
+{
+    for (int row = -POLICY_REACH; row < BOARD_SIZE + POLICY_REACH; row++)
+    {
+        for (int col = -POLICY_REACH; col < BOARD_SIZE + POLICY_REACH; col++)
+            states[((row + POLICY_REACH) * POLICY_GRID) + col + POLICY_REACH] = (unsigned char) cellState(view, sunk, row, col);
+    }
+}
+
+/*
+    Works out the neighbourhood of a cell, the pattern by which the policy scores it.
+
+    Parameters
+    ----------
+    `const unsigned char *states`:
+        The states of the cells, as worked out by policyStates.
+
+    `int cell`:
+        The cell, given as (row * 10) + col.
+
+    Returns
+    -------
+    Returns the pattern, in which the state of the cell k + 1 steps away in direction d is digit
+    (d * POLICY_REACH) + k in base 3.
+*/
+int policyPattern(const unsigned char *states, int cell)
+{
+    const unsigned char *centre = states + ((cell / 10 + POLICY_REACH) * POLICY_GRID) + (cell % 10) + POLICY_REACH;
+    int pattern = 0;
+
+    // digits are added from the last to the first, so that the first ends up lowest
+    for (int direction = 3; direction >= 0; direction--)
+    {
+        int step = (_rowSteps[direction] * POLICY_GRID) + _colSteps[direction];
+
+        for (int steps = POLICY_REACH; steps > 0; steps--)
+            pattern = (pattern * 3) + centre[step * steps];
+    }
+
+    return pattern;
+}
+
+/*
+    Chooses the unguessed cell with the highest score, breaking ties at random.
+
+    Parameters
+    ----------
+    `const short *patterns`:
+        Score of every neighbourhood, POLICY_PATTERNS of them.
+
+    `const short *cells`:
+        Score of every cell of the board, CELLS of them.
+
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The action board of the player choosing the shot, in which cells already chosen for the same salvo hold
+        '*'.
+
+    `struct CellMask sunk`:
+        Cells of ships the player has sunk.
+
+    `struct CellIndex *unguessed`:
+        The cells of view containing ' '.
+
+    `struct Random *random`:
+        Generator used to break ties.
+
+    `int *row`:
+        Stores the row of the chosen cell.
+
+    `int *col`:
+        Stores the column of the chosen cell.
+*/
+void choosePolicyShot(
+    const short *patterns, const short *cells, char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk,
+    struct CellIndex *unguessed, struct Random *random, int *row, int *col
+)
+{
+    unsigned char states[POLICY_GRID * POLICY_GRID];
+    int best = -1, bestScore = 0, ties = 0;
+
+    policyStates(view, sunk, states);
+
+    for (int parity = 0; parity < 2; parity++)
+    {
+        for (int i = 0; i < unguessed->counts[parity]; i++)
+        {
+            int cell = unguessed->cells[parity][i];
+            int score = patterns[policyPattern(states, cell)] + cells[cell];
+
+            // a cell scoring as high as the best so far replaces it with a chance that makes every tie as likely
+            if (best == -1 || score > bestScore)
+            {
+                best = cell;
+                bestScore = score;
+                ties = 1;
+            }
+            else if (score == bestScore && nextRandom(random, ++ties) == 0)
+            {
+                best = cell;
+            }
+        }
+    }
+
+    *row = best / 10;
+    *col = best % 10;
+}
+
+/*
+    Marks the cells of a ship that was just sunk, if they can be told from the hits in line with the shot that
+    sank it: the run of hits on ships still afloat through the cell, either across or down, that is exactly as
+    long as the ship. If neither or both are, only the cell itself is marked.
+
+    Parameters
+    ----------
+    `char view[BOARD_SIZE][BOARD_SIZE]`:
+        The action board of the player who sank the ship.
+
+    `struct CellMask *sunk`:
+        Cells of ships the player has sunk, to which the ship's cells are added.
+
+    `int row`:
+        Row of the shot that sank the ship.
+
+    `int col`:
+        Column of the shot that sank the ship.
+
+    `int length`:
+        Length of the ship.
+*/
+void markPolicySunk(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask *sunk, int row, int col, int length)
+{
+    int runStarts[2], runLengths[2], found = -1, matches = 0;
+
+    // direction 1 is across and direction 2 is down, each counted back from the cell and then forward
+    for (int i = 0; i < 2; i++)
+    {
+        int back = 0, forward = 0, direction = i + 1;
+
+        while (cellState(view, *sunk, row - _rowSteps[direction] * (back + 1), col - _colSteps[direction] * (back + 1)) == 2)
+            back++;
+        while (cellState(view, *sunk, row + _rowSteps[direction] * (forward + 1), col + _colSteps[direction] * (forward + 1)) == 2)
+            forward++;
+
+        runStarts[i] = back;
+        runLengths[i] = back + forward + 1;
+
+        if (runLengths[i] == length)
+        {
+            found = i;
+            matches++;
+        }
+    }
+
+    if (matches != 1)
+    {
+        maskSet(sunk, (row * 10) + col);
+        return;
+    }
+
+    for (int step = -runStarts[found]; step < length - runStarts[found]; step++)
+        maskSet(sunk, ((row + _rowSteps[found + 1] * step) * 10) + col + _colSteps[found + 1] * step);
+}
+
+/*
+    Returns the state of a cell as the policy sees it: 0 if unknown, 1 if blocked, that is off the board, a miss
+    or part of a sunk ship, and 2 if a hit on a ship still afloat.
+*/
+int cellState(char view[BOARD_SIZE][BOARD_SIZE], struct CellMask sunk, int row, int col)
+{
+    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE)
+        return 1;
+
+    switch (view[row][col])
+    {
+        case 'O':
+            return 1;
+
+        case 'X':
+            return maskTest(sunk, (row * 10) + col) ? 1 : 2;
+    }
+
+    return 0;
+}
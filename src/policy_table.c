@@ -0,0 +1,453 @@
+/*
+
+File Name: policy_table.c
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Tables of the policy CPU (see policy.c), generated by running the program with --train-policy, which is
+    how they should be changed rather than by editing this file. Trained on 1000000 games, after which the
+    policy sank a random fleet in 46.34 shots on average.
+
+    INCLUDES (user-defined)
+    -----------------------
+    policy.h
+
+    GLOBAL VARIABLES
+    ----------------
+    1. const short _policyPatterns[POLICY_PATTERNS]
+    2. const short _policyCells[CELLS]
+
+*Compiled using C99 standards*
+
+*/
+
+#include <policy.h>
+
+// log-odds of a hit at a cell with each neighbourhood, times POLICY_SCALE
+const short _policyPatterns[POLICY_PATTERNS] = {
+    -350, -471, -112, -405, -460, -210, -201, -522, 233, -471, -709, -149, -573, -690, -252, -219,
+    -746, 204, -112, -149, 142, -73, 37, 134, 25, -125, 302, -405, -573, -73, -476, -549,
+    -178, -188, -635, 238, -460, -690, 37, -549, -651, -85, -121, -737, 254, -210, -252, 134,
+    -178, -85, 113, -20, -239, 319, -201, -219, 25, -188, -121, -20, -62, -230, 269, -522,
+    -746, -125, -635, -737, -239, -230, -805, 254, 233, 204, 302, 238, 254, 319, 269, 254,
+    363, -471, -533, -271, -504, -498, -402, -300, -581, 112, -709, -888, -384, -811, -835, -423,
+    -379, -912, 145, -149, -133, 52, -109, 27, 62, -7, -49, 208, -573, -667, -266, -643,
+    -645, -472, -319, -708, 124, -690, -864, -228, -809, -830, -458, -298, -905, 136, -252, -339,
+    -36, -218, -122, -24, -93, -229, 199, -219, -211, -64, -211, -129, -122, -122, -192, 160,
+    -746, -930, -297, -873, -907, -516, -368, -923, 112, 204, 213, 321, 230, 276, 329, 280,
+    288, 372, -112, -271, 375, -177, -310, 322, 212, -284, 665, -149, -384, 382, -185, -330,
+    361, 215, -318, 698, 142, 52, 632, 150, 155, 585, 401, 107, 845, -73, -266, 435,
+    -135, -267, 349, 263, -280, 716, 37, -228, 554, -47, -207, 483, 360, -260, 812, 134,
+    -36, 712, 123, 113, 738, 510, 49, 940, 25, -64, 503, 10, -13, 428, 351, -58,
+    810, -125, -297, 496, -131, -257, 437, 346, -286, 839, 302, 321, 472, 298, 320, 494,
+    532, 332, 938, -405, -504, -177, -464, -506, -316, -258, -560, 235, -573, -811, -185, -690,
+    -789, -360, -267, -865, 191, -73, -109, 150, -79, 19, 106, 64, -56, 307, -476, -643,
+    -135, -575, -624, -299, -231, -690, 229, -549, -809, -47, -674, -777, -223, -176, -855, 258,
+    -178, -218, 123, -161, -97, 98, -2, -138, 306, -188, -211, 10, -181, -135, -60, -60,
+    -202, 233, -635, -873, -131, -751, -861, -315, -243, -906, 213, 238, 230, 298, 236, 266,
+    310, 282, 282, 404, -460, -498, -310, -506, -540, -414, -327, -582, 211, -690, -835, -330,
+    -789, -830, -439, -378, -894, 88, 37, 27, 155, 19, 48, 129, 104, 62, 247, -549,
+    -645, -267, -624, -650, -448, -313, -688, 147, -651, -830, -207, -777, -825, -450, -282, -874,
+    158, -85, -122, 113, -97, -66, 106, 34, -20, 245, -121, -129, -13, -135, -109, -78,
+    -66, -131, 157, -737, -907, -257, -861, -918, -508, -345, -946, 141, 254, 276, 320, 266,
+    332, 347, 317, 327, 424, -210, -402, 322, -316, -414, 214, 131, -452, 592, -252, -423,
+    361, -360, -439, 284, 141, -518, 651, 134, 62, 585, 106, 129, 542, 391, 113, 899,
+    -178, -472, 349, -299, -448, 252, 198, -478, 682, -85, -458, 483, -223, -450, 377, 297,
+    -515, 796, 113, -24, 738, 98, 106, 698, 491, 90, 991, -20, -122, 428, -60, -78,
+    403, 307, -107, 729, -239, -516, 437, -315, -508, 449, 290, -487, 863, 319, 329, 494,
+    310, 347, 478, 456, 375, 1311, -201, -300, 212, -258, -327, 131, 52, -320, 487, -219,
+    -379, 215, -267, -378, 141, 45, -387, 509, 25, -7, 401, 64, 104, 391, 230, 44,
+    529, -188, -319, 263, -231, -313, 198, 86, -341, 516, -121, -298, 360, -176, -282, 297,
+    160, -331, 589, -20, -93, 510, -2, 34, 491, 196, -50, 648, -62, -122, 351, -60,
+    -66, 307, 146, -89, 593, -230, -368, 346, -243, -345, 290, 99, -376, 619, 269, 280,
+    532, 282, 317, 456, 333, 399, 565, -522, -581, -284, -560, -582, -452, -320, -583, 91,
+    -746, -912, -318, -865, -894, -518, -387, -973, 153, -125, -49, 107, -56, 62, 113, 44,
+    46, 286, -635, -708, -280, -690, -688, -478, -341, -745, 112, -737, -905, -260, -855, -874,
+    -515, -331, -896, 162, -239, -229, 49, -138, -20, 90, -50, -131, 296, -230, -192, -58,
+    -202, -131, -107, -89, -141, 124, -805, -923, -286, -906, -946, -487, -376, -882, 157, 254,
+    288, 332, 282, 327, 375, 399, 425, 303, 233, 112, 665, 235, 211, 592, 487, 91,
+    1041, 204, 145, 698, 191, 88, 651, 509, 153, 1047, 302, 208, 845, 307, 247, 899,
+    529, 286, 1866, 238, 124, 716, 229, 147, 682, 516, 112, 1079, 254, 136, 812, 258,
+    158, 796, 589, 162, 1043, 319, 199, 940, 306, 245, 991, 648, 296, 1294, 269, 160,
+    810, 233, 157, 729, 593, 124, 1055, 254, 112, 839, 213, 141, 863, 619, 157, 1094,
+    363, 372, 938, 404, 424, 1311, 565, 303, 822, -471, -709, -149, -573, -690, -252, -219,
+    -746, 204, -533, -888, -133, -667, -864, -339, -211, -930, 213, -271, -384, 52, -266, -228,
+    -36, -64, -297, 321, -504, -811, -109, -643, -809, -218, -211, -873, 230, -498, -835, 27,
+    -645, -830, -122, -129, -907, 276, -402, -423, 62, -472, -458, -24, -122, -516, 329, -300,
+    -379, -7, -319, -298, -93, -122, -368, 280, -581, -912, -49, -708, -905, -229, -192, -923,
+    288, 112, 145, 208, 124, 136, 199, 160, 112, 372, -709, -888, -384, -811, -835, -423,
+    -379, -912, 145, -888, -4656, -437, -1161, -3478, -621, -415, -2393, 116, -384, -437, -95, -419,
+    -268, -156, -152, -304, 171, -811, -1161, -419, -967, -1056, -400, -409, -1224, 181, -835, -3478,
+    -268, -1056, -3624, -499, -308, -2759, 165, -423, -621, -156, -400, -499, -287, -238, -646, 198,
+    -379, -415, -152, -409, -308, -238, -193, -366, 129, -912, -2393, -304, -1224, -2759, -646, -366,
+    -3115, 167, 145, 116, 171, 181, 165, 198, 129, 167, 296, -149, -384, 382, -185, -330,
+    361, 215, -318, 698, -133, -437, 379, -186, -327, 318, 220, -322, 746, 52, -95, 600,
+    28, -15, 548, 379, -56, 892, -109, -419, 439, -195, -303, 399, 265, -323, 736, 27,
+    -268, 545, -64, -234, 485, 344, -265, 846, 62, -156, 671, 9, -81, 714, 450, -133,
+    1009, -7, -152, 502, -46, -107, 452, 320, -128, 843, -49, -304, 559, -114, -247, 486,
+    331, -248, 846, 208, 171, 487, 197, 225, 510, 354, 219, 831, -573, -811, -185, -690,
+    -789, -360, -267, -865, 191, -667, -1161, -186, -850, -1086, -401, -270, -1241, 187, -266, -419,
+    28, -278, -234, -50, -70, -275, 268, -643, -967, -195, -784, -914, -316, -255, -1030, 225,
+    -645, -1056, -64, -809, -1026, -237, -195, -1231, 260, -472, -400, 9, -465, -470, -82, -139,
+    -505, 315, -319, -409, -46, -332, -309, -127, -129, -357, 251, -708, -1224, -114, -922, -1235,
+    -289, -238, -1344, 268, 124, 181, 197, 143, 165, 213, 165, 154, 410, -690, -835, -330,
+    -789, -830, -439, -378, -894, 88, -864, -3478, -327, -1086, -4816, -552, -386, -2550, 107, -228,
+    -268, -15, -234, -202, -79, -85, -179, 193, -809, -1056, -303, -914, -984, -434, -373, -1138,
+    128, -830, -3624, -234, -1026, -3122, -499, -309, -2461, 180, -458, -499, -81, -470, -464, -200,
+    -200, -454, 258, -298, -308, -107, -309, -272, -193, -153, -285, 173, -905, -2759, -247, -1235,
+    -2534, -525, -342, -3265, 182, 136, 165, 225, 165, 234, 232, 216, 204, 358, -252, -423,
+    361, -360, -439, 284, 141, -518, 651, -339, -621, 318, -401, -552, 253, 165, -609, 704,
+    -36, -156, 548, -50, -79, 546, 373, -128, 819, -218, -400, 399, -316, -434, 322, 207,
+    -495, 746, -122, -499, 485, -237, -499, 427, 313, -553, 874, -24, -287, 714, -82, -200,
+    777, 453, -203, 1015, -93, -238, 452, -127, -193, 432, 309, -170, 824, -229, -646, 486,
+    -289, -525, 459, 298, -539, 915, 199, 198, 510, 213, 232, 535, 301, 246, 841, -219,
+    -379, 215, -267, -378, 141, 45, -387, 509, -211, -415, 220, -270, -386, 165, 58, -438,
+    531, -64, -152, 379, -70, -85, 373, 156, -114, 584, -211, -409, 265, -255, -373, 207,
+    81, -395, 543, -129, -308, 344, -195, -309, 313, 154, -350, 639, -122, -238, 450, -139,
+    -200, 453, 266, -134, 678, -122, -193, 320, -129, -153, 309, 139, -162, 640, -192, -366,
+    331, -238, -342, 298, 168, -428, 672, 160, 129, 354, 165, 216, 301, 342, 162, 669,
+    -746, -912, -318, -865, -894, -518, -387, -973, 153, -930, -2393, -322, -1241, -2550, -609, -438,
+    -3099, 173, -297, -304, -56, -275, -179, -128, -114, -132, 296, -873, -1224, -323, -1030, -1138,
+    -495, -395, -1423, 139, -907, -2759, -265, -1231, -2461, -553, -350, -3235, 188, -516, -646, -133,
+    -505, -454, -203, -134, -545, 206, -368, -366, -128, -357, -285, -170, -162, -402, 207, -923,
+    -3115, -248, -1344, -3265, -539, -428, -2419, 320, 112, 167, 219, 154, 204, 246, 162, 163,
+    425, 204, 145, 698, 191, 88, 651, 509, 153, 1047, 213, 116, 746, 187, 107, 704,
+    531, 173, 1125, 321, 171, 892, 268, 193, 819, 584, 296, 1392, 230, 181, 736, 225,
+    128, 746, 543, 139, 1128, 276, 165, 846, 260, 180, 874, 639, 188, 1245, 329, 198,
+    1009, 315, 258, 1015, 678, 206, 1433, 280, 129, 843, 251, 173, 824, 640, 207, 1365,
+    288, 167, 846, 268, 182, 915, 672, 320, 1337, 372, 296, 831, 410, 358, 841, 669,
+    425, 1752, -112, -149, 142, -73, 37, 134, 25, -125, 302, -271, -384, 52, -266, -228,
+    -36, -64, -297, 321, 375, 382, 632, 435, 554, 712, 503, 496, 472, -177, -185, 150,
+    -135, -47, 123, 10, -131, 298, -310, -330, 155, -267, -207, 113, -13, -257, 320, 322,
+    361, 585, 349, 483, 738, 428, 437, 494, 212, 215, 401, 263, 360, 510, 351, 346,
+    532, -284, -318, 107, -280, -260, 49, -58, -286, 332, 665, 698, 845, 716, 812, 940,
+    810, 839, 938, -149, -133, 52, -109, 27, 62, -7, -49, 208, -384, -437, -95, -419,
+    -268, -156, -152, -304, 171, 382, 379, 600, 439, 545, 671, 502, 559, 487, -185, -186,
+    28, -195, -64, 9, -46, -114, 197, -330, -327, -15, -303, -234, -81, -107, -247, 225,
+    361, 318, 548, 399, 485, 714, 452, 486, 510, 215, 220, 379, 265, 344, 450, 320,
+    331, 354, -318, -322, -56, -323, -265, -133, -128, -248, 219, 698, 746, 892, 736, 846,
+    1009, 843, 846, 831, 142, 52, 632, 150, 155, 585, 401, 107, 845, 52, -95, 600,
+    28, -15, 548, 379, -56, 892, 632, 600, 1184, 653, 738, 1133, 893, 758, 1073, 150,
+    28, 653, 129, 94, 634, 417, 62, 865, 155, -15, 738, 94, 23, 703, 501, -17,
+    1019, 585, 548, 1133, 634, 703, 976, 782, 877, 1653, 401, 379, 893, 417, 501, 782,
+    752, 486, 808, 107, -56, 758, 62, -17, 877, 486, 473, 922, 845, 892, 1073, 865,
+    1019, 1653, 808, 922, 901, -73, -109, 150, -79, 19, 106, 64, -56, 307, -266, -419,
+    28, -278, -234, -50, -70, -275, 268, 435, 439, 653, 461, 538, 769, 591, 573, 667,
+    -135, -195, 129, -97, -43, 83, 40, -70, 290, -267, -303, 94, -258, -219, 44, -35,
+    -220, 320, 349, 399, 634, 392, 489, 674, 514, 527, 533, 263, 265, 417, 285, 365,
+    496, 351, 369, 503, -280, -323, 62, -273, -256, 62, -56, -205, 286, 716, 736, 865,
+    769, 859, 920, 843, 940, 1004, 37, 27, 155, 19, 48, 129, 104, 62, 247, -228,
+    -268, -15, -234, -202, -79, -85, -179, 193, 554, 545, 738, 538, 596, 824, 631, 666,
+    727, -47, -64, 94, -43, -32, 66, 39, -8, 231, -207, -234, 23, -219, -189, -40,
+    -61, -164, 261, 483, 485, 703, 489, 584, 855, 663, 671, 594, 360, 344, 501, 365,
+    409, 551, 450, 495, 473, -260, -265, -17, -256, -225, -17, -90, -173, 296, 812, 846,
+    1019, 859, 972, 1114, 918, 999, 920, 134, 62, 585, 106, 129, 542, 391, 113, 899,
+    -36, -156, 548, -50, -79, 546, 373, -128, 819, 712, 671, 1133, 769, 824, 959, 1174,
+    801, 1234, 123, 9, 634, 83, 66, 584, 451, 79, 889, 113, -81, 703, 44, -40,
+    696, 498, -31, 1003, 738, 714, 976, 674, 855, 1525, 1118, 1063, 1173, 510, 450, 782,
+    496, 551, 1036, 798, 421, 1110, 49, -133, 877, 62, -17, 707, 470, 119, 954, 940,
+    1009, 1653, 920, 1114, 1781, 1669, 1129, 1387, 25, -7, 401, 64, 104, 391, 230, 44,
+    529, -64, -152, 379, -70, -85, 373, 156, -114, 584, 503, 502, 893, 591, 631, 1174,
+    817, 754, 1585, 10, -46, 417, 40, 39, 451, 230, 3, 630, -13, -107, 501, -35,
+    -61, 498, 300, -94, 739, 428, 452, 782, 514, 663, 1118, 521, 601, 1150, 351, 320,
+    752, 351, 450, 798, 489, 423, 1412, -58, -128, 486, -56, -90, 470, 216, -35, 782,
+    810, 843, 808, 843, 918, 1669, 1685, 1174, 1159, -125, -49, 107, -56, 62, 113, 44,
+    46, 286, -297, -304, -56, -275, -179, -128, -114, -132, 296, 496, 559, 758, 573, 666,
+    801, 754, 952, 1377, -131, -114, 62, -70, -8, 79, 3, -51, 289, -257, -247, -17,
+    -220, -164, -31, -94, -140, 319, 437, 486, 877, 527, 671, 1063, 601, 599, 738, 346,
+    331, 486, 369, 495, 421, 423, 881, 863, -286, -248, 473, -205, -173, 119, -35, -628,
+    627, 839, 846, 922, 940, 999, 1129, 1174, 945, 1104, 302, 208, 845, 307, 247, 899,
+    529, 286, 1866, 321, 171, 892, 268, 193, 819, 584, 296, 1392, 472, 487, 1073, 667,
+    727, 1234, 1585, 1377, 1559, 298, 197, 865, 290, 231, 889, 630, 289, 1253, 320, 225,
+    1019, 320, 261, 1003, 739, 319, 1373, 494, 510, 1653, 533, 594, 1173, 1150, 738, 1589,
+    532, 354, 808, 503, 473, 1110, 1412, 863, 1552, 332, 219, 922, 286, 296, 954, 782,
+    627, 1479, 938, 831, 901, 1004, 920, 1387, 1159, 1104, 154, -405, -573, -73, -476, -549,
+    -178, -188, -635, 238, -504, -811, -109, -643, -809, -218, -211, -873, 230, -177, -185, 150,
+    -135, -47, 123, 10, -131, 298, -464, -690, -79, -575, -674, -161, -181, -751, 236, -506,
+    -789, 19, -624, -777, -97, -135, -861, 266, -316, -360, 106, -299, -223, 98, -60, -315,
+    310, -258, -267, 64, -231, -176, -2, -60, -243, 282, -560, -865, -56, -690, -855, -138,
+    -202, -906, 282, 235, 191, 307, 229, 258, 306, 233, 213, 404, -573, -667, -266, -643,
+    -645, -472, -319, -708, 124, -811, -1161, -419, -967, -1056, -400, -409, -1224, 181, -185, -186,
+    28, -195, -64, 9, -46, -114, 197, -690, -850, -278, -784, -809, -465, -332, -922, 143,
+    -789, -1086, -234, -914, -1026, -470, -309, -1235, 165, -360, -401, -50, -316, -237, -82, -127,
+    -289, 213, -267, -270, -70, -255, -195, -139, -129, -238, 165, -865, -1241, -275, -1030, -1231,
+    -505, -357, -1344, 154, 191, 187, 268, 225, 260, 315, 251, 268, 410, -73, -266, 435,
+    -135, -267, 349, 263, -280, 716, -109, -419, 439, -195, -303, 399, 265, -323, 736, 150,
+    28, 653, 129, 94, 634, 417, 62, 865, -79, -278, 461, -97, -258, 392, 285, -273,
+    769, 19, -234, 538, -43, -219, 489, 365, -256, 859, 106, -50, 769, 83, 44, 674,
+    496, 62, 920, 64, -70, 591, 40, -35, 514, 351, -56, 843, -56, -275, 573, -70,
+    -220, 527, 369, -205, 940, 307, 268, 667, 290, 320, 533, 503, 286, 1004, -476, -643,
+    -135, -575, -624, -299, -231, -690, 229, -643, -967, -195, -784, -914, -316, -255, -1030, 225,
+    -135, -195, 129, -97, -43, 83, 40, -70, 290, -575, -784, -97, -683, -742, -293, -233,
+    -854, 225, -624, -914, -43, -742, -840, -211, -185, -1052, 275, -299, -316, 83, -293, -211,
+    62, -54, -227, 297, -231, -255, 40, -233, -185, -54, -77, -218, 263, -690, -1030, -70,
+    -854, -1052, -227, -218, -1149, 257, 229, 225, 290, 225, 275, 297, 263, 257, 370, -549,
+    -645, -267, -624, -650, -448, -313, -688, 147, -809, -1056, -303, -914, -984, -434, -373, -1138,
+    128, -47, -64, 94, -43, -32, 66, 39, -8, 231, -674, -809, -258, -742, -833, -462,
+    -319, -892, 150, -777, -1026, -219, -840, -1035, -483, -299, -1212, 194, -223, -237, 44, -211,
+    -184, 12, -57, -134, 263, -176, -195, -35, -185, -163, -104, -83, -169, 198, -855, -1231,
+    -220, -1052, -1264, -470, -325, -1313, 195, 258, 260, 320, 275, 333, 346, 290, 314, 422,
+    -178, -472, 349, -299, -448, 252, 198, -478, 682, -218, -400, 399, -316, -434, 322, 207,
+    -495, 746, 123, 9, 634, 83, 66, 584, 451, 79, 889, -161, -465, 392, -293, -462,
+    325, 226, -510, 736, -97, -470, 489, -211, -483, 441, 324, -521, 884, 98, -82, 674,
+    62, 12, 769, 540, 66, 1011, -2, -139, 514, -54, -104, 454, 339, -140, 864, -138,
+    -505, 527, -227, -470, 551, 325, -585, 943, 306, 315, 533, 297, 346, 492, 465, 266,
+    838, -188, -319, 263, -231, -313, 198, 86, -341, 516, -211, -409, 265, -255, -373, 207,
+    81, -395, 543, 10, -46, 417, 40, 39, 451, 230, 3, 630, -181, -332, 285, -233,
+    -319, 226, 111, -346, 587, -135, -309, 365, -185, -299, 324, 158, -327, 646, -60, -127,
+    496, -54, -57, 540, 225, -77, 735, -60, -129, 351, -77, -83, 339, 133, -150, 599,
+    -202, -357, 369, -218, -325, 325, 121, -351, 671, 233, 251, 503, 263, 290, 465, 436,
+    317, 647, -635, -708, -280, -690, -688, -478, -341, -745, 112, -873, -1224, -323, -1030, -1138,
+    -495, -395, -1423, 139, -131, -114, 62, -70, -8, 79, 3, -51, 289, -751, -922, -273,
+    -854, -892, -510, -346, -934, 175, -861, -1235, -256, -1052, -1212, -521, -327, -1391, 224, -315,
+    -289, 62, -227, -134, 66, -77, -166, 271, -243, -238, -56, -218, -169, -140, -150, -164,
+    267, -906, -1344, -205, -1149, -1313, -585, -351, -2459, 228, 213, 268, 286, 257, 314, 266,
+    317, 391, 374, 238, 124, 716, 229, 147, 682, 516, 112, 1079, 230, 181, 736, 225,
+    128, 746, 543, 139, 1128, 298, 197, 865, 290, 231, 889, 630, 289, 1253, 236, 143,
+    769, 225, 150, 736, 587, 175, 1169, 266, 165, 859, 275, 194, 884, 646, 224, 1226,
+    310, 213, 920, 297, 263, 1011, 735, 271, 1300, 282, 165, 843, 263, 198, 864, 599,
+    267, 1173, 282, 154, 940, 257, 195, 943, 671, 228, 1194, 404, 410, 1004, 370, 422,
+    838, 647, 374, 1132, -460, -690, 37, -549, -651, -85, -121, -737, 254, -498, -835, 27,
+    -645, -830, -122, -129, -907, 276, -310, -330, 155, -267, -207, 113, -13, -257, 320, -506,
+    -789, 19, -624, -777, -97, -135, -861, 266, -540, -830, 48, -650, -825, -66, -109, -918,
+    332, -414, -439, 129, -448, -450, 106, -78, -508, 347, -327, -378, 104, -313, -282, 34,
+    -66, -345, 317, -582, -894, 62, -688, -874, -20, -131, -946, 327, 211, 88, 247, 147,
+    158, 245, 157, 141, 424, -690, -864, -228, -809, -830, -458, -298, -905, 136, -835, -3478,
+    -268, -1056, -3624, -499, -308, -2759, 165, -330, -327, -15, -303, -234, -81, -107, -247, 225,
+    -789, -1086, -234, -914, -1026, -470, -309, -1235, 165, -830, -4816, -202, -984, -3122, -464, -272,
+    -2534, 234, -439, -552, -79, -434, -499, -200, -193, -525, 232, -378, -386, -85, -373, -309,
+    -200, -153, -342, 216, -894, -2550, -179, -1138, -2461, -454, -285, -3265, 204, 88, 107, 193,
+    128, 180, 258, 173, 182, 358, 37, -228, 554, -47, -207, 483, 360, -260, 812, 27,
+    -268, 545, -64, -234, 485, 344, -265, 846, 155, -15, 738, 94, 23, 703, 501, -17,
+    1019, 19, -234, 538, -43, -219, 489, 365, -256, 859, 48, -202, 596, -32, -189, 584,
+    409, -225, 972, 129, -79, 824, 66, -40, 855, 551, -17, 1114, 104, -85, 631, 39,
+    -61, 663, 450, -90, 918, 62, -179, 666, -8, -164, 671, 495, -173, 999, 247, 193,
+    727, 231, 261, 594, 473, 296, 920, -549, -809, -47, -674, -777, -223, -176, -855, 258,
+    -645, -1056, -64, -809, -1026, -237, -195, -1231, 260, -267, -303, 94, -258, -219, 44, -35,
+    -220, 320, -624, -914, -43, -742, -840, -211, -185, -1052, 275, -650, -984, -32, -833, -1035,
+    -184, -163, -1264, 333, -448, -434, 66, -462, -483, 12, -104, -470, 346, -313, -373, 39,
+    -319, -299, -57, -83, -325, 290, -688, -1138, -8, -892, -1212, -134, -169, -1313, 314, 147,
+    128, 231, 150, 194, 263, 198, 195, 422, -651, -830, -207, -777, -825, -450, -282, -874,
+    158, -830, -3624, -234, -1026, -3122, -499, -309, -2461, 180, -207, -234, 23, -219, -189, -40,
+    -61, -164, 261, -777, -1026, -219, -840, -1035, -483, -299, -1212, 194, -825, -3122, -189, -1035,
+    -3084, -423, -272, -2389, 290, -450, -499, -40, -483, -423, -139, -163, -410, 304, -282, -309,
+    -61, -299, -272, -163, -121, -282, 229, -874, -2461, -164, -1212, -2389, -410, -282, -2246, 271,
+    158, 180, 261, 194, 290, 304, 229, 271, 423, -85, -458, 483, -223, -450, 377, 297,
+    -515, 796, -122, -499, 485, -237, -499, 427, 313, -553, 874, 113, -81, 703, 44, -40,
+    696, 498, -31, 1003, -97, -470, 489, -211, -483, 441, 324, -521, 884, -66, -464, 584,
+    -184, -423, 584, 416, -475, 1049, 106, -200, 855, 12, -139, 883, 556, -109, 1204, 34,
+    -200, 663, -57, -163, 611, 474, -162, 983, -20, -454, 671, -134, -410, 681, 491, -423,
+    1087, 245, 258, 594, 263, 304, 641, 481, 277, 988, -121, -298, 360, -176, -282, 297,
+    160, -331, 589, -129, -308, 344, -195, -309, 313, 154, -350, 639, -13, -107, 501, -35,
+    -61, 498, 300, -94, 739, -135, -309, 365, -185, -299, 324, 158, -327, 646, -109, -272,
+    409, -163, -272, 416, 200, -301, 745, -78, -193, 551, -104, -163, 556, 244, -212, 765,
+    -66, -153, 450, -83, -121, 474, 183, -185, 667, -131, -285, 495, -169, -282, 491, 191,
+    -322, 684, 157, 173, 473, 198, 229, 481, 407, 201, 732, -737, -905, -260, -855, -874,
+    -515, -331, -896, 162, -907, -2759, -265, -1231, -2461, -553, -350, -3235, 188, -257, -247, -17,
+    -220, -164, -31, -94, -140, 319, -861, -1235, -256, -1052, -1212, -521, -327, -1391, 224, -918,
+    -2534, -225, -1264, -2389, -475, -301, -3480, 285, -508, -525, -17, -470, -410, -109, -212, -368,
+    337, -345, -342, -90, -325, -282, -162, -185, -343, 286, -946, -3265, -173, -1313, -2246, -423,
+    -322, -2653, 244, 141, 182, 296, 195, 271, 277, 201, 241, 426, 254, 136, 812, 258,
+    158, 796, 589, 162, 1043, 276, 165, 846, 260, 180, 874, 639, 188, 1245, 320, 225,
+    1019, 320, 261, 1003, 739, 319, 1373, 266, 165, 859, 275, 194, 884, 646, 224, 1226,
+    332, 234, 972, 333, 290, 1049, 745, 285, 1422, 347, 232, 1114, 346, 304, 1204, 765,
+    337, 1288, 317, 216, 918, 290, 229, 983, 667, 286, 1071, 327, 204, 999, 314, 271,
+    1087, 684, 244, 1362, 424, 358, 920, 422, 423, 988, 732, 426, 1503, -210, -252, 134,
+    -178, -85, 113, -20, -239, 319, -402, -423, 62, -472, -458, -24, -122, -516, 329, 322,
+    361, 585, 349, 483, 738, 428, 437, 494, -316, -360, 106, -299, -223, 98, -60, -315,
+    310, -414, -439, 129, -448, -450, 106, -78, -508, 347, 214, 284, 542, 252, 377, 698,
+    403, 449, 478, 131, 141, 391, 198, 297, 491, 307, 290, 456, -452, -518, 113, -478,
+    -515, 90, -107, -487, 375, 592, 651, 899, 682, 796, 991, 729, 863, 1311, -252, -339,
+    -36, -218, -122, -24, -93, -229, 199, -423, -621, -156, -400, -499, -287, -238, -646, 198,
+    361, 318, 548, 399, 485, 714, 452, 486, 510, -360, -401, -50, -316, -237, -82, -127,
+    -289, 213, -439, -552, -79, -434, -499, -200, -193, -525, 232, 284, 253, 546, 322, 427,
+    777, 432, 459, 535, 141, 165, 373, 207, 313, 453, 309, 298, 301, -518, -609, -128,
+    -495, -553, -203, -170, -539, 246, 651, 704, 819, 746, 874, 1015, 824, 915, 841, 134,
+    -36, 712, 123, 113, 738, 510, 49, 940, 62, -156, 671, 9, -81, 714, 450, -133,
+    1009, 585, 548, 1133, 634, 703, 976, 782, 877, 1653, 106, -50, 769, 83, 44, 674,
+    496, 62, 920, 129, -79, 824, 66, -40, 855, 551, -17, 1114, 542, 546, 959, 584,
+    696, 1525, 1036, 707, 1781, 391, 373, 1174, 451, 498, 1118, 798, 470, 1669, 113, -128,
+    801, 79, -31, 1063, 421, 119, 1129, 899, 819, 1234, 889, 1003, 1173, 1110, 954, 1387,
+    -178, -218, 123, -161, -97, 98, -2, -138, 306, -472, -400, 9, -465, -470, -82, -139,
+    -505, 315, 349, 399, 634, 392, 489, 674, 514, 527, 533, -299, -316, 83, -293, -211,
+    62, -54, -227, 297, -448, -434, 66, -462, -483, 12, -104, -470, 346, 252, 322, 584,
+    325, 441, 769, 454, 551, 492, 198, 207, 451, 226, 324, 540, 339, 325, 465, -478,
+    -495, 79, -510, -521, 66, -140, -585, 266, 682, 746, 889, 736, 884, 1011, 864, 943,
+    838, -85, -122, 113, -97, -66, 106, 34, -20, 245, -458, -499, -81, -470, -464, -200,
+    -200, -454, 258, 483, 485, 703, 489, 584, 855, 663, 671, 594, -223, -237, 44, -211,
+    -184, 12, -57, -134, 263, -450, -499, -40, -483, -423, -139, -163, -410, 304, 377, 427,
+    696, 441, 584, 883, 611, 681, 641, 297, 313, 498, 324, 416, 556, 474, 491, 481,
+    -515, -553, -31, -521, -475, -109, -162, -423, 277, 796, 874, 1003, 884, 1049, 1204, 983,
+    1087, 988, 113, -24, 738, 98, 106, 698, 491, 90, 991, -24, -287, 714, -82, -200,
+    777, 453, -203, 1015, 738, 714, 976, 674, 855, 1525, 1118, 1063, 1173, 98, -82, 674,
+    62, 12, 769, 540, 66, 1011, 106, -200, 855, 12, -139, 883, 556, -109, 1204, 698,
+    777, 1525, 769, 883, 2112, 1855, 1863, 1134, 491, 453, 1118, 540, 556, 1855, 977, 639,
+    1681, 90, -203, 1063, 66, -109, 1863, 639, 220, 1314, 991, 1015, 1173, 1011, 1204, 1134,
+    1681, 1314, 766, -20, -93, 510, -2, 34, 491, 196, -50, 648, -122, -238, 450, -139,
+    -200, 453, 266, -134, 678, 428, 452, 782, 514, 663, 1118, 521, 601, 1150, -60, -127,
+    496, -54, -57, 540, 225, -77, 735, -78, -193, 551, -104, -163, 556, 244, -212, 765,
+    403, 432, 1036, 454, 611, 1855, 1298, 714, 1434, 307, 309, 798, 339, 474, 977, 514,
+    727, 968, -107, -170, 421, -140, -162, 639, -36, -262, 638, 729, 824, 1110, 864, 983,
+    1681, 1681, 854, 779, -239, -229, 49, -138, -20, 90, -50, -131, 296, -516, -646, -133,
+    -505, -454, -203, -134, -545, 206, 437, 486, 877, 527, 671, 1063, 601, 599, 738, -315,
+    -289, 62, -227, -134, 66, -77, -166, 271, -508, -525, -17, -470, -410, -109, -212, -368,
+    337, 449, 459, 707, 551, 681, 1863, 714, 557, 443, 290, 298, 470, 325, 491, 639,
+    727, 461, 460, -487, -539, 119, -585, -423, 220, -262, -329, 295, 863, 915, 954, 943,
+    1087, 1314, 854, 1777, 1179, 319, 199, 940, 306, 245, 991, 648, 296, 1294, 329, 198,
+    1009, 315, 258, 1015, 678, 206, 1433, 494, 510, 1653, 533, 594, 1173, 1150, 738, 1589,
+    310, 213, 920, 297, 263, 1011, 735, 271, 1300, 347, 232, 1114, 346, 304, 1204, 765,
+    337, 1288, 478, 535, 1781, 492, 641, 1134, 1434, 443, 1653, 456, 301, 1669, 465, 481,
+    1681, 968, 460, 1489, 375, 246, 1129, 266, 277, 1314, 638, 295, 1675, 1311, 841, 1387,
+    838, 988, 766, 779, 1179, 1066, -201, -219, 25, -188, -121, -20, -62, -230, 269, -300,
+    -379, -7, -319, -298, -93, -122, -368, 280, 212, 215, 401, 263, 360, 510, 351, 346,
+    532, -258, -267, 64, -231, -176, -2, -60, -243, 282, -327, -378, 104, -313, -282, 34,
+    -66, -345, 317, 131, 141, 391, 198, 297, 491, 307, 290, 456, 52, 45, 230, 86,
+    160, 196, 146, 99, 333, -320, -387, 44, -341, -331, -50, -89, -376, 399, 487, 509,
+    529, 516, 589, 648, 593, 619, 565, -219, -211, -64, -211, -129, -122, -122, -192, 160,
+    -379, -415, -152, -409, -308, -238, -193, -366, 129, 215, 220, 379, 265, 344, 450, 320,
+    331, 354, -267, -270, -70, -255, -195, -139, -129, -238, 165, -378, -386, -85, -373, -309,
+    -200, -153, -342, 216, 141, 165, 373, 207, 313, 453, 309, 298, 301, 45, 58, 156,
+    81, 154, 266, 139, 168, 342, -387, -438, -114, -395, -350, -134, -162, -428, 162, 509,
+    531, 584, 543, 639, 678, 640, 672, 669, 25, -64, 503, 10, -13, 428, 351, -58,
+    810, -7, -152, 502, -46, -107, 452, 320, -128, 843, 401, 379, 893, 417, 501, 782,
+    752, 486, 808, 64, -70, 591, 40, -35, 514, 351, -56, 843, 104, -85, 631, 39,
+    -61, 663, 450, -90, 918, 391, 373, 1174, 451, 498, 1118, 798, 470, 1669, 230, 156,
+    817, 230, 300, 521, 489, 216, 1685, 44, -114, 754, 3, -94, 601, 423, -35, 1174,
+    529, 584, 1585, 630, 739, 1150, 1412, 782, 1159, -188, -211, 10, -181, -135, -60, -60,
+    -202, 233, -319, -409, -46, -332, -309, -127, -129, -357, 251, 263, 265, 417, 285, 365,
+    496, 351, 369, 503, -231, -255, 40, -233, -185, -54, -77, -218, 263, -313, -373, 39,
+    -319, -299, -57, -83, -325, 290, 198, 207, 451, 226, 324, 540, 339, 325, 465, 86,
+    81, 230, 111, 158, 225, 133, 121, 436, -341, -395, 3, -346, -327, -77, -150, -351,
+    317, 516, 543, 630, 587, 646, 735, 599, 671, 647, -121, -129, -13, -135, -109, -78,
+    -66, -131, 157, -298, -308, -107, -309, -272, -193, -153, -285, 173, 360, 344, 501, 365,
+    409, 551, 450, 495, 473, -176, -195, -35, -185, -163, -104, -83, -169, 198, -282, -309,
+    -61, -299, -272, -163, -121, -282, 229, 297, 313, 498, 324, 416, 556, 474, 491, 481,
+    160, 154, 300, 158, 200, 244, 183, 191, 407, -331, -350, -94, -327, -301, -212, -185,
+    -322, 201, 589, 639, 739, 646, 745, 765, 667, 684, 732, -20, -122, 428, -60, -78,
+    403, 307, -107, 729, -93, -238, 452, -127, -193, 432, 309, -170, 824, 510, 450, 782,
+    496, 551, 1036, 798, 421, 1110, -2, -139, 514, -54, -104, 454, 339, -140, 864, 34,
+    -200, 663, -57, -163, 611, 474, -162, 983, 491, 453, 1118, 540, 556, 1855, 977, 639,
+    1681, 196, 266, 521, 225, 244, 1298, 514, -36, 1681, -50, -134, 601, -77, -212, 714,
+    727, -262, 854, 648, 678, 1150, 735, 765, 1434, 968, 638, 779, -62, -122, 351, -60,
+    -66, 307, 146, -89, 593, -122, -193, 320, -129, -153, 309, 139, -162, 640, 351, 320,
+    752, 351, 450, 798, 489, 423, 1412, -60, -129, 351, -77, -83, 339, 133, -150, 599,
+    -66, -153, 450, -83, -121, 474, 183, -185, 667, 307, 309, 798, 339, 474, 977, 514,
+    727, 968, 146, 139, 489, 133, 183, 514, 346, 342, 353, -89, -162, 423, -150, -185,
+    727, 342, -95, 526, 593, 640, 1412, 599, 667, 968, 353, 526, 1052, -230, -192, -58,
+    -202, -131, -107, -89, -141, 124, -368, -366, -128, -357, -285, -170, -162, -402, 207, 346,
+    331, 486, 369, 495, 421, 423, 881, 863, -243, -238, -56, -218, -169, -140, -150, -164,
+    267, -345, -342, -90, -325, -282, -162, -185, -343, 286, 290, 298, 470, 325, 491, 639,
+    727, 461, 460, 99, 168, 216, 121, 191, -36, 342, 437, 549, -376, -428, -35, -351,
+    -322, -262, -95, -43, 13, 619, 672, 782, 671, 684, 638, 526, 1281, 875, 269, 160,
+    810, 233, 157, 729, 593, 124, 1055, 280, 129, 843, 251, 173, 824, 640, 207, 1365,
+    532, 354, 808, 503, 473, 1110, 1412, 863, 1552, 282, 165, 843, 263, 198, 864, 599,
+    267, 1173, 317, 216, 918, 290, 229, 983, 667, 286, 1071, 456, 301, 1669, 465, 481,
+    1681, 968, 460, 1489, 333, 342, 1685, 436, 407, 1681, 353, 549, 1455, 399, 162, 1174,
+    317, 201, 854, 526, 13, 1397, 565, 669, 1159, 647, 732, 779, 1052, 875, 731, -522,
+    -746, -125, -635, -737, -239, -230, -805, 254, -581, -912, -49, -708, -905, -229, -192, -923,
+    288, -284, -318, 107, -280, -260, 49, -58, -286, 332, -560, -865, -56, -690, -855, -138,
+    -202, -906, 282, -582, -894, 62, -688, -874, -20, -131, -946, 327, -452, -518, 113, -478,
+    -515, 90, -107, -487, 375, -320, -387, 44, -341, -331, -50, -89, -376, 399, -583, -973,
+    46, -745, -896, -131, -141, -882, 425, 91, 153, 286, 112, 162, 296, 124, 157, 303,
+    -746, -930, -297, -873, -907, -516, -368, -923, 112, -912, -2393, -304, -1224, -2759, -646, -366,
+    -3115, 167, -318, -322, -56, -323, -265, -133, -128, -248, 219, -865, -1241, -275, -1030, -1231,
+    -505, -357, -1344, 154, -894, -2550, -179, -1138, -2461, -454, -285, -3265, 204, -518, -609, -128,
+    -495, -553, -203, -170, -539, 246, -387, -438, -114, -395, -350, -134, -162, -428, 162, -973,
+    -3099, -132, -1423, -3235, -545, -402, -2419, 163, 153, 173, 296, 139, 188, 206, 207, 320,
+    425, -125, -297, 496, -131, -257, 437, 346, -286, 839, -49, -304, 559, -114, -247, 486,
+    331, -248, 846, 107, -56, 758, 62, -17, 877, 486, 473, 922, -56, -275, 573, -70,
+    -220, 527, 369, -205, 940, 62, -179, 666, -8, -164, 671, 495, -173, 999, 113, -128,
+    801, 79, -31, 1063, 421, 119, 1129, 44, -114, 754, 3, -94, 601, 423, -35, 1174,
+    46, -132, 952, -51, -140, 599, 881, -628, 945, 286, 296, 1377, 289, 319, 738, 863,
+    627, 1104, -635, -873, -131, -751, -861, -315, -243, -906, 213, -708, -1224, -114, -922, -1235,
+    -289, -238, -1344, 268, -280, -323, 62, -273, -256, 62, -56, -205, 286, -690, -1030, -70,
+    -854, -1052, -227, -218, -1149, 257, -688, -1138, -8, -892, -1212, -134, -169, -1313, 314, -478,
+    -495, 79, -510, -521, 66, -140, -585, 266, -341, -395, 3, -346, -327, -77, -150, -351,
+    317, -745, -1423, -51, -934, -1391, -166, -164, -2459, 391, 112, 139, 289, 175, 224, 271,
+    267, 228, 374, -737, -907, -257, -861, -918, -508, -345, -946, 141, -905, -2759, -247, -1235,
+    -2534, -525, -342, -3265, 182, -260, -265, -17, -256, -225, -17, -90, -173, 296, -855, -1231,
+    -220, -1052, -1264, -470, -325, -1313, 195, -874, -2461, -164, -1212, -2389, -410, -282, -2246, 271,
+    -515, -553, -31, -521, -475, -109, -162, -423, 277, -331, -350, -94, -327, -301, -212, -185,
+    -322, 201, -896, -3235, -140, -1391, -3480, -368, -343, -2653, 241, 162, 188, 319, 224, 285,
+    337, 286, 244, 426, -239, -516, 437, -315, -508, 449, 290, -487, 863, -229, -646, 486,
+    -289, -525, 459, 298, -539, 915, 49, -133, 877, 62, -17, 707, 470, 119, 954, -138,
+    -505, 527, -227, -470, 551, 325, -585, 943, -20, -454, 671, -134, -410, 681, 491, -423,
+    1087, 90, -203, 1063, 66, -109, 1863, 639, 220, 1314, -50, -134, 601, -77, -212, 714,
+    727, -262, 854, -131, -545, 599, -166, -368, 557, 461, -329, 1777, 296, 206, 738, 271,
+    337, 443, 460, 295, 1179, -230, -368, 346, -243, -345, 290, 99, -376, 619, -192, -366,
+    331, -238, -342, 298, 168, -428, 672, -58, -128, 486, -56, -90, 470, 216, -35, 782,
+    -202, -357, 369, -218, -325, 325, 121, -351, 671, -131, -285, 495, -169, -282, 491, 191,
+    -322, 684, -107, -170, 421, -140, -162, 639, -36, -262, 638, -89, -162, 423, -150, -185,
+    727, 342, -95, 526, -141, -402, 881, -164, -343, 461, 437, -43, 1281, 124, 207, 863,
+    267, 286, 460, 549, 13, 875, -805, -923, -286, -906, -946, -487, -376, -882, 157, -923,
+    -3115, -248, -1344, -3265, -539, -428, -2419, 320, -286, -248, 473, -205, -173, 119, -35, -628,
+    627, -906, -1344, -205, -1149, -1313, -585, -351, -2459, 228, -946, -3265, -173, -1313, -2246, -423,
+    -322, -2653, 244, -487, -539, 119, -585, -423, 220, -262, -329, 295, -376, -428, -35, -351,
+    -322, -262, -95, -43, 13, -882, -2419, -628, -2459, -2653, -329, -43, -1499, 924, 157, 320,
+    627, 228, 244, 295, 13, 924, -490, 254, 112, 839, 213, 141, 863, 619, 157, 1094,
+    288, 167, 846, 268, 182, 915, 672, 320, 1337, 332, 219, 922, 286, 296, 954, 782,
+    627, 1479, 282, 154, 940, 257, 195, 943, 671, 228, 1194, 327, 204, 999, 314, 271,
+    1087, 684, 244, 1362, 375, 246, 1129, 266, 277, 1314, 638, 295, 1675, 399, 162, 1174,
+    317, 201, 854, 526, 13, 1397, 425, 163, 945, 391, 241, 1777, 1281, 924, 1569, 303,
+    425, 1104, 374, 426, 1179, 875, -490, 1116, 233, 204, 302, 238, 254, 319, 269, 254,
+    363, 112, 145, 208, 124, 136, 199, 160, 112, 372, 665, 698, 845, 716, 812, 940,
+    810, 839, 938, 235, 191, 307, 229, 258, 306, 233, 213, 404, 211, 88, 247, 147,
+    158, 245, 157, 141, 424, 592, 651, 899, 682, 796, 991, 729, 863, 1311, 487, 509,
+    529, 516, 589, 648, 593, 619, 565, 91, 153, 286, 112, 162, 296, 124, 157, 303,
+    1041, 1047, 1866, 1079, 1043, 1294, 1055, 1094, 822, 204, 213, 321, 230, 276, 329, 280,
+    288, 372, 145, 116, 171, 181, 165, 198, 129, 167, 296, 698, 746, 892, 736, 846,
+    1009, 843, 846, 831, 191, 187, 268, 225, 260, 315, 251, 268, 410, 88, 107, 193,
+    128, 180, 258, 173, 182, 358, 651, 704, 819, 746, 874, 1015, 824, 915, 841, 509,
+    531, 584, 543, 639, 678, 640, 672, 669, 153, 173, 296, 139, 188, 206, 207, 320,
+    425, 1047, 1125, 1392, 1128, 1245, 1433, 1365, 1337, 1752, 302, 321, 472, 298, 320, 494,
+    532, 332, 938, 208, 171, 487, 197, 225, 510, 354, 219, 831, 845, 892, 1073, 865,
+    1019, 1653, 808, 922, 901, 307, 268, 667, 290, 320, 533, 503, 286, 1004, 247, 193,
+    727, 231, 261, 594, 473, 296, 920, 899, 819, 1234, 889, 1003, 1173, 1110, 954, 1387,
+    529, 584, 1585, 630, 739, 1150, 1412, 782, 1159, 286, 296, 1377, 289, 319, 738, 863,
+    627, 1104, 1866, 1392, 1559, 1253, 1373, 1589, 1552, 1479, 154, 238, 230, 298, 236, 266,
+    310, 282, 282, 404, 124, 181, 197, 143, 165, 213, 165, 154, 410, 716, 736, 865,
+    769, 859, 920, 843, 940, 1004, 229, 225, 290, 225, 275, 297, 263, 257, 370, 147,
+    128, 231, 150, 194, 263, 198, 195, 422, 682, 746, 889, 736, 884, 1011, 864, 943,
+    838, 516, 543, 630, 587, 646, 735, 599, 671, 647, 112, 139, 289, 175, 224, 271,
+    267, 228, 374, 1079, 1128, 1253, 1169, 1226, 1300, 1173, 1194, 1132, 254, 276, 320, 266,
+    332, 347, 317, 327, 424, 136, 165, 225, 165, 234, 232, 216, 204, 358, 812, 846,
+    1019, 859, 972, 1114, 918, 999, 920, 258, 260, 320, 275, 333, 346, 290, 314, 422,
+    158, 180, 261, 194, 290, 304, 229, 271, 423, 796, 874, 1003, 884, 1049, 1204, 983,
+    1087, 988, 589, 639, 739, 646, 745, 765, 667, 684, 732, 162, 188, 319, 224, 285,
+    337, 286, 244, 426, 1043, 1245, 1373, 1226, 1422, 1288, 1071, 1362, 1503, 319, 329, 494,
+    310, 347, 478, 456, 375, 1311, 199, 198, 510, 213, 232, 535, 301, 246, 841, 940,
+    1009, 1653, 920, 1114, 1781, 1669, 1129, 1387, 306, 315, 533, 297, 346, 492, 465, 266,
+    838, 245, 258, 594, 263, 304, 641, 481, 277, 988, 991, 1015, 1173, 1011, 1204, 1134,
+    1681, 1314, 766, 648, 678, 1150, 735, 765, 1434, 968, 638, 779, 296, 206, 738, 271,
+    337, 443, 460, 295, 1179, 1294, 1433, 1589, 1300, 1288, 1653, 1489, 1675, 1066, 269, 280,
+    532, 282, 317, 456, 333, 399, 565, 160, 129, 354, 165, 216, 301, 342, 162, 669,
+    810, 843, 808, 843, 918, 1669, 1685, 1174, 1159, 233, 251, 503, 263, 290, 465, 436,
+    317, 647, 157, 173, 473, 198, 229, 481, 407, 201, 732, 729, 824, 1110, 864, 983,
+    1681, 1681, 854, 779, 593, 640, 1412, 599, 667, 968, 353, 526, 1052, 124, 207, 863,
+    267, 286, 460, 549, 13, 875, 1055, 1365, 1552, 1173, 1071, 1489, 1455, 1397, 731, 254,
+    288, 332, 282, 327, 375, 399, 425, 303, 112, 167, 219, 154, 204, 246, 162, 163,
+    425, 839, 846, 922, 940, 999, 1129, 1174, 945, 1104, 213, 268, 286, 257, 314, 266,
+    317, 391, 374, 141, 182, 296, 195, 271, 277, 201, 241, 426, 863, 915, 954, 943,
+    1087, 1314, 854, 1777, 1179, 619, 672, 782, 671, 684, 638, 526, 1281, 875, 157, 320,
+    627, 228, 244, 295, 13, 924, -490, 1094, 1337, 1479, 1194, 1362, 1675, 1397, 1569, 1116,
+    363, 372, 938, 404, 424, 1311, 565, 303, 822, 372, 296, 831, 410, 358, 841, 669,
+    425, 1752, 938, 831, 901, 1004, 920, 1387, 1159, 1104, 154, 404, 410, 1004, 370, 422,
+    838, 647, 374, 1132, 424, 358, 920, 422, 423, 988, 732, 426, 1503, 1311, 841, 1387,
+    838, 988, 766, 779, 1179, 1066, 565, 669, 1159, 647, 732, 779, 1052, 875, 731, 303,
+    425, 1104, 374, 426, 1179, 875, -490, 1116, 822, 1752, 154, 1132, 1503, 1066, 731, 1116,
+    -490
+};
+
+// log-odds of a hit at each cell, relative to the overall hit rate, times POLICY_SCALE
+const short _policyCells[CELLS] = {
+    -163, -73, -22, 4, 7, 7, 4, -22, -73, -163,
+    -73, -21, 16, 9, 34, 34, 9, 16, -21, -73,
+    -22, 16, 43, 2, 46, 46, 2, 43, 16, -22,
+    4, 9, 2, 105, -3, -3, 105, 2, 9, 4,
+    7, 34, 46, -3, 52, 52, -3, 46, 34, 7,
+    7, 34, 46, -3, 52, 52, -3, 46, 34, 7,
+    4, 9, 2, 105, -3, -3, 105, 2, 9, 4,
+    -22, 16, 43, 2, 46, 46, 2, 43, 16, -22,
+    -73, -21, 16, 9, 34, 34, 9, 16, -21, -73,
+    -163, -73, -22, 4, 7, 7, 4, -22, -73, -163
+};
@@ -0,0 +1,960 @@
+/*
+
+File Name: query.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the query engine, which answers questions about the games of a record file without rebuilding
+    the state of any game.
+
+    The games are first turned into an index: a side-file, next to the record file, which stores every column
+    of a CorpusIndex as one contiguous array. The index is rebuilt whenever the record file is newer than it.
+    A query then scans the columns QUERY_BLOCK games at a time, on several threads. Every condition narrows a
+    selection vector with a single loop over one column, and the aggregate is computed from a histogram of the
+    selected values, so no loop over a block has to branch on the data.
+
+    A query is written as:
+        AGGREGATE [COLUMN | PLAYER] [where CONDITION [and CONDITION]...]
+    where
+        - AGGREGATE is one of count, min, max, mean, median, hitmap or shotmap.
+        - COLUMN is one of turns, shots or sunkP:S, S being the icon of the ship sunk by player P.
+        - PLAYER is 1 or 2, and is given to hitmap and shotmap.
+        - CONDITION is a column compared with a value using =, !=, < or >, for example difficulty=hard,
+          mode=salvo, cpu=2, winner=1, turns<40 or sunk1:C>30. openingP=PATTERN matches the games in which
+          player P's first shots went as given by PATTERN, a string of H (hit), M (miss) and ? (either).
+
+    The index file starts with a 32 byte header: "BSCX", version, 3 unused bytes, number of games, number of
+    shots and size of the indexed record file, each taking 8 bytes with the least significant byte first. It is
+    followed by the game columns in the order of Column, and then the shot columns in the order of ShotColumn.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. query.h
+    2. thread.h
+
+    STRUCTS (local)
+    ---------------
+    1. QueryResult
+    2. QueryTask
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool buildIndex(char *recordPath, char *indexPath)
+    2. bool loadIndex(char *indexPath, struct CorpusIndex *index)
+    3. void freeIndex(struct CorpusIndex *index)
+    4. bool parseQuery(char *text, struct Query *query)
+    5. bool runQuery(char *recordPath, char *text, int threads)
+
+    FUNCTIONS (local)
+    -----------------
+    1. bool indexGame(struct CorpusIndex *index, struct GameRecord *record, long long *gameCapacity, long long *shotCapacity)
+    2. bool growColumns(unsigned char **columns, int count, long long size)
+    3. bool parseColumn(char *name, Column *column)
+    4. bool parseCondition(char *text, struct Condition *condition)
+    5. bool indexIsStale(char *recordPath, char *indexPath)
+    6. void *queryRange(void *task)
+    7. void scanBlock(struct CorpusIndex *index, struct Query *query, long long start, int size, struct QueryResult *result)
+    8. void printResult(struct Query *query, struct QueryResult *result)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <query.h>
+#include <thread.h>
+#include <ctype.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/*
+    QueryResult struct, contains what a query computed over some of the games. Contains:
+    - unsigned long long games: number of games that matched.
+    - unsigned long long histogram[256]: number of matched games by the value of the aggregated column.
+    - unsigned long long cells[BOARD_SIZE * BOARD_SIZE]: number of shots counted by HIT_MAP or SHOT_MAP in
+      each cell.
+*/
+struct QueryResult {
+    unsigned long long games;
+    unsigned long long histogram[256];
+    unsigned long long cells[BOARD_SIZE * BOARD_SIZE];
+};
+
+/*
+    QueryTask struct, contains the games scanned by one thread. Contains:
+    - struct CorpusIndex *index: the index scanned.
+    - struct Query *query: the query being run.
+    - long long start: first game scanned.
+    - long long end: game after the last one scanned.
+    - struct QueryResult result: what the thread computed.
+*/
+struct QueryTask {
+    struct CorpusIndex *index;
+    struct Query *query;
+    long long start;
+    long long end;
+    struct QueryResult result;
+};
+
+bool indexGame(struct CorpusIndex *index, struct GameRecord *record, long long *gameCapacity, long long *shotCapacity);
+bool growColumns(unsigned char **columns, int count, long long size);
+bool parseColumn(char *name, Column *column);
+bool parseCondition(char *text, struct Condition *condition);
+bool indexIsStale(char *recordPath, char *indexPath);
+void *queryRange(void *task);
+void scanBlock(struct CorpusIndex *index, struct Query *query, long long start, int size, struct QueryResult *result);
+void printResult(struct Query *query, struct QueryResult *result);
+
+/*
+    Builds the index of the given record file.
+
+    Parameters
+    ----------
+    `char *recordPath`:
+        Path of the record file.
+
+    `char *indexPath`:
+        Path of the index file to write.
+
+    Returns
+    -------
+    Returns `true` if the index was written, else it returns `false`.
+*/
+bool buildIndex(char *recordPath, char *indexPath)
+{
+    FILE *file = fopen(recordPath, "rb");
+
+    if (file == NULL)
+    {
+        printf("Could not open %s.\n", recordPath);
+        return false;
+    }
+
+    struct CorpusIndex index = { 0 };
+    struct stat recordStatus;
+    struct GameRecord *record = (struct GameRecord *) malloc(sizeof(struct GameRecord));
+    long long gameCapacity = 0, shotCapacity = 0;
+    bool indexed = record != NULL;
+
+    while (indexed && readRecord(file, record))
+        indexed = indexGame(&index, record, &gameCapacity, &shotCapacity);
+
+    if (indexed && !feof(file))
+        printf("Could not read past game %lld of %s, the rest of the file will not be indexed.\n", index.games, recordPath);
+
+    fclose(file);
+    free(record);
+
+    if (!indexed)
+    {
+        printf("Could not allocate memory for the index.\n");
+        freeIndex(&index);
+        return false;
+    }
+
+    unsigned char header[32] = { 'B', 'S', 'C', 'X', INDEX_VERSION };
+    long long recordSize = stat(recordPath, &recordStatus) == 0 ? (long long) recordStatus.st_size : -1;
+
+    for (int i = 0; i < 8; i++)
+    {
+        header[8 + i] = (index.games >> (8 * i)) & 0xFF;
+        header[16 + i] = (index.shots >> (8 * i)) & 0xFF;
+        header[24 + i] = (recordSize >> (8 * i)) & 0xFF;
+    }
+
+    file = fopen(indexPath, "wb");
+    bool written = file != NULL && fwrite(header, 1, sizeof header, file) == sizeof header;
+
+    for (int i = 0; written && i < GAME_COLUMNS; i++)
+        written = fwrite(index.columns[i], 1, index.games, file) == (size_t) index.games;
+
+    for (int i = 0; written && i < SHOT_COLUMNS; i++)
+        written = fwrite(index.shotColumns[i], 1, index.shots, file) == (size_t) index.shots;
+
+    if (file != NULL && fclose(file) != 0)
+        written = false;
+
+    if (!written)
+    {
+        printf("Could not write the index to %s.\n", indexPath);
+        remove(indexPath);
+    }
+
+    freeIndex(&index);
+
+    return written;
+}
+
+/*
+    Loads an index written by buildIndex.
+
+    Parameters
+    ----------
+    `char *indexPath`:
+        Path of the index file.
+
+    `struct CorpusIndex *index`:
+        Stores the index. Must be freed using freeIndex, even if loading fails.
+
+    Returns
+    -------
+    Returns `true` if the index was loaded, else it returns `false`.
+*/
+bool loadIndex(char *indexPath, struct CorpusIndex *index)
+{
+    memset(index, 0, sizeof *index);
+
+    FILE *file = fopen(indexPath, "rb");
+    unsigned char header[32];
+
+    if (file == NULL)
+        return false;
+
+    if (fread(header, 1, sizeof header, file) != sizeof header || memcmp(header, "BSCX", 4) != 0
+        || header[4] != INDEX_VERSION)
+    {
+        fclose(file);
+        return false;
+    }
+
+    for (int i = 7; i >= 0; i--)
+    {
+        index->games = (index->games << 8) | header[8 + i];
+        index->shots = (index->shots << 8) | header[16 + i];
+    }
+
+    bool loaded = index->games >= 0 && index->shots >= 0;
+
+    for (int i = 0; loaded && i < GAME_COLUMNS; i++)
+    {
+        index->columns[i] = (unsigned char *) malloc(index->games + 1);
+        loaded = index->columns[i] != NULL && fread(index->columns[i], 1, index->games, file) == (size_t) index->games;
+    }
+
+    for (int i = 0; loaded && i < SHOT_COLUMNS; i++)
+    {
+        index->shotColumns[i] = (unsigned char *) malloc(index->shots + 1);
+        loaded = index->shotColumns[i] != NULL && fread(index->shotColumns[i], 1, index->shots, file) == (size_t) index->shots;
+    }
+
+    fclose(file);
+
+    if (loaded)
+        index->shotStarts = (long long *) malloc((index->games + 1) * sizeof(long long));
+
+    if (!loaded || index->shotStarts == NULL)
+        return false;
+
+    index->shotStarts[0] = 0;
+
+    for (long long i = 0; i < index->games; i++)
+        index->shotStarts[i + 1] = index->shotStarts[i] + index->columns[COLUMN_SHOTS][i];
+
+    return index->shotStarts[index->games] == index->shots;
+}
+
+/*
+    Frees the memory held by the given index.
+
+    Parameter
+    ---------
+    `struct CorpusIndex *index`:
+        The index to free.
+*/
+void freeIndex(struct CorpusIndex *index)
+{
+    for (int i = 0; i < GAME_COLUMNS; i++)
+        free(index->columns[i]);
+
+    for (int i = 0; i < SHOT_COLUMNS; i++)
+        free(index->shotColumns[i]);
+
+    free(index->shotStarts);
+    memset(index, 0, sizeof *index);
+}
+
+/*
+    Parses a query, written as described at the top of this file.
+
+    Parameters
+    ----------
+    `char *text`:
+        The query.
+
+    `struct Query *query`:
+        Stores the parsed query.
+
+    Returns
+    -------
+    Returns `true` if the query is valid, else it prints what is wrong with it and returns `false`.
+*/
+bool parseQuery(char *text, struct Query *query)
+{
+    static const char *aggregates[] = { "count", "min", "max", "mean", "median", "hitmap", "shotmap" };
+    char buffer[512];
+    char *token;
+
+    memset(query, 0, sizeof *query);
+    snprintf(buffer, sizeof buffer, "%s", text);
+    token = strtok(buffer, " \t");
+
+    if (token == NULL)
+    {
+        printf("The query is empty.\n");
+        return false;
+    }
+
+    for (query->aggregate = COUNT; query->aggregate <= SHOT_MAP; query->aggregate++)
+    {
+        if (strcmp(token, aggregates[query->aggregate]) == 0)
+            break;
+    }
+
+    if (query->aggregate > SHOT_MAP)
+    {
+        printf("Unknown aggregate '%s', expected count, min, max, mean, median, hitmap or shotmap.\n", token);
+        return false;
+    }
+
+    token = strtok(NULL, " \t");
+
+    if (query->aggregate == HIT_MAP || query->aggregate == SHOT_MAP)
+    {
+        if (token == NULL || (strcmp(token, "1") != 0 && strcmp(token, "2") != 0))
+        {
+            printf("%s needs a player, 1 or 2.\n", aggregates[query->aggregate]);
+            return false;
+        }
+
+        query->player = *token - '1';
+        token = strtok(NULL, " \t");
+    }
+    else if (query->aggregate != COUNT)
+    {
+        if (token == NULL || !parseColumn(token, &query->column) || query->column == COLUMN_OPENING
+            || query->column == COLUMN_OPENING + 1)
+        {
+            printf("%s needs a column: turns, shots or sunkP:S.\n", aggregates[query->aggregate]);
+            return false;
+        }
+
+        token = strtok(NULL, " \t");
+    }
+
+    if (token == NULL)
+        return true;
+
+    if (strcmp(token, "where") != 0)
+    {
+        printf("Expected 'where' instead of '%s'.\n", token);
+        return false;
+    }
+
+    while ((token = strtok(NULL, " \t")) != NULL)
+    {
+        if (query->conditionCount == MAX_CONDITIONS)
+        {
+            printf("A query can have at most %d conditions.\n", MAX_CONDITIONS);
+            return false;
+        }
+
+        if (!parseCondition(token, &query->conditions[query->conditionCount++]))
+            return false;
+
+        token = strtok(NULL, " \t");
+
+        if (token == NULL)
+            break;
+
+        if (strcmp(token, "and") != 0)
+        {
+            printf("Expected 'and' instead of '%s'.\n", token);
+            return false;
+        }
+    }
+
+    if (query->conditionCount == 0 || token != NULL)
+    {
+        printf("Expected a condition after '%s'.\n", query->conditionCount == 0 ? "where" : "and");
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Runs a query over the games of the given record file, building the index of the file first if it is
+    missing or out of date, and prints the result.
+
+    Parameters
+    ----------
+    `char *recordPath`:
+        Path of the record file.
+
+    `char *text`:
+        The query.
+
+    `int threads`:
+        Number of threads to scan the index with.
+
+    Returns
+    -------
+    Returns `true` if the query was run, else it returns `false`.
+*/
+bool runQuery(char *recordPath, char *text, int threads)
+{
+    struct Query query;
+    struct CorpusIndex index;
+    char indexPath[1024];
+
+    if (!parseQuery(text, &query))
+        return false;
+
+    snprintf(indexPath, sizeof indexPath, "%s.idx", recordPath);
+
+    if (indexIsStale(recordPath, indexPath))
+    {
+        printf("Indexing %s...\n", recordPath);
+
+        if (!buildIndex(recordPath, indexPath))
+            return false;
+    }
+
+    if (!loadIndex(indexPath, &index))
+    {
+        printf("Could not load the index %s, delete it to have it rebuilt.\n", indexPath);
+        freeIndex(&index);
+        return false;
+    }
+
+    threads = threads < 1 ? 1 : threads;
+    threads = index.games / QUERY_BLOCK + 1 < threads ? (int) (index.games / QUERY_BLOCK + 1) : threads;
+
+    struct QueryTask *tasks = (struct QueryTask *) calloc(threads, sizeof(struct QueryTask));
+
+    if (tasks == NULL)
+    {
+        printf("Could not allocate memory for the query.\n");
+        freeIndex(&index);
+        return false;
+    }
+
+    // every thread scans a range of whole blocks
+    long long blocks = (index.games + QUERY_BLOCK - 1) / QUERY_BLOCK;
+
+    for (int i = 0; i < threads; i++)
+    {
+        tasks[i].index = &index;
+        tasks[i].query = &query;
+        tasks[i].start = blocks * i / threads * QUERY_BLOCK;
+        tasks[i].end = blocks * (i + 1) / threads * QUERY_BLOCK;
+        tasks[i].end = tasks[i].end > index.games ? index.games : tasks[i].end;
+    }
+
+    runShares(queryRange, tasks, sizeof(struct QueryTask), threads);
+
+    for (int i = 1; i < threads; i++)
+    {
+        tasks[0].result.games += tasks[i].result.games;
+
+        for (int j = 0; j < 256; j++)
+            tasks[0].result.histogram[j] += tasks[i].result.histogram[j];
+
+        for (int j = 0; j < BOARD_SIZE * BOARD_SIZE; j++)
+            tasks[0].result.cells[j] += tasks[i].result.cells[j];
+    }
+
+    printResult(&query, &tasks[0].result);
+
+    free(tasks);
+    freeIndex(&index);
+
+    return true;
+}
+
+/*
+    Appends the columns of a recorded game to the given index, growing its columns when they are full.
+
+    Parameters
+    ----------
+    `struct CorpusIndex *index`:
+        The index being built.
+
+    `struct GameRecord *record`:
+        The game to append.
+
+    `long long *gameCapacity`:
+        Number of games the game columns can hold.
+
+    `long long *shotCapacity`:
+        Number of shots the shot columns can hold.
+
+    Returns
+    -------
+    Returns `true` if the game was appended, `false` if memory could not be allocated.
+*/
+bool indexGame(struct CorpusIndex *index, struct GameRecord *record, long long *gameCapacity, long long *shotCapacity)
+{
+    if (index->games == *gameCapacity)
+    {
+        *gameCapacity = *gameCapacity == 0 ? 1024 : *gameCapacity * 2;
+
+        if (!growColumns(index->columns, GAME_COLUMNS, *gameCapacity))
+            return false;
+    }
+
+    if (index->shots + record->shotCount > *shotCapacity)
+    {
+        *shotCapacity = *shotCapacity == 0 ? 65536 : *shotCapacity * 2;
+
+        if (!growColumns(index->shotColumns, SHOT_COLUMNS, *shotCapacity))
+            return false;
+    }
+
+    long long game = index->games++;
+    int fired[2] = { 0, 0 };
+
+    index->columns[COLUMN_DIFFICULTY][game] = record->cpuPlayer ? record->difficulty : 0;
+    index->columns[COLUMN_MODE][game] = record->mode;
+    index->columns[COLUMN_CPU][game] = record->cpuPlayer ? record->cpuTurn + 1 : 0;
+    index->columns[COLUMN_WINNER][game] = record->winner + 1;
+    index->columns[COLUMN_TURNS][game] = record->turnCount;
+    index->columns[COLUMN_SHOTS][game] = record->shotCount;
+    index->columns[COLUMN_OPENING][game] = index->columns[COLUMN_OPENING + 1][game] = 0;
+
+    for (int i = COLUMN_SUNK; i < GAME_COLUMNS; i++)
+        index->columns[i][game] = 0;
+
+    for (int turn = 0; turn < record->turnCount; turn++)
+    {
+        for (int i = record->turnStarts[turn]; i < record->turnStarts[turn + 1]; i++)
+        {
+            struct RecordedShot *shot = &record->shots[i];
+            Ships sunk = getShipFromIcon(shot->outcome);
+            long long column = index->shots++;
+
+            if (fired[shot->player] < OPENING_SHOTS && shot->outcome != 'M')
+                index->columns[COLUMN_OPENING + shot->player][game] |= 1 << fired[shot->player];
+
+            fired[shot->player]++;
+
+            if (sunk != -1)
+                index->columns[COLUMN_SUNK + shot->player * SHIPS + sunk][game] = turn + 1;
+
+            index->shotColumns[SHOT_CELL][column] = shot->cell;
+            index->shotColumns[SHOT_OUTCOME][column] = shot->outcome == 'M' ? 0 : (sunk == -1 ? 1 : 2 + sunk);
+            index->shotColumns[SHOT_PLAYER][column] = shot->player;
+        }
+    }
+
+    return true;
+}
+
+/*
+    Grows the given columns to the given size.
+
+    Parameters
+    ----------
+    `unsigned char **columns`:
+        The columns to grow.
+
+    `int count`:
+        Number of columns.
+
+    `long long size`:
+        Number of values each column should be able to hold.
+
+    Returns
+    -------
+    Returns `true` if every column was grown, else it returns `false`.
+*/
+bool growColumns(unsigned char **columns, int count, long long size)
+{
+    for (int i = 0; i < count; i++)
+    {
+        unsigned char *grown = (unsigned char *) realloc(columns[i], size);
+
+        if (grown == NULL)
+            return false;
+
+        columns[i] = grown;
+    }
+
+    return true;
+}
+
+/*
+    Finds the column with the given name.
+
+    Parameters
+    ----------
+    `char *name`:
+        Name of the column.
+
+    `Column *column`:
+        Stores the column found.
+
+    Returns
+    -------
+    Returns `true` if a column has the given name, else it returns `false`.
+*/
+bool parseColumn(char *name, Column *column)
+{
+    static const char *names[] = { "difficulty", "mode", "cpu", "winner", "turns", "shots", "opening1", "opening2" };
+
+    for (int i = 0; i < COLUMN_SUNK; i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            *column = i;
+            return true;
+        }
+    }
+
+    if (strncmp(name, "sunk", 4) == 0 && (name[4] == '1' || name[4] == '2') && name[5] == ':' && name[7] == '\0')
+    {
+        Ships ship = getShipFromIcon(toupper(name[6]));
+
+        if (ship == -1)
+            return false;
+
+        *column = COLUMN_SUNK + (name[4] - '1') * SHIPS + ship;
+        return true;
+    }
+
+    return false;
+}
+
+/*
+    Parses a single condition of a query.
+
+    Parameters
+    ----------
+    `char *text`:
+        The condition, for example turns<40.
+
+    `struct Condition *condition`:
+        Stores the parsed condition.
+
+    Returns
+    -------
+    Returns `true` if the condition is valid, else it prints what is wrong with it and returns `false`.
+*/
+bool parseCondition(char *text, struct Condition *condition)
+{
+    static const char *words[] = { "none", "easy", "hard", "expert", "policy", "classic", "salvo" };
+    static const int wordValues[] = { 0, EASY, HARD, EXPERT, POLICY, CLASSIC, SALVO };
+    char *operator = strpbrk(text, "=!<>");
+
+    if (operator == NULL || operator == text || (*operator == '!' && operator[1] != '='))
+    {
+        printf("Condition '%s' should be a column compared with a value using =, !=, < or >.\n", text);
+        return false;
+    }
+
+    char *value = operator + (*operator == '!' ? 2 : 1);
+
+    condition->operator = *operator;
+    *operator = '\0';
+
+    if (!parseColumn(text, &condition->column))
+    {
+        printf("Unknown column '%s'.\n", text);
+        return false;
+    }
+
+    condition->mask = 0xFF;
+
+    // an opening is compared with the bits given by the pattern, ignoring ? and the shots after the pattern
+    if (condition->column == COLUMN_OPENING || condition->column == COLUMN_OPENING + 1)
+    {
+        int length = strlen(value);
+
+        if (condition->operator != '=' || length == 0 || length > OPENING_SHOTS || strspn(value, "HMhm?") != (size_t) length)
+        {
+            printf("An opening should be matched with =, using at most %d of H, M and ?.\n", OPENING_SHOTS);
+            return false;
+        }
+
+        condition->mask = condition->value = 0;
+
+        for (int i = 0; i < length; i++)
+        {
+            condition->mask |= value[i] == '?' ? 0 : 1 << i;
+            condition->value |= toupper(value[i]) == 'H' ? 1 << i : 0;
+        }
+
+        return true;
+    }
+
+    for (int i = 0; i < 7; i++)
+    {
+        if (strcmp(value, words[i]) == 0)
+        {
+            condition->value = wordValues[i];
+            return true;
+        }
+    }
+
+    char *end;
+    long number = strtol(value, &end, 10);
+
+    if (*value == '\0' || *end != '\0' || number < 0 || number > 255)
+    {
+        printf("Value '%s' should be a number from 0 - 255 or one of none, easy, hard, expert, policy, classic and salvo.\n", value);
+        return false;
+    }
+
+    condition->value = number;
+    return true;
+}
+
+/*
+    Checks whether the index of a record file has to be built again.
+
+    Parameters
+    ----------
+    `char *recordPath`:
+        Path of the record file.
+
+    `char *indexPath`:
+        Path of its index.
+
+    Returns
+    -------
+    Returns `true` if the index is missing, was written by another version, or was built from a record file of
+    another size or older than the current one, else it returns `false`.
+*/
+bool indexIsStale(char *recordPath, char *indexPath)
+{
+    struct stat recordStatus, indexStatus;
+    unsigned char header[32];
+    long long recordSize = 0;
+    FILE *file;
+
+    if (stat(indexPath, &indexStatus) != 0 || stat(recordPath, &recordStatus) != 0
+        || recordStatus.st_mtime > indexStatus.st_mtime || (file = fopen(indexPath, "rb")) == NULL)
+    {
+        return true;
+    }
+
+    bool read = fread(header, 1, sizeof header, file) == sizeof header;
+    fclose(file);
+
+    if (!read || memcmp(header, "BSCX", 4) != 0 || header[4] != INDEX_VERSION)
+        return true;
+
+    for (int i = 7; i >= 0; i--)
+        recordSize = (recordSize << 8) | header[24 + i];
+
+    return recordSize != (long long) recordStatus.st_size;
+}
+
+/*
+    Scans the range of games of the given task, QUERY_BLOCK games at a time. Run on its own thread.
+
+    Parameter
+    ---------
+    `void *task`:
+        The QueryTask to run.
+
+    Returns
+    -------
+    Returns NULL.
+*/
+void *queryRange(void *task)
+{
+    struct QueryTask *range = (struct QueryTask *) task;
+
+    for (long long start = range->start; start < range->end; start += QUERY_BLOCK)
+    {
+        int size = range->end - start < QUERY_BLOCK ? (int) (range->end - start) : QUERY_BLOCK;
+        scanBlock(range->index, range->query, start, size, &range->result);
+    }
+
+    return NULL;
+}
+
+/*
+    Runs a query over a block of games.
+
+    Parameters
+    ----------
+    `struct CorpusIndex *index`:
+        The index scanned.
+
+    `struct Query *query`:
+        The query being run.
+
+    `long long start`:
+        First game of the block.
+
+    `int size`:
+        Number of games in the block, at most QUERY_BLOCK.
+
+    `struct QueryResult *result`:
+        Adds what was computed over the block to this result.
+*/
+void scanBlock(struct CorpusIndex *index, struct Query *query, long long start, int size, struct QueryResult *result)
+{
+    unsigned char selected[QUERY_BLOCK];
+
+    memset(selected, 1, size);
+
+    for (int i = 0; i < query->conditionCount; i++)
+    {
+        struct Condition *condition = &query->conditions[i];
+        unsigned char *column = index->columns[condition->column] + start;
+        unsigned char mask = condition->mask, value = condition->value;
+
+        switch (condition->operator)
+        {
+            case '=':
+                for (int j = 0; j < size; j++)
+                    selected[j] &= (column[j] & mask) == value;
+                break;
+
+            case '!':
+                for (int j = 0; j < size; j++)
+                    selected[j] &= (column[j] & mask) != value;
+                break;
+
+            case '<':
+                for (int j = 0; j < size; j++)
+                    selected[j] &= column[j] < value;
+                break;
+
+            case '>':
+                for (int j = 0; j < size; j++)
+                    selected[j] &= column[j] > value;
+                break;
+        }
+    }
+
+    if (query->aggregate == HIT_MAP || query->aggregate == SHOT_MAP)
+    {
+        unsigned char *cells = index->shotColumns[SHOT_CELL], *outcomes = index->shotColumns[SHOT_OUTCOME];
+        unsigned char *players = index->shotColumns[SHOT_PLAYER];
+        unsigned char minimumOutcome = query->aggregate == HIT_MAP ? 1 : 0;
+
+        for (int i = 0; i < size; i++)
+        {
+            if (!selected[i])
+                continue;
+
+            result->games++;
+
+            for (long long j = index->shotStarts[start + i]; j < index->shotStarts[start + i + 1]; j++)
+                result->cells[cells[j]] += players[j] == query->player && outcomes[j] >= minimumOutcome;
+        }
+
+        return;
+    }
+
+    // even count builds a histogram, of the turns column, so that every aggregate runs the same loop
+    unsigned char *column = index->columns[query->aggregate == COUNT ? COLUMN_TURNS : query->column] + start;
+
+    for (int i = 0; i < size; i++)
+        result->histogram[column[i]] += selected[i];
+}
+
+/*
+    Prints the result of a query.
+
+    Parameters
+    ----------
+    `struct Query *query`:
+        The query that was run.
+
+    `struct QueryResult *result`:
+        What the query computed over all the games.
+*/
+void printResult(struct Query *query, struct QueryResult *result)
+{
+    if (query->aggregate == HIT_MAP || query->aggregate == SHOT_MAP)
+    {
+        printf(
+            "%% of %llu game(s) in which player %d %s each cell:\n\n     A    B    C    D    E    F    G    H    I    J\n",
+            result->games, query->player + 1, query->aggregate == HIT_MAP ? "hit" : "fired at"
+        );
+
+        for (int row = 0; row < BOARD_SIZE; row++)
+        {
+            printf("%2d ", row + 1);
+
+            for (int col = 0; col < BOARD_SIZE; col++)
+            {
+                unsigned long long shots = result->cells[row * BOARD_SIZE + col];
+                printf("%4.0f ", result->games == 0 ? 0.0 : 100.0 * shots / result->games);
+            }
+
+            printf("\n");
+        }
+
+        return;
+    }
+
+    // a ship that was not sunk has 0 in its sunk column and is not counted
+    if (query->aggregate != COUNT && query->column >= COLUMN_SUNK)
+        result->histogram[0] = 0;
+
+    unsigned long long games = 0, sum = 0;
+    int minimum = -1, maximum = -1;
+
+    for (int i = 0; i < 256; i++)
+    {
+        games += result->histogram[i];
+        sum += result->histogram[i] * i;
+
+        if (result->histogram[i] != 0)
+        {
+            minimum = minimum == -1 ? i : minimum;
+            maximum = i;
+        }
+    }
+
+    if (query->aggregate == COUNT)
+    {
+        printf("%llu game(s) matched.\n", games);
+        return;
+    }
+
+    if (games == 0)
+    {
+        printf("No games matched.\n");
+        return;
+    }
+
+    switch (query->aggregate)
+    {
+        case MINIMUM:
+            printf("min: %d", minimum);
+            break;
+
+        case MAXIMUM:
+            printf("max: %d", maximum);
+            break;
+
+        case MEAN:
+            printf("mean: %.2f", (double) sum / games);
+            break;
+
+        default:
+        {
+            unsigned long long seen = 0;
+            int median = 0;
+
+            while ((seen += result->histogram[median]) < (games + 1) / 2)
+                median++;
+
+            printf("median: %d", median);
+            break;
+        }
+    }
+
+    printf(" over %llu game(s).\n", games);
+}
@@ -0,0 +1,505 @@
+/*
+
+File Name: record.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to record games as they are played, and to save and load the recorded games.
+
+    A record file is a sequence of games, each written as:
+        - a 16 byte header: "BSRC", version, mode, flags (bit 0: CPU player), CPU turn, difficulty, winner,
+          turn count (2 bytes), shot count (2 bytes), keyframe interval and keyframe count.
+        - the names of both players, MAX_SIZE bytes each.
+        - the boards of both players, BOARD_SIZE * BOARD_SIZE bytes each.
+        - every shot as 3 bytes: flags (bit 0: player, bit 1: first shot of a turn), cell and outcome.
+        - every keyframe as both action boards followed by the hit points of both fleets, one byte each.
+    Numbers taking 2 bytes are stored with the least significant byte first.
+
+    INCLUDES (user-defined)
+    -----------------------
+    record.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. void beginRecord(struct GameRecord *record, struct Game *game)
+    2. void recordSalvo(struct GameRecord *record, int player, struct SalvoResult *result)
+    3. void finishRecord(struct GameRecord *record, int winner)
+    4. bool writeRecord(FILE *file, struct GameRecord *record)
+    5. bool readRecord(FILE *file, struct GameRecord *record)
+    6. bool appendRecord(char *path, struct GameRecord *record)
+    7. void seekRecord(struct GameRecord *record, int turn, struct Player state[2])
+    8. void beginPlayersRecord(struct GameRecord *record, GameMode mode, struct Player players[2], bool keyframed)
+    9. size_t encodeRecord(struct GameRecord *record, unsigned char *buffer)
+    10. bool skimRecord(FILE *file, struct GameRecord *record)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void storeKeyframe(struct GameRecord *record)
+    2. void writeShort(unsigned char *buffer, int value)
+    3. int readShort(unsigned char *buffer)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <record.h>
+#include <string.h>
+
+void storeKeyframe(struct GameRecord *record);
+void writeShort(unsigned char *buffer, int value);
+int readShort(unsigned char *buffer);
+
+/*
+    Starts recording the given game. Must be called once both players have placed their ships.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record to start.
+
+    `struct Game *game`:
+        The game to record.
+*/
+void beginRecord(struct GameRecord *record, struct Game *game)
+{
+    beginPlayersRecord(record, game->mode, game->players, true);
+    record->cpuPlayer = game->cpuPlayer;
+    record->cpuTurn = game->cpu.turn;
+    record->difficulty = game->cpu.difficulty;
+}
+
+/*
+    Records a turn, i.e., every shot fired by a player during their turn.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record to write into.
+
+    `int player`:
+        The player who played the turn (0 or 1).
+
+    `struct SalvoResult *result`:
+        The shots fired during the turn along with their results.
+*/
+void recordSalvo(struct GameRecord *record, int player, struct SalvoResult *result)
+{
+    if (record->turnCount == MAX_TURNS || record->shotCount + result->shots > MAX_SHOTS)
+        return;
+
+    if (record->keyframed && record->turnCount % KEYFRAME_INTERVAL == 0 && record->turnCount / KEYFRAME_INTERVAL == record->keyframeCount)
+        storeKeyframe(record);
+
+    for (int i = 0; i < result->shots; i++)
+    {
+        struct RecordedShot *shot = &record->shots[record->shotCount++];
+
+        shot->player = player;
+        shot->cell = result->cells[i];
+        shot->outcome = result->statuses[i] == 'M' ? 'M' : (result->sunkShips[i] != '\0' ? result->sunkShips[i] : 'H');
+    }
+
+    record->turnStarts[++record->turnCount] = record->shotCount;
+}
+
+/*
+    Marks the recorded game as over.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record of the game.
+
+    `int winner`:
+        The player who won (0 or 1).
+*/
+void finishRecord(struct GameRecord *record, int winner)
+{
+    record->winner = winner;
+}
+
+/*
+    Writes the given record to the given file, in the format described at the top of this file.
+
+    Parameters
+    ----------
+    `FILE *file`:
+        File, opened in binary mode, to write to.
+
+    `struct GameRecord *record`:
+        The record to write.
+
+    Returns
+    -------
+    Returns `true` if the record was written, else it returns `false`.
+*/
+bool writeRecord(FILE *file, struct GameRecord *record)
+{
+    unsigned char buffer[MAX_RECORD_BYTES];
+    size_t size = encodeRecord(record, buffer);
+
+    return fwrite(buffer, 1, size, file) == size;
+}
+
+/*
+    Reads the next record from the given file.
+
+    Parameters
+    ----------
+    `FILE *file`:
+        File, opened in binary mode, to read from.
+
+    `struct GameRecord *record`:
+        Stores the record read.
+
+    Returns
+    -------
+    Returns `true` if a valid record was read, `false` if the end of the file was reached or if the data read
+    is not a valid record.
+*/
+bool readRecord(FILE *file, struct GameRecord *record)
+{
+    unsigned char header[16];
+
+    if (fread(header, 1, sizeof header, file) != sizeof header || memcmp(header, "BSRC", 4) != 0
+        || header[4] != RECORD_VERSION || header[14] != KEYFRAME_INTERVAL)
+    {
+        return false;
+    }
+
+    record->mode = header[5];
+    record->cpuPlayer = header[6] & 1;
+    record->cpuTurn = header[7] & 1;
+    record->difficulty = header[8];
+    record->winner = header[9] == 0xFF ? -1 : header[9] & 1;
+    record->turnCount = readShort(header + 10);
+    record->shotCount = readShort(header + 12);
+    record->keyframeCount = header[15];
+
+    if (record->turnCount > MAX_TURNS || record->shotCount > MAX_SHOTS || record->turnCount > record->shotCount
+        || record->keyframeCount < 1 || record->keyframeCount > MAX_KEYFRAMES)
+    {
+        return false;
+    }
+
+    if (fread(record->names, 1, sizeof record->names, file) != sizeof record->names
+        || fread(record->boards, 1, sizeof record->boards, file) != sizeof record->boards)
+    {
+        return false;
+    }
+
+    record->names[0][MAX_SIZE - 1] = record->names[1][MAX_SIZE - 1] = '\0';
+    int turn = 0;
+
+    for (int i = 0; i < record->shotCount; i++)
+    {
+        unsigned char shot[3];
+
+        if (fread(shot, 1, sizeof shot, file) != sizeof shot || shot[1] >= BOARD_SIZE * BOARD_SIZE)
+            return false;
+
+        if ((shot[0] & 2) || i == 0)
+        {
+            if (turn == record->turnCount)
+                return false;
+
+            record->turnStarts[turn++] = i;
+        }
+
+        record->shots[i].player = shot[0] & 1;
+        record->shots[i].cell = shot[1];
+        record->shots[i].outcome = shot[2];
+    }
+
+    if (turn != record->turnCount)
+        return false;
+
+    record->turnStarts[turn] = record->shotCount;
+
+    for (int i = 0; i < record->keyframeCount; i++)
+    {
+        unsigned char hitPoints[2 * SHIPS];
+
+        if (fread(record->keyframes[i].actionBoards, 1, sizeof record->keyframes[i].actionBoards, file)
+                != sizeof record->keyframes[i].actionBoards
+            || fread(hitPoints, 1, sizeof hitPoints, file) != sizeof hitPoints)
+        {
+            return false;
+        }
+
+        for (int j = 0; j < 2 * SHIPS; j++)
+            record->keyframes[i].shipsHP[j / SHIPS][j % SHIPS] = hitPoints[j];
+    }
+
+    return true;
+}
+
+/*
+    Appends the given record to the end of the given file, creating the file if it does not exist.
+
+    Parameters
+    ----------
+    `char *path`:
+        Path of the file.
+
+    `struct GameRecord *record`:
+        The record to append.
+
+    Returns
+    -------
+    Returns `true` if the record was saved, else it returns `false`.
+*/
+bool appendRecord(char *path, struct GameRecord *record)
+{
+    FILE *file = fopen(path, "ab");
+
+    if (file == NULL)
+        return false;
+
+    bool written = writeRecord(file, record);
+
+    return fclose(file) == 0 && written;
+}
+
+/*
+    Rebuilds the state of the recorded game as it was at the start of the given turn. The state is loaded from
+    the closest keyframe before the turn, so at most KEYFRAME_INTERVAL - 1 turns have to be replayed.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record of the game.
+
+    `int turn`:
+        The turn to seek to, from 0 to turnCount. Seeking to turnCount gives the state at the end of the game.
+
+    `struct Player state[2]`:
+        Stores the boards, action boards and hit points of both players.
+*/
+void seekRecord(struct GameRecord *record, int turn, struct Player state[2])
+{
+    turn = turn < 0 ? 0 : (turn > record->turnCount ? record->turnCount : turn);
+    int keyframe = turn / KEYFRAME_INTERVAL < record->keyframeCount ? turn / KEYFRAME_INTERVAL : record->keyframeCount - 1;
+
+    for (int i = 0; i < 2; i++)
+    {
+        memcpy(state[i].name, record->names[i], MAX_SIZE);
+        memcpy(state[i].board, record->boards[i], sizeof state[i].board);
+        memcpy(state[i].actionBoard, record->keyframes[keyframe].actionBoards[i], sizeof state[i].actionBoard);
+        memcpy(state[i].shipsHP, record->keyframes[keyframe].shipsHP[i], sizeof state[i].shipsHP);
+        indexUnguessedCells(&state[i]);
+    }
+
+    for (int i = record->turnStarts[keyframe * KEYFRAME_INTERVAL]; i < record->turnStarts[turn]; i++)
+    {
+        struct RecordedShot *shot = &record->shots[i];
+        resolveShot(&state[shot->player], &state[1 - shot->player], shot->cell / 10, shot->cell % 10, NULL);
+    }
+}
+
+/*
+    Starts recording a game between the given players, neither of whom is marked as a CPU. Must be called once
+    both players have placed their ships.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record to start.
+
+    `GameMode mode`:
+        Rules the game is played with.
+
+    `struct Player players[2]`:
+        The players, whose names and boards are recorded.
+
+    `bool keyframed`:
+        Whether to store keyframes as the game is recorded.
+*/
+void beginPlayersRecord(struct GameRecord *record, GameMode mode, struct Player players[2], bool keyframed)
+{
+    record->mode = mode;
+    record->cpuPlayer = false;
+    record->cpuTurn = 0;
+    record->difficulty = 0;
+    record->winner = -1;
+    record->shotCount = 0;
+    record->turnCount = 0;
+    record->turnStarts[0] = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        // only the name itself is copied, the rest zeroed, as what is left in the player after it is written out
+        strncpy(record->names[i], players[i].name, MAX_SIZE - 1);
+        record->names[i][MAX_SIZE - 1] = '\0';
+        memcpy(record->boards[i], players[i].board, sizeof record->boards[i]);
+        memset(record->keyframes[0].actionBoards[i], ' ', sizeof record->keyframes[0].actionBoards[i]);
+
+        for (int j = 0; j < SHIPS; j++)
+            record->keyframes[0].shipsHP[i][j] = getShipLength(j);
+    }
+
+    record->keyframeCount = 1;
+    record->keyframed = keyframed;
+}
+
+/*
+    Stores the given record in the given buffer, in the format described at the top of this file.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record to store.
+
+    `unsigned char *buffer`:
+        Buffer of at least MAX_RECORD_BYTES bytes to store the record in.
+
+    Returns
+    -------
+    Returns the number of bytes stored.
+*/
+size_t encodeRecord(struct GameRecord *record, unsigned char *buffer)
+{
+    unsigned char *end = buffer;
+
+    end[0] = 'B';
+    end[1] = 'S';
+    end[2] = 'R';
+    end[3] = 'C';
+    end[4] = RECORD_VERSION;
+    end[5] = record->mode;
+    end[6] = record->cpuPlayer ? 1 : 0;
+    end[7] = record->cpuTurn;
+    end[8] = record->difficulty;
+    end[9] = record->winner == -1 ? 0xFF : record->winner;
+    writeShort(end + 10, record->turnCount);
+    writeShort(end + 12, record->shotCount);
+    end[14] = KEYFRAME_INTERVAL;
+    end[15] = record->keyframeCount;
+    end += 16;
+
+    memcpy(end, record->names, sizeof record->names);
+    end += sizeof record->names;
+    memcpy(end, record->boards, sizeof record->boards);
+    end += sizeof record->boards;
+
+    int turn = 0;
+
+    for (int i = 0; i < record->shotCount; i++)
+    {
+        bool turnStart = record->turnStarts[turn] == i;
+
+        // skipping the starts of turns in which no shots were fired
+        while (record->turnStarts[turn] == i)
+            turn++;
+
+        *end++ = record->shots[i].player | (turnStart ? 2 : 0);
+        *end++ = record->shots[i].cell;
+        *end++ = record->shots[i].outcome;
+    }
+
+    for (int i = 0; i < record->keyframeCount; i++)
+    {
+        memcpy(end, record->keyframes[i].actionBoards, sizeof record->keyframes[i].actionBoards);
+        end += sizeof record->keyframes[i].actionBoards;
+
+        for (int j = 0; j < 2 * SHIPS; j++)
+            *end++ = record->keyframes[i].shipsHP[j / SHIPS][j % SHIPS];
+    }
+
+    return end - buffer;
+}
+
+/*
+    Reads only the header and the names of the next record from the given file, and skips over the rest of it,
+    so that the games of a long file can be listed or counted without reading their shots.
+
+    Parameters
+    ----------
+    `FILE *file`:
+        File, opened in binary mode, to read from.
+
+    `struct GameRecord *record`:
+        Stores the mode, players, winner, turn count and shot count of the record read. Its shots, turn starts
+        and keyframes are left as they were.
+
+    Returns
+    -------
+    Returns `true` if the header of a valid record was read, `false` if the end of the file was reached or if
+    the data read is not a valid record.
+*/
+bool skimRecord(FILE *file, struct GameRecord *record)
+{
+    unsigned char header[16];
+
+    if (fread(header, 1, sizeof header, file) != sizeof header || memcmp(header, "BSRC", 4) != 0
+        || header[4] != RECORD_VERSION || header[14] != KEYFRAME_INTERVAL)
+    {
+        return false;
+    }
+
+    record->mode = header[5];
+    record->cpuPlayer = header[6] & 1;
+    record->cpuTurn = header[7] & 1;
+    record->difficulty = header[8];
+    record->winner = header[9] == 0xFF ? -1 : header[9] & 1;
+    record->turnCount = readShort(header + 10);
+    record->shotCount = readShort(header + 12);
+    record->keyframeCount = header[15];
+
+    if (record->turnCount > MAX_TURNS || record->shotCount > MAX_SHOTS || record->turnCount > record->shotCount
+        || record->keyframeCount < 1 || record->keyframeCount > MAX_KEYFRAMES
+        || fread(record->names, 1, sizeof record->names, file) != sizeof record->names)
+    {
+        return false;
+    }
+
+    record->names[0][MAX_SIZE - 1] = record->names[1][MAX_SIZE - 1] = '\0';
+
+    // the rest of the record has the size given by its header
+    long rest = (long) sizeof record->boards + 3L * record->shotCount
+        + (long) record->keyframeCount * (2 * BOARD_SIZE * BOARD_SIZE + 2 * SHIPS);
+
+    return fseek(file, rest, SEEK_CUR) == 0;
+}
+
+/*
+    Stores a keyframe holding the state at the start of the turn about to be recorded.
+
+    Parameter
+    ---------
+    `struct GameRecord *record`:
+        The record to store the keyframe in.
+*/
+void storeKeyframe(struct GameRecord *record)
+{
+    struct Player state[2];
+    struct Keyframe *keyframe = &record->keyframes[record->keyframeCount];
+
+    seekRecord(record, record->turnCount, state);
+
+    for (int i = 0; i < 2; i++)
+    {
+        memcpy(keyframe->actionBoards[i], state[i].actionBoard, sizeof keyframe->actionBoards[i]);
+        memcpy(keyframe->shipsHP[i], state[i].shipsHP, sizeof keyframe->shipsHP[i]);
+    }
+
+    record->keyframeCount++;
+}
+
+/*
+    Stores the given number in the first two bytes of the given buffer, least significant byte first.
+*/
+void writeShort(unsigned char *buffer, int value)
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+}
+
+/*
+    Returns the number stored in the first two bytes of the given buffer, least significant byte first.
+*/
+int readShort(unsigned char *buffer)
+{
+    return buffer[0] | (buffer[1] << 8);
+}
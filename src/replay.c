@@ -0,0 +1,373 @@
+/*
+
+File Name: replay.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the replay viewer, which steps through a recorded game turn by turn. The viewer can play the game
+    on its own at a chosen speed, and can jump to any turn without replaying the game from the start.
+
+    INCLUDES (user-defined)
+    -----------------------
+    replay.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. void runReplay(char *path, long long game)
+
+    FUNCTIONS (local)
+    -----------------
+    1. long long chooseRecord(FILE *file, char *path, struct GameRecord *record)
+    2. bool loadReplayRecord(FILE *file, long long game, struct GameRecord *record)
+    3. void replayGame(struct GameRecord *record)
+    4. void showReplay(struct GameRecord *record, int turn, struct Player state[2], bool playing, int speed)
+    5. bool waitForInput(int milliseconds)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <replay.h>
+#include <ctype.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <conio.h>
+    #include <windows.h>
+#else
+    #include <sys/select.h>
+    #include <unistd.h>
+#endif
+
+long long chooseRecord(FILE *file, char *path, struct GameRecord *record);
+bool loadReplayRecord(FILE *file, long long game, struct GameRecord *record);
+void replayGame(struct GameRecord *record);
+void showReplay(struct GameRecord *record, int turn, struct Player state[2], bool playing, int speed);
+bool waitForInput(int milliseconds);
+
+/*
+    Replays a game recorded in the given file, chosen by the user if it is not given. The file is read one game
+    at a time and only the chosen game is kept, so that files holding any number of games can be replayed.
+
+    Parameters
+    ----------
+    `char *path`:
+        Path of the record file.
+
+    `long long game`:
+        Number of the game to replay, counting from 1, or 0 to let the user choose it.
+*/
+void runReplay(char *path, long long game)
+{
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        printf("Could not open %s.\n", path);
+        return;
+    }
+
+    struct GameRecord *record = (struct GameRecord *) malloc(sizeof(struct GameRecord));
+
+    if (record == NULL)
+    {
+        printf("Could not allocate memory for the recorded game.\n");
+        fclose(file);
+        return;
+    }
+
+    game = game > 0 ? game : chooseRecord(file, path, record);
+
+    if (game > 0 && loadReplayRecord(file, game, record))
+        replayGame(record);
+    else if (game > 0)
+        printf("Could not read game %lld of %s.\n", game, path);
+
+    fclose(file);
+    free(record);
+}
+
+/*
+    Lists the first REPLAY_LIST_GAMES games of the given file and lets the user choose any of its games by
+    number. Only the header of every game is read to list and count them.
+
+    Parameters
+    ----------
+    `FILE *file`:
+        The record file, read from its start.
+
+    `char *path`:
+        Path of the record file.
+
+    `struct GameRecord *record`:
+        Used to read the headers of the games.
+
+    Returns
+    -------
+    Returns the number of the chosen game, counting from 1, or 0 if the file holds no games or input could not
+    be read anymore.
+*/
+long long chooseRecord(FILE *file, char *path, struct GameRecord *record)
+{
+    long long count = 0;
+
+    while (skimRecord(file, record))
+    {
+        if (count++ == 0)
+            printf("\nRecorded games:\n");
+
+        if (count <= REPLAY_LIST_GAMES)
+        {
+            printf(
+                "%lld. %s vs %s (%s, %d turns, %s won)\n", count, record->names[0], record->names[1],
+                record->mode == SALVO ? "Salvo" : "Classic", record->turnCount,
+                record->winner == -1 ? "nobody" : record->names[record->winner]
+            );
+        }
+    }
+
+    if (!feof(file) && count > 0)
+        printf("Could not read past game %lld of %s, the rest of the file will be skipped.\n", count, path);
+
+    if (count > REPLAY_LIST_GAMES)
+        printf("... and %lld more.\n", count - REPLAY_LIST_GAMES);
+
+    if (count == 0)
+        printf("%s does not contain any recorded games.\n", path);
+
+    if (count <= 1)
+        return count;
+
+    char input[INPUT_SIZE];
+
+    while (1)
+    {
+        printf("Enter game to replay (1 - %lld): ", count);
+
+        ReturnCode returnCode = takeLine(input, INPUT_SIZE);
+
+        if (returnCode == ERR_CANNOT_READ)
+            return 0;
+
+        char *end;
+        long long choice = strtoll(input, &end, 10);
+
+        if (returnCode != OK || !isdigit((unsigned char) input[0]) || *end != '\0')
+        {
+            printf("Enter only a number.\n");
+            continue;
+        }
+
+        if (choice < 1 || choice > count)
+        {
+            printf("Enter only numbers from 1 - %lld.\n", count);
+            continue;
+        }
+
+        return choice;
+    }
+}
+
+/*
+    Reads the given game of the record file, skipping over the games before it by their headers alone.
+
+    Parameters
+    ----------
+    `FILE *file`:
+        The record file.
+
+    `long long game`:
+        Number of the game, counting from 1.
+
+    `struct GameRecord *record`:
+        Stores the game read.
+
+    Returns
+    -------
+    Returns `true` if the game was read, `false` if the file has fewer games or could not be read.
+*/
+bool loadReplayRecord(FILE *file, long long game, struct GameRecord *record)
+{
+    rewind(file);
+
+    for (long long i = 1; i < game; i++)
+    {
+        if (!skimRecord(file, record))
+            return false;
+    }
+
+    return readRecord(file, record);
+}
+
+/*
+    Runs the replay viewer on the given record until the user quits.
+
+    Parameter
+    ---------
+    `struct GameRecord *record`:
+        The record to replay.
+*/
+void replayGame(struct GameRecord *record)
+{
+    struct Player state[2];
+    char input[INPUT_SIZE];
+    int turn = 0, speed = 1;
+    bool playing = false;
+
+    while (1) // breaks once the user quits
+    {
+        if (playing && turn == record->turnCount)
+            playing = false;
+
+        seekRecord(record, turn, state);
+        showReplay(record, turn, state, playing, speed);
+
+        if (playing && !waitForInput(1000 / speed))
+        {
+            turn++;
+            continue;
+        }
+
+        if (takeLine(input, INPUT_SIZE) == ERR_CANNOT_READ)
+            return;
+
+        int value;
+
+        switch (tolower(input[0]))
+        {
+            case '\0':
+            case 'n':
+                turn = turn < record->turnCount ? turn + 1 : turn;
+                break;
+
+            case 'b':
+                turn = turn > 0 ? turn - 1 : turn;
+                break;
+
+            case 'g':
+                if (sscanf(input + 1, "%d", &value) == 1)
+                    turn = value < 0 ? 0 : (value > record->turnCount ? record->turnCount : value);
+                break;
+
+            case 'p':
+                playing = !playing;
+                break;
+
+            case 's':
+                if (sscanf(input + 1, "%d", &value) == 1)
+                    speed = value < 1 ? 1 : (value > MAX_REPLAY_SPEED ? MAX_REPLAY_SPEED : value);
+                break;
+
+            case 'q':
+                return;
+        }
+    }
+}
+
+/*
+    Shows the state of the recorded game at the start of the given turn, along with the shots of the turn
+    before it.
+
+    Parameters
+    ----------
+    `struct GameRecord *record`:
+        The record being replayed.
+
+    `int turn`:
+        The turn being shown.
+
+    `struct Player state[2]`:
+        State of both players at the start of the turn.
+
+    `bool playing`:
+        Whether the replay is playing on its own.
+
+    `int speed`:
+        Turns shown per second while playing.
+*/
+void showReplay(struct GameRecord *record, int turn, struct Player state[2], bool playing, int speed)
+{
+    clearScreen();
+    printf(
+        "Replay: %s vs %s (%s)\nTurn %d of %d, %s at %d turn(s) per second\n", record->names[0], record->names[1],
+        record->mode == SALVO ? "Salvo" : "Classic", turn, record->turnCount, playing ? "playing" : "paused", speed
+    );
+
+    for (int i = 0; i < 2; i++)
+    {
+        char mergedBoard[BOARD_SIZE][BOARD_SIZE];
+
+        mergeBoards(state[i].board, state[1 - i].actionBoard, mergedBoard);
+        printf("\n%s's fleet (%d ship(s) left):\n", state[i].name, countShipsLeft(&state[i]));
+        displayBoard(mergedBoard);
+    }
+
+    if (turn > 0)
+    {
+        int first = record->turnStarts[turn - 1];
+        printf("\nLast turn, %s fired at:", record->names[record->shots[first].player]);
+
+        for (int i = first; i < record->turnStarts[turn]; i++)
+        {
+            struct RecordedShot *shot = &record->shots[i];
+            Ships sunk = getShipFromIcon(shot->outcome);
+
+            printf(" %c%d", 'A' + shot->cell % 10, shot->cell / 10 + 1);
+
+            if (shot->outcome == 'M')
+                printf(" (miss)");
+            else if (sunk != -1)
+                printf(" (sunk %s)", getShipName(sunk));
+            else
+                printf(" (hit)");
+        }
+
+        printf("\n");
+    }
+
+    if (turn == record->turnCount && record->winner != -1)
+        printf("\n%s won the game.\n", record->names[record->winner]);
+
+    printf("\nENTER/n: next turn, b: previous turn, g N: go to turn N, p: play/pause, s N: speed, q: quit\n> ");
+    fflush(stdout);
+}
+
+/*
+    Waits for the user to type something, for at most the given time.
+
+    Parameter
+    ---------
+    `int milliseconds`:
+        Max time to wait for.
+
+    Returns
+    -------
+    Returns `true` if input is ready to be read, else it returns `false`.
+*/
+bool waitForInput(int milliseconds)
+{
+#ifdef _WIN32
+    for (int waited = 0; waited < milliseconds; waited += 10)
+    {
+        if (_kbhit())
+            return true;
+
+        Sleep(10);
+    }
+
+    return _kbhit() != 0;
+#else
+    fd_set inputs;
+    struct timeval timeout = { milliseconds / 1000, (milliseconds % 1000) * 1000 };
+
+    FD_ZERO(&inputs);
+    FD_SET(STDIN_FILENO, &inputs);
+
+    return select(STDIN_FILENO + 1, &inputs, NULL, NULL, &timeout) > 0;
+#endif
+}
@@ -0,0 +1,432 @@
+/*
+
+File Name: snapshot.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to save a game in progress and to load it again, so that it can be resumed later.
+
+    A snapshot is SNAPSHOT_SIZE bytes, written as:
+        - an 8 byte header: "BSSV", version, mode, phase and flags (bit 0: CPU player, bit 1: play again).
+        - the player whose input is waited on, the number of ships placed, the ship being placed, the ships yet
+          to be placed (bit i: ship i) and the starting position given for the ship being placed, 4 bytes.
+        - the last salvo: number of shots and hits, then the cells, statuses and sunk ships of its shots, SHIPS
+          bytes each.
+        - the CPU: turn, difficulty, budget (4 bytes), state of its generator (8 bytes), last move, hit count,
+          how many times its orientation has flipped, its orientation, the number of cells on its checkout stack
+          (0xFF if it has none) and the cells on it, CHECKOUT_SIZE bytes, followed by the name of its strategy,
+          STRATEGY_NAME_SIZE bytes, empty unless it plays with one.
+        - both players, each as name, board, action board and the hit points of every ship, one byte each.
+    Numbers taking several bytes are stored with the least significant byte first, and -1 is stored as 0xFF.
+
+    Everything else a game holds is rebuilt when it is loaded, and a game that is loaded is not recorded. A game
+    against a strategy can only be loaded while the strategy is loaded.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. snapshot.h
+    2. stack.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. void encodeSnapshot(struct Game *game, unsigned char buffer[SNAPSHOT_SIZE])
+    2. bool decodeSnapshot(unsigned char buffer[SNAPSHOT_SIZE], struct Game *game)
+    3. bool saveSnapshot(char *path, struct Game *game)
+    4. bool loadSnapshot(char *path, struct Game *game)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void writeNumber(unsigned char *buffer, unsigned long long value, int bytes)
+    2. unsigned long long readNumber(unsigned char *buffer, int bytes)
+    3. bool isValidBoard(char board[BOARD_SIZE][BOARD_SIZE], bool actionBoard)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <snapshot.h>
+#include <stack.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+void writeNumber(unsigned char *buffer, unsigned long long value, int bytes);
+unsigned long long readNumber(unsigned char *buffer, int bytes);
+bool isValidBoard(char board[BOARD_SIZE][BOARD_SIZE], bool actionBoard);
+
+/*
+    Writes the snapshot of the given game into a buffer.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game to save.
+
+    `unsigned char buffer[SNAPSHOT_SIZE]`:
+        Stores the snapshot.
+*/
+void encodeSnapshot(struct Game *game, unsigned char buffer[SNAPSHOT_SIZE])
+{
+    unsigned char *byte = buffer + 8;
+    struct CPUState *cpu = &game->cpu;
+
+    memcpy(buffer, "BSSV", 4);
+    buffer[4] = SNAPSHOT_VERSION;
+    buffer[5] = game->mode;
+    buffer[6] = game->phase;
+    buffer[7] = (game->cpuPlayer ? 1 : 0) | (game->playAgain ? 2 : 0);
+
+    bool placing = game->phase == PLACE_START || game->phase == PLACE_END; // the ship being placed is only set then
+
+    *byte++ = game->playerTurn;
+    *byte++ = game->shipsPlaced;
+    *byte++ = placing ? game->chosenShip : 0;
+    *byte = 0;
+
+    for (int i = 0; i < SHIPS; i++)
+        *byte |= game->shipsAvailable[i] ? 1 << i : 0;
+
+    memset(++byte, 0, 4);
+
+    if (game->phase == PLACE_END)
+        memcpy(byte, game->startPosition, 4);
+
+    byte += 4;
+
+    *byte++ = game->lastSalvo.shots;
+    *byte++ = game->lastSalvo.shots > 0 ? game->lastSalvo.hits : 0; // the rest of lastSalvo is only set by a move
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        byte[i] = game->lastSalvo.cells[i];
+        byte[SHIPS + i] = game->lastSalvo.statuses[i];
+        byte[2 * SHIPS + i] = game->lastSalvo.sunkShips[i];
+    }
+
+    byte += 3 * SHIPS;
+
+    *byte++ = cpu->turn;
+    *byte++ = cpu->difficulty;
+    writeNumber(byte, cpu->budget, 4);
+    writeNumber(byte + 4, cpu->random.state, 8);
+    byte += 12;
+    *byte++ = cpu->lastMove;
+    *byte++ = cpu->hitCount;
+    *byte++ = cpu->orientationFlips;
+    *byte++ = cpu->guessOrientation;
+    *byte++ = cpu->checkout == NULL ? 0xFF : cpu->checkout->stackPointer;
+    memset(byte, 0, CHECKOUT_SIZE);
+
+    for (int i = 0; cpu->checkout != NULL && i < cpu->checkout->stackPointer && i < CHECKOUT_SIZE; i++)
+        byte[i] = cpu->checkout->stack[i];
+
+    byte += CHECKOUT_SIZE;
+    memset(byte, 0, STRATEGY_NAME_SIZE);
+
+    if (cpu->strategy != NULL)
+        strncpy((char *) byte, cpu->strategy->name, STRATEGY_NAME_SIZE - 1);
+
+    byte += STRATEGY_NAME_SIZE;
+
+    for (int i = 0; i < 2; i++)
+    {
+        memcpy(byte, game->players[i].name, MAX_SIZE);
+        memcpy(byte + MAX_SIZE, game->players[i].board, BOARD_SIZE * BOARD_SIZE);
+        memcpy(byte + MAX_SIZE + BOARD_SIZE * BOARD_SIZE, game->players[i].actionBoard, BOARD_SIZE * BOARD_SIZE);
+        byte += MAX_SIZE + 2 * BOARD_SIZE * BOARD_SIZE;
+
+        for (int j = 0; j < SHIPS; j++)
+            *byte++ = game->players[i].shipsHP[j];
+    }
+}
+
+/*
+    Reads a game from its snapshot. The game does not need to be set up beforehand, and has to be freed with
+    freeGame once it is no longer needed, unless the snapshot could not be read.
+
+    Parameters
+    ----------
+    `unsigned char buffer[SNAPSHOT_SIZE]`:
+        The snapshot.
+
+    `struct Game *game`:
+        Stores the game.
+
+    Returns
+    -------
+    Returns `true` if the snapshot was read, `false` if it is not a valid snapshot of a game in progress.
+*/
+bool decodeSnapshot(unsigned char buffer[SNAPSHOT_SIZE], struct Game *game)
+{
+    unsigned char *byte = buffer + 8;
+    struct CPUState *cpu = &game->cpu;
+
+    if (memcmp(buffer, "BSSV", 4) != 0 || buffer[4] != SNAPSHOT_VERSION || buffer[5] > SALVO || buffer[6] >= PLAY_AGAIN)
+        return false;
+
+    game->mode = buffer[5];
+    game->phase = buffer[6];
+    game->cpuPlayer = (buffer[7] & 1) != 0;
+    game->playAgain = (buffer[7] & 2) != 0;
+    game->record = NULL;
+    game->spectators = NULL;
+    game->hints[0] = game->hints[1] = NULL;
+
+    game->playerTurn = *byte++;
+    game->shipsPlaced = *byte++;
+    game->chosenShip = *byte++;
+
+    for (int i = 0; i < SHIPS; i++)
+        game->shipsAvailable[i] = (*byte & (1 << i)) != 0;
+
+    memcpy(game->startPosition, ++byte, 4);
+    game->startPosition[3] = '\0';
+    byte += 4;
+
+    if (game->playerTurn < 1 || game->playerTurn > 2 || game->shipsPlaced > SHIPS || game->chosenShip >= SHIPS)
+        return false;
+
+    game->lastSalvo.shots = *byte++;
+    game->lastSalvo.hits = *byte++;
+
+    for (int i = 0; i < SHIPS; i++)
+    {
+        game->lastSalvo.cells[i] = byte[i];
+        game->lastSalvo.statuses[i] = byte[SHIPS + i];
+        game->lastSalvo.sunkShips[i] = byte[2 * SHIPS + i];
+    }
+
+    byte += 3 * SHIPS;
+
+    if (game->lastSalvo.shots > SHIPS || game->lastSalvo.hits > game->lastSalvo.shots)
+        return false;
+
+    initCPUState(cpu, byte[0], byte[1], 0);
+    cpu->budget = readNumber(byte + 2, 4);
+    cpu->random.state = readNumber(byte + 6, 8);
+    byte += 14;
+    cpu->lastMove = (signed char) *byte++;
+    cpu->hitCount = *byte++;
+    cpu->orientationFlips = *byte++;
+    cpu->guessOrientation = (signed char) *byte++;
+
+    int checkoutCount = *byte++;
+    unsigned char *checkout = byte;
+    char strategyName[STRATEGY_NAME_SIZE];
+
+    byte += CHECKOUT_SIZE;
+    memcpy(strategyName, byte, STRATEGY_NAME_SIZE);
+    strategyName[STRATEGY_NAME_SIZE - 1] = '\0';
+    byte += STRATEGY_NAME_SIZE;
+    cpu->strategy = cpu->difficulty == PLUGIN ? findStrategy(strategyName) : NULL;
+
+    if (cpu->turn > 1 || cpu->random.state == 0 || (game->cpuPlayer && (cpu->difficulty < EASY || cpu->difficulty > POLICY))
+        || (game->cpuPlayer && cpu->difficulty == PLUGIN && cpu->strategy == NULL)
+        || cpu->lastMove >= BOARD_SIZE * BOARD_SIZE || (checkoutCount > CHECKOUT_SIZE && checkoutCount != 0xFF))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        resetPlayer(&game->players[i]);
+        memcpy(game->players[i].name, byte, MAX_SIZE);
+        memcpy(game->players[i].board, byte + MAX_SIZE, BOARD_SIZE * BOARD_SIZE);
+        memcpy(game->players[i].actionBoard, byte + MAX_SIZE + BOARD_SIZE * BOARD_SIZE, BOARD_SIZE * BOARD_SIZE);
+        game->players[i].name[MAX_SIZE - 1] = '\0';
+
+        for (int j = 0; j < SHIPS; j++)
+        {
+            game->players[i].shipsHP[j] = byte[MAX_SIZE + 2 * BOARD_SIZE * BOARD_SIZE + j];
+
+            if (game->players[i].shipsHP[j] > getShipLength(j))
+                return false;
+        }
+
+        if (!isValidBoard(game->players[i].board, false) || !isValidBoard(game->players[i].actionBoard, true))
+            return false;
+
+        indexUnguessedCells(&game->players[i]);
+        byte += MAX_SIZE + 2 * BOARD_SIZE * BOARD_SIZE + SHIPS;
+    }
+
+    // the checkout stack is allocated last, so that nothing has to be freed when the snapshot is not valid
+    if (checkoutCount != 0xFF)
+    {
+        for (int i = 0; i < checkoutCount; i++)
+        {
+            if (checkout[i] >= BOARD_SIZE * BOARD_SIZE)
+                return false;
+        }
+
+        cpu->checkout = createStack(CHECKOUT_SIZE);
+
+        if (cpu->checkout == NULL)
+            return false;
+
+        for (int i = 0; i < checkoutCount; i++)
+            push(cpu->checkout, checkout[i]);
+    }
+
+    if (game->cpuPlayer)
+        restoreCPUState(cpu, &game->players[cpu->turn], &game->players[1 - cpu->turn]);
+
+    return true;
+}
+
+/*
+    Saves the given game to a file, replacing the game saved in it before. The snapshot is written to a 
+    temporary file which then takes the file's place, so that the file always holds a complete snapshot, even 
+    if the program stops while saving.
+
+    Parameters
+    ----------
+    `char *path`:
+        Path of the file to save to.
+
+    `struct Game *game`:
+        The game to save.
+
+    Returns
+    -------
+    Returns `true` if the game was saved, `false` otherwise.
+*/
+bool saveSnapshot(char *path, struct Game *game)
+{
+    unsigned char buffer[SNAPSHOT_SIZE];
+    char temporaryPath[FILENAME_MAX];
+
+    if (snprintf(temporaryPath, sizeof temporaryPath, "%s.tmp", path) >= (int) sizeof temporaryPath)
+        return false;
+
+    encodeSnapshot(game, buffer);
+
+    FILE *file = fopen(temporaryPath, "wb");
+
+    if (file == NULL)
+        return false;
+
+    bool written = fwrite(buffer, 1, sizeof buffer, file) == sizeof buffer;
+
+    if (fclose(file) != 0 || !written)
+    {
+        remove(temporaryPath);
+        return false;
+    }
+
+#ifdef _WIN32
+    // rename does not replace an existing file on Windows
+    return MoveFileExA(temporaryPath, path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(temporaryPath, path) == 0;
+#endif
+}
+
+/*
+    Loads a game saved with saveSnapshot.
+
+    Parameters
+    ----------
+    `char *path`:
+        Path of the file to load from.
+
+    `struct Game *game`:
+        Stores the game, see decodeSnapshot.
+
+    Returns
+    -------
+    Returns `true` if a game was loaded, `false` if the file could not be read or does not hold a valid snapshot.
+*/
+bool loadSnapshot(char *path, struct Game *game)
+{
+    unsigned char buffer[SNAPSHOT_SIZE];
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+        return false;
+
+    bool read = fread(buffer, 1, sizeof buffer, file) == sizeof buffer && fgetc(file) == EOF;
+
+    fclose(file);
+
+    return read && decodeSnapshot(buffer, game);
+}
+
+/*
+    Writes a number into a buffer, least significant byte first.
+
+    Parameters
+    ----------
+    `unsigned char *buffer`:
+        Buffer to write into.
+
+    `unsigned long long value`:
+        The number to write.
+
+    `int bytes`:
+        Number of bytes to write the number in.
+*/
+void writeNumber(unsigned char *buffer, unsigned long long value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+        buffer[i] = (value >> (8 * i)) & 0xFF;
+}
+
+/*
+    Reads a number written with writeNumber.
+
+    Parameters
+    ----------
+    `unsigned char *buffer`:
+        Buffer to read from.
+
+    `int bytes`:
+        Number of bytes the number was written in.
+
+    Returns
+    -------
+    Returns the number read.
+*/
+unsigned long long readNumber(unsigned char *buffer, int bytes)
+{
+    unsigned long long value = 0;
+
+    for (int i = 0; i < bytes; i++)
+        value |= (unsigned long long) buffer[i] << (8 * i);
+
+    return value;
+}
+
+/*
+    Checks that a board read from a snapshot only holds what a board can hold.
+
+    Parameters
+    ----------
+    `char board[BOARD_SIZE][BOARD_SIZE]`:
+        The board to check.
+
+    `bool actionBoard`:
+        Whether the board is an action board, which holds guesses, rather than a board holding ships.
+
+    Returns
+    -------
+    Returns `true` if the board is valid, `false` otherwise.
+*/
+bool isValidBoard(char board[BOARD_SIZE][BOARD_SIZE], bool actionBoard)
+{
+    for (int row = 0; row < BOARD_SIZE; row++)
+    {
+        for (int col = 0; col < BOARD_SIZE; col++)
+        {
+            char cell = board[row][col];
+
+            if (cell != ' ' && (actionBoard ? cell != 'X' && cell != 'O' : getShipFromIcon(cell) == -1))
+                return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,731 @@
+/*
+
+File Name: spectate.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to let any number of spectators watch a game over a Unix or TCP socket.
+
+    Spectators only see what both players know: the action boards of both players, the ships each player has
+    sunk and the last move made. Every time this changes, the text shown to spectators is written once into a
+    frame, which is shared by every spectator it is sent to and freed once the last of them has been sent it.
+    The game's thread only queues the frame and wakes up the server's thread, which accepts spectators and
+    writes out the queued frames of each spectator with a single writev. Sockets never block, and a spectator
+    that falls SPECTATOR_QUEUE frames behind is dropped, so that a slow spectator never holds up the game or
+    the other spectators. A spectator that joins is sent the latest frame right away.
+
+    Spectating needs POSIX sockets, so it is not available on Windows.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. spectate.h
+    2. thread.h
+
+    STRUCTS
+    -------
+    1. SpectatorFrame
+    2. Spectator
+    3. SpectatorServer
+
+    FUNCTIONS (global)
+    ------------------
+    1. struct SpectatorServer *openSpectatorServer(char *address)
+    2. void publishGame(struct SpectatorServer *server, struct Game *game, int shooter)
+    3. void closeSpectatorServer(struct SpectatorServer *server)
+
+    FUNCTIONS (local)
+    -----------------
+    1. int encodeFrame(struct Game *game, int shooter, char *text)
+    2. void appendText(char *text, int *length, char *format, ...)
+    3. void wakeServer(struct SpectatorServer *server)
+    4. int openListener(char *address, char *path)
+    5. void *serveSpectators(void *argument)
+    6. void acceptSpectators(struct SpectatorServer *server)
+    7. bool flushSpectator(struct Spectator *spectator)
+    8. void dropSpectator(struct SpectatorServer *server, int index)
+    9. void releaseFrame(struct SpectatorFrame *frame)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <spectate.h>
+#include <thread.h>
+#include <stdarg.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <unistd.h>
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <sys/un.h>
+#endif
+
+/*
+    SpectatorFrame struct, contains the text sent to spectators for one state of a game, which is never changed
+    once written. Contains:
+    - int references: number of spectators the frame is queued for, plus one while it is the latest frame.
+    - int length: length of text.
+    - char text[]: the text.
+*/
+struct SpectatorFrame {
+    int references;
+    int length;
+    char text[];
+};
+
+/*
+    Spectator struct, contains one spectator and the frames still to be sent to it. Contains:
+    - int socket: socket connected to the spectator.
+    - struct SpectatorFrame *queue[SPECTATOR_QUEUE]: frames still to be sent, in a ring starting at first.
+    - int first: position of the oldest frame in queue.
+    - int count: number of frames in queue.
+    - int offset: number of bytes of the oldest frame already sent.
+    - bool lagging: whether a frame could not be queued because queue was full, after which the spectator is
+      dropped.
+*/
+struct Spectator {
+    int socket;
+    struct SpectatorFrame *queue[SPECTATOR_QUEUE];
+    int first;
+    int count;
+    int offset;
+    bool lagging;
+};
+
+#ifndef _WIN32
+/*
+    SpectatorServer struct, contains the socket spectators connect to and everyone watching. Everything but
+    listener, wakeup, path, thread and polls is shared between threads and only used while holding lock.
+    Contains:
+    - int listener: socket spectators connect to.
+    - int wakeup[2]: pipe written to by the game's thread to wake up the server's thread.
+    - char path[FILENAME_MAX]: path of listener if it is a Unix socket, removed once the server is closed.
+    - struct Mutex lock: lock guarding the rest of the server.
+    - struct Thread thread: the server's thread.
+    - bool stopping: whether the server's thread should stop.
+    - struct SpectatorFrame *latest: the latest frame, sent to spectators as soon as they join.
+    - int count: number of spectators.
+    - struct Spectator spectators[SPECTATOR_MAX]: the spectators, which are only ever added or removed by the
+      server's thread.
+    - struct pollfd polls[SPECTATOR_MAX + 2]: sockets waited on by the server's thread.
+*/
+struct SpectatorServer {
+    int listener;
+    int wakeup[2];
+    char path[FILENAME_MAX];
+    struct Mutex lock;
+    struct Thread thread;
+    bool stopping;
+    struct SpectatorFrame *latest;
+    int count;
+    struct Spectator spectators[SPECTATOR_MAX];
+    struct pollfd polls[SPECTATOR_MAX + 2];
+};
+#endif
+
+int encodeFrame(struct Game *game, int shooter, char *text);
+void appendText(char *text, int *length, char *format, ...);
+void wakeServer(struct SpectatorServer *server);
+int openListener(char *address, char *path);
+void *serveSpectators(void *argument);
+void acceptSpectators(struct SpectatorServer *server);
+bool flushSpectator(struct Spectator *spectator);
+void dropSpectator(struct SpectatorServer *server, int index);
+void releaseFrame(struct SpectatorFrame *frame);
+
+#ifndef _WIN32
+/*
+    Starts letting spectators connect to the given address and watch the games published to it.
+
+    Parameter
+    ---------
+    `char *address`:
+        Either "unix:PATH", for a Unix socket at PATH, or "tcp:[HOST:]PORT", for a TCP socket listening on
+        PORT of HOST, or of every interface if HOST is not given.
+
+    Returns
+    -------
+    Returns the server, or `NULL` if it could not be started.
+*/
+struct SpectatorServer *openSpectatorServer(char *address)
+{
+    struct SpectatorServer *server = (struct SpectatorServer *) malloc(sizeof(struct SpectatorServer));
+
+    if (server == NULL)
+        return NULL;
+
+    server->listener = openListener(address, server->path);
+
+    if (server->listener == -1)
+    {
+        free(server);
+        return NULL;
+    }
+
+    if (pipe(server->wakeup) != 0)
+    {
+        close(server->listener);
+        free(server);
+        return NULL;
+    }
+
+    fcntl(server->listener, F_SETFL, O_NONBLOCK);
+    fcntl(server->wakeup[0], F_SETFL, O_NONBLOCK);
+    fcntl(server->wakeup[1], F_SETFL, O_NONBLOCK);
+
+    // a spectator leaving halfway through a write must not end the program
+    signal(SIGPIPE, SIG_IGN);
+
+    initMutex(&server->lock);
+    server->stopping = false;
+    server->latest = NULL;
+    server->count = 0;
+
+    if (!startThread(&server->thread, serveSpectators, server))
+    {
+        server->stopping = true;
+        closeSpectatorServer(server);
+        return NULL;
+    }
+
+    return server;
+}
+
+/*
+    Sends the current state of a game to everyone watching it. Does not wait on any spectator.
+
+    Parameters
+    ----------
+    `struct SpectatorServer *server`:
+        Server the game is watched on, nothing is done if `NULL`.
+
+    `struct Game *game`:
+        The game.
+
+    `int shooter`:
+        Player who made the last move (0 or 1), -1 if no move is to be shown.
+*/
+void publishGame(struct SpectatorServer *server, struct Game *game, int shooter)
+{
+    if (server == NULL)
+        return;
+
+    char text[SPECTATOR_FRAME_SIZE];
+    int length = encodeFrame(game, shooter, text);
+    struct SpectatorFrame *frame = (struct SpectatorFrame *) malloc(sizeof(struct SpectatorFrame) + length);
+
+    if (frame == NULL)
+        return;
+
+    frame->references = 1;
+    frame->length = length;
+    memcpy(frame->text, text, length);
+
+    lockMutex(&server->lock);
+
+    if (server->latest != NULL)
+        releaseFrame(server->latest);
+
+    server->latest = frame;
+
+    for (int i = 0; i < server->count; i++)
+    {
+        struct Spectator *spectator = &server->spectators[i];
+
+        if (spectator->count == SPECTATOR_QUEUE)
+        {
+            spectator->lagging = true;
+            continue;
+        }
+
+        spectator->queue[(spectator->first + spectator->count++) % SPECTATOR_QUEUE] = frame;
+        frame->references++;
+    }
+
+    unlockMutex(&server->lock);
+    wakeServer(server);
+}
+
+/*
+    Stops the server, disconnecting every spectator, and frees it.
+
+    Parameter
+    ---------
+    `struct SpectatorServer *server`:
+        The server to close, nothing is done if `NULL`.
+*/
+void closeSpectatorServer(struct SpectatorServer *server)
+{
+    if (server == NULL)
+        return;
+
+    lockMutex(&server->lock);
+    bool running = !server->stopping;
+    server->stopping = true;
+    unlockMutex(&server->lock);
+
+    if (running)
+    {
+        wakeServer(server);
+        joinThread(&server->thread);
+    }
+
+    while (server->count > 0)
+        dropSpectator(server, server->count - 1);
+
+    if (server->latest != NULL)
+        releaseFrame(server->latest);
+
+    close(server->listener);
+    close(server->wakeup[0]);
+    close(server->wakeup[1]);
+
+    if (server->path[0] != '\0')
+        unlink(server->path);
+
+    destroyMutex(&server->lock);
+    free(server);
+}
+
+/*
+    Wakes up the server's thread, so that it looks at the server again.
+
+    Parameter
+    ---------
+    `struct SpectatorServer *server`:
+        The server.
+*/
+void wakeServer(struct SpectatorServer *server)
+{
+    // a full pipe means the server's thread is already due to wake up, so a failed write needs no handling
+    if (write(server->wakeup[1], "", 1) < 0)
+        return;
+}
+
+/*
+    Opens a socket listening on the given address.
+
+    Parameters
+    ----------
+    `char *address`:
+        The address, see openSpectatorServer.
+
+    `char *path`:
+        Stores the path of the socket if it is a Unix socket, else an empty string. At least FILENAME_MAX
+        characters long.
+
+    Returns
+    -------
+    Returns the socket, -1 if it could not be opened.
+*/
+int openListener(char *address, char *path)
+{
+    int listener = -1;
+
+    path[0] = '\0';
+
+    if (strncmp(address, "unix:", 5) == 0)
+    {
+        struct sockaddr_un local = { .sun_family = AF_UNIX };
+        struct stat info;
+
+        if (strlen(address + 5) >= sizeof local.sun_path || strlen(address + 5) >= FILENAME_MAX)
+            return -1;
+
+        strcpy(local.sun_path, address + 5);
+
+        // a socket left behind by a program that did not close its server is taken over
+        if (stat(local.sun_path, &info) == 0 && S_ISSOCK(info.st_mode))
+            unlink(local.sun_path);
+
+        listener = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (listener != -1 && (bind(listener, (struct sockaddr *) &local, sizeof local) != 0 || listen(listener, SOMAXCONN) != 0))
+        {
+            close(listener);
+            return -1;
+        }
+
+        if (listener != -1)
+            strcpy(path, local.sun_path);
+    }
+    else if (strncmp(address, "tcp:", 4) == 0)
+    {
+        struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM, .ai_flags = AI_PASSIVE };
+        struct addrinfo *addresses;
+        char host[256] = "";
+        char *port = strrchr(address + 4, ':');
+
+        if (port == NULL)
+        {
+            port = address + 4;
+        }
+        else
+        {
+            if (port - (address + 4) >= (int) sizeof host)
+                return -1;
+
+            memcpy(host, address + 4, port - (address + 4));
+            host[port - (address + 4)] = '\0';
+            port++;
+        }
+
+        if (getaddrinfo(host[0] == '\0' ? NULL : host, port, &hints, &addresses) != 0)
+            return -1;
+
+        for (struct addrinfo *current = addresses; current != NULL && listener == -1; current = current->ai_next)
+        {
+            int reuse = 1;
+
+            listener = socket(current->ai_family, current->ai_socktype, current->ai_protocol);
+
+            if (listener == -1)
+                continue;
+
+            setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof reuse);
+
+            if (bind(listener, current->ai_addr, current->ai_addrlen) != 0 || listen(listener, SOMAXCONN) != 0)
+            {
+                close(listener);
+                listener = -1;
+            }
+        }
+
+        freeaddrinfo(addresses);
+    }
+
+    return listener;
+}
+
+/*
+    Runs the server, accepting spectators and sending them their queued frames, until it is closed. Runs on
+    its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The SpectatorServer to run.
+*/
+void *serveSpectators(void *argument)
+{
+    struct SpectatorServer *server = (struct SpectatorServer *) argument;
+    char discarded[256];
+
+    while (1) // breaks once the server is closed
+    {
+        int polled = 2;
+
+        lockMutex(&server->lock);
+
+        if (server->stopping)
+        {
+            unlockMutex(&server->lock);
+            break;
+        }
+
+        server->polls[0] = (struct pollfd) { .fd = server->wakeup[0], .events = POLLIN };
+        server->polls[1] = (struct pollfd) { .fd = server->listener, .events = POLLIN };
+
+        for (int i = 0; i < server->count; i++)
+        {
+            server->polls[polled++] = (struct pollfd) {
+                .fd = server->spectators[i].socket,
+                .events = POLLIN | (server->spectators[i].count > 0 ? POLLOUT : 0)
+            };
+        }
+
+        unlockMutex(&server->lock);
+
+        if (poll(server->polls, polled, -1) < 0 && errno != EINTR)
+            break;
+
+        lockMutex(&server->lock);
+
+        while (read(server->wakeup[0], discarded, sizeof discarded) > 0)
+            continue;
+
+        // spectators are only removed from here, so polls[i + 2] still belongs to spectators[i], and going
+        // backwards, the spectator moved into the place of a dropped one has already been looked at
+        for (int i = polled - 3; i >= 0; i--)
+        {
+            short events = server->polls[i + 2].revents;
+            bool dropped = (events & (POLLERR | POLLHUP | POLLNVAL)) != 0;
+
+            if (!dropped && (events & POLLIN)) // spectators have nothing to say, so reading only tells if they left
+            {
+                ssize_t received = read(server->spectators[i].socket, discarded, sizeof discarded);
+                dropped = received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+            }
+
+            if (dropped || server->spectators[i].lagging || !flushSpectator(&server->spectators[i]))
+                dropSpectator(server, i);
+        }
+
+        if (server->polls[1].revents & POLLIN)
+            acceptSpectators(server);
+
+        unlockMutex(&server->lock);
+    }
+
+    return NULL;
+}
+
+/*
+    Accepts every spectator waiting to connect, queueing the latest frame for each. Spectators beyond
+    SPECTATOR_MAX are disconnected right away. Must be called while holding the server's lock.
+
+    Parameter
+    ---------
+    `struct SpectatorServer *server`:
+        The server.
+*/
+void acceptSpectators(struct SpectatorServer *server)
+{
+    int connection;
+
+    while ((connection = accept(server->listener, NULL, NULL)) != -1)
+    {
+        if (server->count == SPECTATOR_MAX)
+        {
+            close(connection);
+            continue;
+        }
+
+        struct Spectator *spectator = &server->spectators[server->count++];
+
+        fcntl(connection, F_SETFL, O_NONBLOCK);
+        spectator->socket = connection;
+        spectator->first = 0;
+        spectator->count = 0;
+        spectator->offset = 0;
+        spectator->lagging = false;
+
+        if (server->latest != NULL)
+        {
+            spectator->queue[spectator->count++] = server->latest;
+            server->latest->references++;
+        }
+    }
+}
+
+/*
+    Writes as much of a spectator's queued frames as its socket takes without blocking, all at once.
+
+    Parameter
+    ---------
+    `struct Spectator *spectator`:
+        The spectator.
+
+    Returns
+    -------
+    Returns `false` if the spectator can no longer be written to, `true` otherwise.
+*/
+bool flushSpectator(struct Spectator *spectator)
+{
+    struct iovec vectors[SPECTATOR_QUEUE];
+
+    if (spectator->count == 0)
+        return true;
+
+    for (int i = 0; i < spectator->count; i++)
+    {
+        struct SpectatorFrame *frame = spectator->queue[(spectator->first + i) % SPECTATOR_QUEUE];
+        int skipped = i == 0 ? spectator->offset : 0;
+
+        vectors[i].iov_base = frame->text + skipped;
+        vectors[i].iov_len = frame->length - skipped;
+    }
+
+    ssize_t written = writev(spectator->socket, vectors, spectator->count);
+
+    if (written < 0)
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+
+    while (written > 0)
+    {
+        struct SpectatorFrame *frame = spectator->queue[spectator->first];
+
+        if (written < frame->length - spectator->offset)
+        {
+            spectator->offset += written;
+            break;
+        }
+
+        written -= frame->length - spectator->offset;
+        releaseFrame(frame);
+        spectator->first = (spectator->first + 1) % SPECTATOR_QUEUE;
+        spectator->count--;
+        spectator->offset = 0;
+    }
+
+    return true;
+}
+
+/*
+    Disconnects a spectator, moving the last spectator into its place. Must be called while holding the
+    server's lock, or once the server's thread has stopped.
+
+    Parameters
+    ----------
+    `struct SpectatorServer *server`:
+        The server.
+
+    `int index`:
+        Index of the spectator in server->spectators.
+*/
+void dropSpectator(struct SpectatorServer *server, int index)
+{
+    struct Spectator *spectator = &server->spectators[index];
+
+    close(spectator->socket);
+
+    for (int i = 0; i < spectator->count; i++)
+        releaseFrame(spectator->queue[(spectator->first + i) % SPECTATOR_QUEUE]);
+
+    server->spectators[index] = server->spectators[--server->count];
+}
+#else
+/*
+    Spectating needs POSIX sockets, so no server can be opened on Windows.
+*/
+struct SpectatorServer *openSpectatorServer(char *address)
+{
+    return NULL;
+}
+
+void publishGame(struct SpectatorServer *server, struct Game *game, int shooter)
+{
+}
+
+void closeSpectatorServer(struct SpectatorServer *server)
+{
+}
+#endif
+
+/*
+    Writes the text spectators are shown for the current state of a game.
+
+    Parameters
+    ----------
+    `struct Game *game`:
+        The game.
+
+    `int shooter`:
+        Player who made the last move (0 or 1), -1 if no move is to be shown.
+
+    `char *text`:
+        Stores the text, at least SPECTATOR_FRAME_SIZE characters long.
+
+    Returns
+    -------
+    Returns the length of the text.
+*/
+int encodeFrame(struct Game *game, int shooter, char *text)
+{
+    int length = 0;
+
+    // clears the spectator's terminal, so that every frame replaces the one before it
+    appendText(text, &length, "\033[H\033[2J%s vs %s\n", game->players[0].name, game->players[1].name);
+
+    for (int i = 0; i < 2; i++)
+    {
+        struct Player *opponent = &game->players[1 - i];
+        int sunk = 0;
+
+        appendText(text, &length, "\n%s's action board:\n", game->players[i].name);
+
+        if (length < SPECTATOR_FRAME_SIZE - 1)
+            length += formatBoard(game->players[i].actionBoard, text + length, SPECTATOR_FRAME_SIZE - length);
+
+        appendText(text, &length, "Ships sunk:");
+
+        for (int ship = 0; ship < SHIPS; ship++)
+        {
+            if (opponent->shipsHP[ship] == 0)
+                appendText(text, &length, "%s %s", sunk++ == 0 ? "" : ",", getShipName(ship));
+        }
+
+        appendText(text, &length, sunk == 0 ? " none\n" : "\n");
+    }
+
+    if (shooter != -1 && game->lastSalvo.shots > 0)
+    {
+        appendText(text, &length, "\nLast move: %s fired at", game->players[shooter].name);
+
+        for (int i = 0; i < game->lastSalvo.shots; i++)
+        {
+            int cell = game->lastSalvo.cells[i];
+
+            appendText(text, &length, "%s %c%d (%s", i == 0 ? "" : ",", 'A' + (cell % 10), (cell / 10) + 1,
+                game->lastSalvo.statuses[i] == 'H' ? "hit" : "miss");
+
+            if (game->lastSalvo.sunkShips[i] != '\0')
+                appendText(text, &length, ", sunk the %s", getShipName(getShipFromIcon(game->lastSalvo.sunkShips[i])));
+
+            appendText(text, &length, ")");
+        }
+
+        appendText(text, &length, "\n");
+
+        if (checkWin(&game->players[1 - shooter]))
+            appendText(text, &length, "%s wins!\n", game->players[shooter].name);
+    }
+
+    return length;
+}
+
+/*
+    Appends formatted text to a frame's text, the same way printf prints it. Text that does not fit in
+    SPECTATOR_FRAME_SIZE characters is dropped.
+
+    Parameters
+    ----------
+    `char *text`:
+        The text to append to.
+
+    `int *length`:
+        Length of the text, updated to the new length.
+
+    `char *format`:
+        Format string, as given to printf.
+*/
+void appendText(char *text, int *length, char *format, ...)
+{
+    va_list arguments;
+
+    if (*length >= SPECTATOR_FRAME_SIZE - 1)
+        return;
+
+    va_start(arguments, format);
+    int written = vsnprintf(text + *length, SPECTATOR_FRAME_SIZE - *length, format, arguments);
+    va_end(arguments);
+
+    if (written > 0)
+        *length = *length + written < SPECTATOR_FRAME_SIZE ? *length + written : SPECTATOR_FRAME_SIZE - 1;
+}
+
+/*
+    Drops one reference to a frame, freeing it once nothing refers to it.
+
+    Parameter
+    ---------
+    `struct SpectatorFrame *frame`:
+        The frame.
+*/
+void releaseFrame(struct SpectatorFrame *frame)
+{
+    if (--frame->references == 0)
+        free(frame);
+}
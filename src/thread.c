@@ -0,0 +1,299 @@
+/*
+
+File Name: thread.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to run work on multiple threads, using pthreads on Linux and the Windows API on Windows.
+
+    INCLUDES (user-defined)
+    -----------------------
+    thread.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool startThread(struct Thread *thread, void *(*function)(void *argument), void *argument)
+    2. void joinThread(struct Thread *thread)
+    3. void runShares(void *(*work)(void *task), void *tasks, size_t taskSize, int count)
+    4. int countProcessors(void)
+    5. void initMutex(struct Mutex *mutex)
+    6. void lockMutex(struct Mutex *mutex)
+    7. void unlockMutex(struct Mutex *mutex)
+    8. void destroyMutex(struct Mutex *mutex)
+    9. void initCondition(struct ConditionVariable *condition)
+    10. void waitCondition(struct ConditionVariable *condition, struct Mutex *mutex)
+    11. void signalCondition(struct ConditionVariable *condition)
+    12. void destroyCondition(struct ConditionVariable *condition)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+    #include <unistd.h>
+#endif
+
+#include <thread.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+/*
+    Runs the function of the given thread, matching the signature expected by CreateThread.
+*/
+static DWORD WINAPI runThread(LPVOID thread)
+{
+    ((struct Thread *) thread)->function(((struct Thread *) thread)->argument);
+    return 0;
+}
+#endif
+
+/*
+    Starts a thread which runs the given function.
+
+    Parameters
+    ----------
+    `struct Thread *thread`:
+        Stores the started thread. Must stay valid until the thread is joined.
+
+    `void *(*function)(void *argument)`:
+        Function to run.
+
+    `void *argument`:
+        Argument given to function.
+
+    Returns
+    -------
+    Returns `true` if the thread was started, else it returns `false`.
+*/
+bool startThread(struct Thread *thread, void *(*function)(void *argument), void *argument)
+{
+    thread->function = function;
+    thread->argument = argument;
+
+#ifdef _WIN32
+    thread->handle = CreateThread(NULL, 0, runThread, thread, 0, NULL);
+    return thread->handle != NULL;
+#else
+    return pthread_create(&thread->handle, NULL, function, argument) == 0;
+#endif
+}
+
+/*
+    Waits for the given thread to finish.
+
+    Parameter
+    ---------
+    `struct Thread *thread`:
+        A thread started by startThread.
+*/
+void joinThread(struct Thread *thread)
+{
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+/*
+    Runs a function on every task of an array, splitting the work between threads. The first task is run by the
+    calling thread, as is every task for which a thread could not be started, and every other task on a thread of
+    its own. Returns once every task is done.
+
+    Parameters
+    ----------
+    `void *(*work)(void *task)`:
+        Function to run on every task.
+
+    `void *tasks`:
+        The tasks, one after another.
+
+    `size_t taskSize`:
+        Size of every task, in bytes.
+
+    `int count`:
+        Number of tasks.
+*/
+void runShares(void *(*work)(void *task), void *tasks, size_t taskSize, int count)
+{
+    struct Thread *workers = count > 1 ? (struct Thread *) malloc((count - 1) * sizeof(struct Thread)) : NULL;
+    bool *started = count > 1 ? (bool *) calloc(count - 1, sizeof(bool)) : NULL;
+
+    for (int i = 1; i < count && workers != NULL && started != NULL; i++)
+        started[i - 1] = startThread(&workers[i - 1], work, (char *) tasks + i * taskSize);
+
+    if (count > 0)
+        work(tasks);
+
+    for (int i = 1; i < count; i++)
+    {
+        if (workers != NULL && started != NULL && started[i - 1])
+            joinThread(&workers[i - 1]);
+        else
+            work((char *) tasks + i * taskSize);
+    }
+
+    free(workers);
+    free(started);
+}
+
+/*
+    Returns the number of processors available, at least 1.
+*/
+int countProcessors()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return processors > 0 ? (int) processors : 1;
+#endif
+}
+
+/*
+    Sets up a mutex, which starts unlocked.
+
+    Parameter
+    ---------
+    `struct Mutex *mutex`:
+        The mutex to set up.
+*/
+void initMutex(struct Mutex *mutex)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_init(&mutex->handle, NULL);
+#endif
+}
+
+/*
+    Locks a mutex, waiting for as long as another thread holds it.
+
+    Parameter
+    ---------
+    `struct Mutex *mutex`:
+        The mutex to lock.
+*/
+void lockMutex(struct Mutex *mutex)
+{
+#ifdef _WIN32
+    EnterCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_lock(&mutex->handle);
+#endif
+}
+
+/*
+    Unlocks a mutex locked by this thread.
+
+    Parameter
+    ---------
+    `struct Mutex *mutex`:
+        The mutex to unlock.
+*/
+void unlockMutex(struct Mutex *mutex)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_unlock(&mutex->handle);
+#endif
+}
+
+/*
+    Frees what the operating system holds for a mutex, which must be unlocked.
+
+    Parameter
+    ---------
+    `struct Mutex *mutex`:
+        The mutex to destroy.
+*/
+void destroyMutex(struct Mutex *mutex)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(&mutex->handle);
+#else
+    pthread_mutex_destroy(&mutex->handle);
+#endif
+}
+
+/*
+    Sets up a condition, which no thread is waiting on.
+
+    Parameter
+    ---------
+    `struct ConditionVariable *condition`:
+        The condition to set up.
+*/
+void initCondition(struct ConditionVariable *condition)
+{
+#ifdef _WIN32
+    InitializeConditionVariable(&condition->handle);
+#else
+    pthread_cond_init(&condition->handle, NULL);
+#endif
+}
+
+/*
+    Unlocks a mutex held by this thread and waits until the given condition is signalled, locking the mutex again
+    before returning. As a thread may wake up without the condition having been signalled, whatever it waits for
+    has to be checked again once it returns.
+
+    Parameters
+    ----------
+    `struct ConditionVariable *condition`:
+        The condition to wait on.
+
+    `struct Mutex *mutex`:
+        The mutex guarding what the thread waits for, locked by this thread.
+*/
+void waitCondition(struct ConditionVariable *condition, struct Mutex *mutex)
+{
+#ifdef _WIN32
+    SleepConditionVariableCS(&condition->handle, &mutex->handle, INFINITE);
+#else
+    pthread_cond_wait(&condition->handle, &mutex->handle);
+#endif
+}
+
+/*
+    Wakes up every thread waiting on the given condition.
+
+    Parameter
+    ---------
+    `struct ConditionVariable *condition`:
+        The condition to signal.
+*/
+void signalCondition(struct ConditionVariable *condition)
+{
+#ifdef _WIN32
+    WakeAllConditionVariable(&condition->handle);
+#else
+    pthread_cond_broadcast(&condition->handle);
+#endif
+}
+
+/*
+    Frees what the operating system holds for a condition, which no thread may be waiting on.
+
+    Parameter
+    ---------
+    `struct ConditionVariable *condition`:
+        The condition to destroy.
+*/
+void destroyCondition(struct ConditionVariable *condition)
+{
+#ifdef _WIN32
+    (void) condition;
+#else
+    pthread_cond_destroy(&condition->handle);
+#endif
+}
@@ -0,0 +1,51 @@
+/*
+
+File Name: timing.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains functions to measure time with a clock that never jumps, unlike the time of day.
+
+    INCLUDES (user-defined)
+    -----------------------
+    timing.h
+
+    FUNCTIONS (global)
+    ------------------
+    1. long long monotonicMicroseconds(void)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #define _POSIX_C_SOURCE 200809L
+    #include <time.h>
+#endif
+
+#include <timing.h>
+
+/*
+    Returns the time in microseconds since an arbitrary point, only meant to be compared with other values
+    returned by this function.
+*/
+long long monotonicMicroseconds()
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (long long) (counter.QuadPart / frequency.QuadPart) * 1000000
+        + (long long) (counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (long long) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
@@ -0,0 +1,910 @@
+/*
+
+File Name: tournament.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the tournament, which plays games between two CPUs on several worker processes, so that a CPU that
+    crashes or hangs, such as a faulty strategy, takes down only the worker playing it and not the tournament.
+
+    The games are split into shards of consecutive game numbers, every game being played from a seed worked out
+    from its number, so that a shard comes to the same result whichever worker plays it and however often it is
+    played. The coordinator forks the workers, hands every idle worker the next shard over a pipe and reads
+    back a summary of it, the wins of both CPUs and how many shots every win took, which it adds to the totals
+    as soon as it comes. A worker that exits before finishing its shard, or takes more than
+    TOURNAMENT_SLOW_FACTOR times as long as shards have taken so far, is killed and forked again, and its shard
+    handed out again, up to TOURNAMENT_MAX_ATTEMPTS times before it is given up on. Workers and the coordinator
+    only share the shard and its summary, both fixed-size records, so that the workers could as well run on
+    other machines over sockets.
+
+    If a log is set, every worker holds back the games of a shard it plays, encoded, until it has sent back the
+    summary of the shard, then logs them on a writer thread of its own and flushes the log before taking the
+    next shard, so that the games of every shard counted are in the log once each. The games a worker played of
+    a shard it did not finish are never logged, as the shard is played again by the worker it is handed to next.
+
+    Workers are forked processes, so tournaments are not available on Windows.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. tournament.h
+    2. defence.h
+    3. expert.h
+    4. thread.h
+    5. timing.h
+    6. game_log.h
+
+    STRUCTS
+    -------
+    1. TournamentShard
+    2. TournamentAssignment
+    3. TournamentSummary
+    4. TournamentWorker
+    5. Tournament
+
+    FUNCTIONS (global)
+    ------------------
+    bool runTournament(long long games, char *sides[2], int workers, int shardGames, GameMode mode)
+
+    FUNCTIONS (local)
+    -----------------
+    1. bool startWorker(struct Tournament *tournament, int index)
+    2. void runWorker(struct Tournament *tournament, int input, int output)
+    3. int playSeededGame(struct Tournament *tournament, unsigned long long seed, int first, int *shots)
+    4. void holdRecord(struct Tournament *tournament)
+    5. void assignShards(struct Tournament *tournament)
+    6. void readSummaries(struct Tournament *tournament)
+    7. void failWorker(struct Tournament *tournament, int index, char *reason)
+    8. bool mergeSummary(struct Tournament *tournament, struct TournamentSummary *summary)
+    9. long long shardTimeout(struct Tournament *tournament)
+    10. void printStandings(struct Tournament *tournament, double seconds)
+
+*Compiled using C99 standards*
+
+*/
+
+#ifndef _WIN32
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <tournament.h>
+#include <defence.h>
+#include <expert.h>
+#include <thread.h>
+#include <timing.h>
+#include <game_log.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <unistd.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+#endif
+
+/*
+    TournamentShard struct, contains a range of games played by one worker. Contains:
+    - long long first: number of the first game.
+    - int games: number of games.
+    - int attempts: number of times the shard has been handed out.
+    - char state: 'W' if waiting to be handed out, 'P' if being played, 'D' if done, 'G' if given up on.
+*/
+struct TournamentShard {
+    long long first;
+    int games;
+    int attempts;
+    char state;
+};
+
+/*
+    TournamentAssignment struct, contains a shard as sent to a worker. Contains:
+    - int shard: index of the shard.
+    - long long first: number of the first game of the shard.
+    - int games: number of games of the shard.
+*/
+struct TournamentAssignment {
+    int shard;
+    long long first;
+    int games;
+};
+
+/*
+    TournamentSummary struct, contains the result of a shard as sent back by a worker, or the totals of all the
+    shards done. Contains:
+    - int shard: index of the shard.
+    - int games: number of games played.
+    - int wins[2]: number of games won by each CPU.
+    - unsigned int histogram[2][TOURNAMENT_BINS]: number of wins of each CPU that took each number of shots.
+*/
+struct TournamentSummary {
+    int shard;
+    int games;
+    int wins[2];
+    unsigned int histogram[2][TOURNAMENT_BINS];
+};
+
+/*
+    TournamentWorker struct, contains a worker process. Contains:
+    - long pid: process ID of the worker.
+    - int input: pipe to the worker, which shards are sent through.
+    - int output: pipe from the worker, which never blocks and which summaries come back through.
+    - bool running: whether the worker is running.
+    - int shard: shard being played by the worker, -1 if none.
+    - long long started: time, as given by monotonicMicroseconds, the shard was handed out at.
+    - struct TournamentSummary summary: summary being read from the worker.
+    - size_t received: number of bytes of summary read so far.
+*/
+struct TournamentWorker {
+    long pid;
+    int input;
+    int output;
+    bool running;
+    int shard;
+    long long started;
+    struct TournamentSummary summary;
+    size_t received;
+};
+
+/*
+    Tournament struct, contains everything the coordinator keeps track of. Contains:
+    - Difficulty difficulties[2]: difficulties of the CPUs.
+    - const struct Strategy *strategies[2]: strategies of the CPUs on plugin difficulty.
+    - char *names[2]: names of the CPUs, as given on the command line.
+    - GameMode mode: rules the games are played with.
+    - unsigned long long seed: number the seed of every game is worked out from.
+    - struct TournamentShard *shards: the shards.
+    - int shardCount: number of shards.
+    - int done: number of shards done.
+    - int givenUp: number of shards given up on.
+    - struct TournamentWorker workers[TOURNAMENT_MAX_WORKERS]: the workers.
+    - int workerCount: number of workers.
+    - int threads: number of threads the expert CPU may think on in every worker.
+    - int restarts: number of times a worker was forked again.
+    - long long shardTime: total time, in microseconds, the shards done took.
+    - struct TournamentSummary totals: the results of the shards done, added up.
+    - struct LogStage *stage: stage the games are logged into in a worker, NULL if they are not logged.
+    - struct GameRecord *record: record of the game being played in a worker, when the games are logged.
+    - unsigned char *held: the games of the shard being played in a worker, encoded one after another, held back
+      from the log until the summary of the shard is sent.
+    - size_t heldSize: number of bytes of held used.
+    - size_t heldCapacity: number of bytes there is room for in held.
+    - size_t *heldEnds: where every game in held ends, as many as there are games in the shard.
+    - int heldCount: number of games in held.
+*/
+struct Tournament {
+    Difficulty difficulties[2];
+    const struct Strategy *strategies[2];
+    char *names[2];
+    GameMode mode;
+    unsigned long long seed;
+    struct TournamentShard *shards;
+    int shardCount;
+    int done;
+    int givenUp;
+    struct TournamentWorker workers[TOURNAMENT_MAX_WORKERS];
+    int workerCount;
+    int threads;
+    int restarts;
+    long long shardTime;
+    struct TournamentSummary totals;
+    struct LogStage *stage;
+    struct GameRecord *record;
+    unsigned char *held;
+    size_t heldSize;
+    size_t heldCapacity;
+    size_t *heldEnds;
+    int heldCount;
+};
+
+bool startWorker(struct Tournament *tournament, int index);
+void runWorker(struct Tournament *tournament, int input, int output);
+int playSeededGame(struct Tournament *tournament, unsigned long long seed, int first, int *shots);
+void holdRecord(struct Tournament *tournament);
+void assignShards(struct Tournament *tournament);
+void readSummaries(struct Tournament *tournament);
+void failWorker(struct Tournament *tournament, int index, char *reason);
+bool mergeSummary(struct Tournament *tournament, struct TournamentSummary *summary);
+long long shardTimeout(struct Tournament *tournament);
+void printStandings(struct Tournament *tournament, double seconds);
+
+/*
+    Plays games between two CPUs on worker processes and prints how each of them did. See the top of this file
+    for how.
+
+    Parameters
+    ----------
+    `long long games`:
+        Number of games to play.
+
+    `char *sides[2]`:
+        The CPUs, each easy, hard, expert, policy or plugin:NAME.
+
+    `int workers`:
+        Number of worker processes, at most TOURNAMENT_MAX_WORKERS.
+
+    `int shardGames`:
+        Number of games in a shard.
+
+    `GameMode mode`:
+        Rules the games are played with.
+
+    Returns
+    -------
+    Returns `true` if the games were played, even if some shards were given up on, else it returns `false`.
+*/
+bool runTournament(long long games, char *sides[2], int workers, int shardGames, GameMode mode)
+{
+#ifdef _WIN32
+    (void) games;
+    (void) sides;
+    (void) workers;
+    (void) shardGames;
+    (void) mode;
+    printf("Tournaments are not available on Windows.\n");
+    return false;
+#else
+    struct Tournament tournament = { .mode = mode };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (!parseCPU(sides[i], &tournament.difficulties[i], &tournament.strategies[i]))
+        {
+            printf("Unknown CPU \"%s\", expected easy, hard, expert, policy or plugin:NAME.\n", sides[i]);
+            return false;
+        }
+
+        tournament.names[i] = sides[i];
+    }
+
+    // opened here only to find out before any worker is forked whether it can be, as every worker opens its own
+    if (getLogPath() != NULL)
+    {
+        struct GameLog *gameLog = openGameLog();
+
+        if (gameLog == NULL || !closeGameLog(gameLog))
+            return false;
+    }
+
+    shardGames = shardGames < 1 ? 1 : shardGames;
+    tournament.shardCount = (int) ((games + shardGames - 1) / shardGames);
+    tournament.shards = (struct TournamentShard *) calloc(tournament.shardCount, sizeof(struct TournamentShard));
+
+    if (tournament.shards == NULL)
+    {
+        printf("Could not allocate memory for the tournament.\n");
+        return false;
+    }
+
+    for (int i = 0; i < tournament.shardCount; i++)
+    {
+        tournament.shards[i].first = (long long) i * shardGames;
+        tournament.shards[i].games = (int) (games - tournament.shards[i].first < shardGames ? games - tournament.shards[i].first : shardGames);
+        tournament.shards[i].state = 'W';
+    }
+
+    workers = workers < tournament.shardCount ? workers : tournament.shardCount;
+    tournament.workerCount = workers > TOURNAMENT_MAX_WORKERS ? TOURNAMENT_MAX_WORKERS : (workers < 1 ? 1 : workers);
+    tournament.threads = countProcessors() / tournament.workerCount > 1 ? countProcessors() / tournament.workerCount : 1;
+    tournament.seed = randomSeed();
+
+    initPlacements();
+    signal(SIGPIPE, SIG_IGN); // a worker that exits is noticed when reading from it instead
+
+    for (int i = 0; i < tournament.workerCount; i++)
+        tournament.workers[i].shard = -1;
+
+    for (int i = 0; i < tournament.workerCount; i++)
+        startWorker(&tournament, i);
+
+    long long start = monotonicMicroseconds();
+    bool running = true;
+
+    while (running && tournament.done + tournament.givenUp < tournament.shardCount)
+    {
+        assignShards(&tournament);
+        running = false;
+
+        for (int i = 0; i < tournament.workerCount; i++)
+            running = running || tournament.workers[i].running;
+
+        if (running)
+            readSummaries(&tournament);
+        else
+            printf("No worker could be started.\n");
+    }
+
+    // workers leave once the pipe they read their shards from is closed
+    for (int i = 0; i < tournament.workerCount; i++)
+    {
+        if (!tournament.workers[i].running)
+            continue;
+
+        close(tournament.workers[i].input);
+        close(tournament.workers[i].output);
+        waitpid((pid_t) tournament.workers[i].pid, NULL, 0);
+    }
+
+    printStandings(&tournament, (monotonicMicroseconds() - start) / 1e6);
+    free(tournament.shards);
+
+    return running;
+#endif
+}
+
+#ifndef _WIN32
+
+/*
+    Forks a worker.
+
+    Parameters
+    ----------
+    `struct Tournament *tournament`:
+        The tournament.
+
+    `int index`:
+        Index of the worker, which is not running.
+
+    Returns
+    -------
+    Returns `true` if the worker was started, else it returns `false`.
+*/
+bool startWorker(struct Tournament *tournament, int index)
+{
+    struct TournamentWorker *worker = &tournament->workers[index];
+    int toWorker[2], fromWorker[2];
+
+    if (pipe(toWorker) != 0)
+        return false;
+
+    if (pipe(fromWorker) != 0)
+    {
+        close(toWorker[0]);
+        close(toWorker[1]);
+        return false;
+    }
+
+    fflush(stdout); // or the child would print whatever the coordinator has not printed yet again
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        // no worker may hold on to the pipes of another, or they would stay open after the other exits
+        for (int i = 0; i < tournament->workerCount; i++)
+        {
+            if (tournament->workers[i].running)
+            {
+                close(tournament->workers[i].input);
+                close(tournament->workers[i].output);
+            }
+        }
+
+        close(toWorker[1]);
+        close(fromWorker[0]);
+
+        // the log is opened after forking, as the writer thread of the coordinator would not be forked with it
+        struct GameLog *gameLog = getLogPath() != NULL ? openGameLog() : NULL;
+
+        tournament->record = gameLog != NULL ? (struct GameRecord *) malloc(sizeof(struct GameRecord)) : NULL;
+        tournament->stage = tournament->record != NULL ? openLogStage(gameLog) : NULL;
+        runWorker(tournament, toWorker[0], fromWorker[1]);
+
+        if (tournament->stage != NULL)
+            closeLogStage(tournament->stage);
+
+        if (gameLog != NULL && !closeGameLog(gameLog))
+            printf("Could not write every game to %s.\n", getLogPath());
+
+        free(tournament->record);
+        free(tournament->held);
+        free(tournament->heldEnds);
+        fflush(stdout);
+        _exit(0);
+    }
+
+    close(toWorker[0]);
+    close(fromWorker[1]);
+
+    if (pid < 0)
+    {
+        close(toWorker[1]);
+        close(fromWorker[0]);
+        return false;
+    }
+
+    fcntl(fromWorker[0], F_SETFL, fcntl(fromWorker[0], F_GETFL) | O_NONBLOCK);
+    worker->pid = (long) pid;
+    worker->input = toWorker[1];
+    worker->output = fromWorker[0];
+    worker->running = true;
+    worker->shard = -1;
+    worker->received = 0;
+
+    return true;
+}
+
+/*
+    Plays the shards handed to a worker until the pipe they come through is closed. Runs in the worker.
+
+    Parameters
+    ----------
+    `struct Tournament *tournament`:
+        The tournament, as it was when the worker was forked.
+
+    `int input`:
+        Pipe the shards come through.
+
+    `int output`:
+        Pipe the summaries are sent back through.
+*/
+void runWorker(struct Tournament *tournament, int input, int output)
+{
+    struct TournamentAssignment assignment;
+
+    while (true)
+    {
+        struct TournamentSummary summary;
+        size_t received = 0, sent = 0;
+
+        while (received < sizeof assignment)
+        {
+            ssize_t count = read(input, (char *) &assignment + received, sizeof assignment - received);
+
+            if (count <= 0 && !(count < 0 && errno == EINTR))
+                return;
+
+            received += count > 0 ? count : 0;
+        }
+
+        memset(&summary, 0, sizeof summary);
+        summary.shard = assignment.shard;
+        tournament->heldSize = 0;
+        tournament->heldCount = 0;
+
+        if (tournament->stage != NULL)
+        {
+            size_t *ends = (size_t *) realloc(tournament->heldEnds, (assignment.games + 1) * sizeof(size_t));
+
+            // without it, games are logged as soon as they are played, as holdRecord has nowhere to hold them
+            if (ends == NULL)
+                free(tournament->heldEnds);
+
+            tournament->heldEnds = ends;
+        }
+
+        for (int i = 0; i < assignment.games; i++)
+        {
+            long long game = assignment.first + i;
+            int shots, winner = playSeededGame(tournament, tournament->seed ^ ((unsigned long long) (game + 1) * 0x9E3779B97F4A7C15ULL), (int) (game % 2), &shots);
+
+            summary.wins[winner]++;
+            summary.histogram[winner][shots < TOURNAMENT_BINS ? shots : TOURNAMENT_BINS - 1]++;
+            summary.games++;
+        }
+
+        while (sent < sizeof summary)
+        {
+            ssize_t count = write(output, (char *) &summary + sent, sizeof summary - sent);
+
+            if (count <= 0 && !(count < 0 && errno == EINTR))
+                return;
+
+            sent += count > 0 ? count : 0;
+        }
+
+        if (tournament->stage != NULL)
+        {
+            for (int i = 0; i < tournament->heldCount; i++)
+            {
+                size_t start = i > 0 ? tournament->heldEnds[i - 1] : 0;
+
+                logEncodedGame(tournament->stage, tournament->held + start, tournament->heldEnds[i] - start);
+            }
+
+            flushLogStage(tournament->stage);
+        }
+    }
+}
+
+/*
+    Plays one game between the two CPUs, every random choice of which comes from its seed.
+
+    Parameters
+    ----------
+    `struct Tournament *tournament`:
+        The tournament.
+
+    `unsigned long long seed`:
+        Seed of the game.
+
+    `int first`:
+        CPU moving first.
+
+    `int *shots`:
+        Stores the number of shots the winner took.
+
+    Returns
+    -------
+    Returns the CPU that won.
+*/
+int playSeededGame(struct Tournament *tournament, unsigned long long seed, int first, int *shots)
+{
+    struct Player players[2];
+    struct CPUState cpus[2];
+    struct Random random;
+    int turn = first, fired[2] = { 0, 0 };
+
+    seedRandom(&random, seed);
+
+    for (int i = 0; i < 2; i++)
+    {
+        unsigned char fleet[SHIPS];
+
+        resetPlayer(&players[i]);
+        initCPUState(&cpus[i], i, tournament->difficulties[i], nextSeed(&random));
+        cpus[i].strategy = tournament->strategies[i];
+
+        if (tournament->difficulties[i] == EXPERT)
+        {
+            // created here rather than on its first shot, so that it thinks on its share of threads
+            if ((cpus[i].expert = createExpert(nextSeed(&random))) != NULL)
+                cpus[i].expert->threads = tournament->threads;
+
+            placeShipsExpert(&players[i], tournament->threads, monotonicMicroseconds() + getCPUBudget() * 1000LL);
+            continue;
+        }
+
+        drawFleet(&random, fleet);
+        placeFleet(&players[i], fleet);
+    }
+
+    if (tournament->stage != NULL)
+    {
+        snprintf(players[0].name, MAX_SIZE, "%s", tournament->names[0]);
+        snprintf(players[1].name, MAX_SIZE, "%s", tournament->names[1]);
+        beginPlayersRecord(tournament->record, tournament->mode, players, false);
+    }
+
+    while (true)
+    {
+        int left = countUnguessedCells(&players[turn].unguessed, -1);
+        int count = tournament->mode == SALVO ? countShipsLeft(&players[turn]) : 1;
+        struct SalvoResult result;
+
+        count = count < left ? count : left;
+
+        bool won = playCPUSalvo(&cpus[turn], &players[turn], &players[1 - turn], count, &result);
+
+        fired[turn] += result.shots;
+
+        if (tournament->stage != NULL)
+            recordSalvo(tournament->record, turn, &result);
+
+        if (won)
+            break;
+
+        turn = 1 - turn;
+    }
+
+    if (tournament->stage != NULL)
+    {
+        finishRecord(tournament->record, turn);
+        holdRecord(tournament);
+    }
+
+    resetCPUVariables(&cpus[0]);
+    resetCPUVariables(&cpus[1]);
+    *shots = fired[turn];
+
+    return turn;
+}
+
+/*
+    Encodes the record of the game just played into the games held back from the log until the summary of the
+    shard is sent. Runs in the worker.
+
+    Parameter
+    ---------
+    `struct Tournament *tournament`:
+        The tournament.
+*/
+void holdRecord(struct Tournament *tournament)
+{
+    if (tournament->heldCapacity - tournament->heldSize < MAX_RECORD_BYTES && tournament->heldEnds != NULL)
+    {
+        size_t capacity = 2 * tournament->heldCapacity + MAX_RECORD_BYTES;
+        unsigned char *held = (unsigned char *) realloc(tournament->held, capacity);
+
+        if (held != NULL)
+        {
+            tournament->held = held;
+            tournament->heldCapacity = capacity;
+        }
+    }
+
+    // with no room to hold it back, the game is logged straight away, and is logged again if the shard is replayed
+    if (tournament->heldCapacity - tournament->heldSize < MAX_RECORD_BYTES || tournament->heldEnds == NULL)
+    {
+        logGame(tournament->stage, tournament->record);
+        return;
+    }
+
+    tournament->heldSize += encodeRecord(tournament->record, tournament->held + tournament->heldSize);
+    tournament->heldEnds[tournament->heldCount++] = tournament->heldSize;
+}
+
+/*
+    Hands the shards waiting to be played to the idle workers, forking workers that are not running again.
+
+    Parameter
+    ---------
+    `struct Tournament *tournament`:
+        The tournament.
+*/
+void assignShards(struct Tournament *tournament)
+{
+    int next = 0;
+
+    for (int i = 0; i < tournament->workerCount; i++)
+    {
+        struct TournamentWorker *worker = &tournament->workers[i];
+
+        while (next < tournament->shardCount && tournament->shards[next].state != 'W')
+            next++;
+
+        if (next == tournament->shardCount)
+            return;
+
+        if (worker->shard != -1)
+            continue;
+
+        if (!worker->running && startWorker(tournament, i))
+            tournament->restarts++;
+
+        if (!worker->running)
+            continue;
+
+        struct TournamentShard *shard = &tournament->shards[next];
+        struct TournamentAssignment assignment = { next, shard->first, shard->games };
+
+        // an assignment is far smaller than PIPE_BUF, so it is written whole or not at all
+        if (write(worker->input, &assignment, sizeof assignment) != (ssize_t) sizeof assignment)
+        {
+            failWorker(tournament, i, "could not be sent a shard");
+            continue;
+        }
+
+        shard->state = 'P';
+        shard->attempts++;
+        worker->shard = next;
+        worker->started = monotonicMicroseconds();
+        worker->received = 0;
+    }
+}
+
+/*
+    Waits until a worker playing a shard sends something, or until the first of their deadlines, and handles
+    what the workers sent, failing those that exited or are late.
+
+    Parameter
+    ---------
+    `struct Tournament *tournament`:
+        The tournament.
+*/
+void readSummaries(struct Tournament *tournament)
+{
+    struct pollfd descriptors[TOURNAMENT_MAX_WORKERS];
+    int indices[TOURNAMENT_MAX_WORKERS], count = 0;
+    long long now = monotonicMicroseconds(), timeout = shardTimeout(tournament), wait = 1000;
+
+    for (int i = 0; i < tournament->workerCount; i++)
+    {
+        struct TournamentWorker *worker = &tournament->workers[i];
+
+        if (!worker->running || worker->shard == -1)
+            continue;
+
+        long long left = (worker->started + timeout - now) / 1000;
+
+        wait = left < wait ? (left > 0 ? left : 0) : wait;
+        descriptors[count].fd = worker->output;
+        descriptors[count].events = POLLIN;
+        indices[count++] = i;
+    }
+
+    if (count == 0)
+        return;
+
+    poll(descriptors, count, (int) wait);
+
+    for (int i = 0; i < count; i++)
+    {
+        struct TournamentWorker *worker = &tournament->workers[indices[i]];
+        ssize_t bytes = 0;
+
+        if (descriptors[i].revents != 0)
+        {
+            bytes = read(worker->output, (char *) &worker->summary + worker->received, sizeof worker->summary - worker->received);
+
+            if (bytes == 0 || (bytes < 0 && errno != EAGAIN && errno != EINTR))
+            {
+                failWorker(tournament, indices[i], "exited");
+                continue;
+            }
+        }
+
+        worker->received += bytes > 0 ? bytes : 0;
+
+        if (worker->received == sizeof worker->summary && worker->summary.shard != worker->shard)
+        {
+            failWorker(tournament, indices[i], "sent the summary of another shard");
+        }
+        else if (worker->received == sizeof worker->summary)
+        {
+            long long took = monotonicMicroseconds() - worker->started;
+
+            if (!mergeSummary(tournament, &worker->summary))
+            {
+                failWorker(tournament, indices[i], "sent a summary that does not add up");
+                continue;
+            }
+
+            tournament->shardTime += took;
+            worker->shard = -1;
+            worker->received = 0;
+        }
+        else if (monotonicMicroseconds() > worker->started + timeout)
+        {
+            failWorker(tournament, indices[i], "took too long");
+        }
+    }
+}
+
+/*
+    Kills a worker that exited or is late and hands its shard out again, or gives up on the shard if it has been
+    handed out TOURNAMENT_MAX_ATTEMPTS times. The worker is forked again the next time a shard is handed out.
+
+    Parameters
+    ----------
+    `struct Tournament *tournament`:
+        The tournament.
+
+    `int index`:
+        Index of the worker.
+
+    `char *reason`:
+        Why the worker failed, printed after the number of its shard.
+*/
+void failWorker(struct Tournament *tournament, int index, char *reason)
+{
+    struct TournamentWorker *worker = &tournament->workers[index];
+
+    kill((pid_t) worker->pid, SIGKILL);
+    waitpid((pid_t) worker->pid, NULL, 0);
+    close(worker->input);
+    close(worker->output);
+    worker->running = false;
+
+    if (worker->shard == -1)
+        return;
+
+    struct TournamentShard *shard = &tournament->shards[worker->shard];
+
+    shard->state = shard->attempts < TOURNAMENT_MAX_ATTEMPTS ? 'W' : 'G';
+
+    if (shard->state == 'G')
+        tournament->givenUp++;
+
+    printf("Worker playing shard %d %s, %s.\n", worker->shard, reason,
+           shard->state == 'W' ? "handing it out again" : "giving up on it");
+    worker->shard = -1;
+}
+
+/*
+    Adds the summary of a shard to the totals.
+
+    Parameters
+    ----------
+    `struct Tournament *tournament`:
+        The tournament.
+
+    `struct TournamentSummary *summary`:
+        The summary, as sent by a worker.
+
+    Returns
+    -------
+    Returns `true` if the summary was added, `false` if it does not match the shard being played.
+*/
+bool mergeSummary(struct Tournament *tournament, struct TournamentSummary *summary)
+{
+    int tenths = (tournament->done * 10) / tournament->shardCount;
+
+    if (summary->shard < 0 || summary->shard >= tournament->shardCount)
+        return false;
+
+    struct TournamentShard *shard = &tournament->shards[summary->shard];
+
+    if (shard->state != 'P' || summary->games != shard->games || summary->wins[0] + summary->wins[1] != shard->games)
+        return false;
+
+    shard->state = 'D';
+    tournament->done++;
+    tournament->totals.games += summary->games;
+
+    for (int i = 0; i < 2; i++)
+    {
+        tournament->totals.wins[i] += summary->wins[i];
+
+        for (int j = 0; j < TOURNAMENT_BINS; j++)
+            tournament->totals.histogram[i][j] += summary->histogram[i][j];
+    }
+
+    if ((tournament->done * 10) / tournament->shardCount != tenths)
+        printf("%d of %d shards done, %d games, %s %.1f%%\n", tournament->done, tournament->shardCount, tournament->totals.games,
+               tournament->names[0], 100.0 * tournament->totals.wins[0] / tournament->totals.games);
+
+    return true;
+}
+
+/*
+    Returns the time, in microseconds, a worker has to finish a shard, TOURNAMENT_SLOW_FACTOR times as long as
+    the shards done have taken on average.
+*/
+long long shardTimeout(struct Tournament *tournament)
+{
+    if (tournament->done == 0)
+        return TOURNAMENT_FIRST_TIMEOUT_MS * 1000LL;
+
+    long long timeout = TOURNAMENT_SLOW_FACTOR * tournament->shardTime / tournament->done;
+
+    return timeout > TOURNAMENT_MIN_TIMEOUT_MS * 1000LL ? timeout : TOURNAMENT_MIN_TIMEOUT_MS * 1000LL;
+}
+
+/*
+    Prints how each CPU did in the shards done.
+
+    Parameters
+    ----------
+    `struct Tournament *tournament`:
+        The tournament.
+
+    `double seconds`:
+        Time the games took.
+*/
+void printStandings(struct Tournament *tournament, double seconds)
+{
+    struct TournamentSummary *totals = &tournament->totals;
+
+    printf("\n%d %s games played in %.2f s (%.1f games/s) on %d workers, %d restarted, %d of %d shards given up on.\n",
+           totals->games, tournament->mode == SALVO ? "salvo" : "classic", seconds, seconds > 0 ? totals->games / seconds : 0.0,
+           tournament->workerCount, tournament->restarts, tournament->givenUp, tournament->shardCount);
+
+    for (int i = 0; i < 2; i++)
+    {
+        int median = -1, high = -1;
+        unsigned int seen = 0;
+        long long shots = 0;
+
+        // the median and the 90th percentile are read off the histogram
+        for (int j = 0; j < TOURNAMENT_BINS; j++)
+        {
+            seen += totals->histogram[i][j];
+            shots += (long long) j * totals->histogram[i][j];
+            median = median == -1 && seen * 2 >= (unsigned int) totals->wins[i] && seen > 0 ? j : median;
+            high = high == -1 && seen * 10 >= (unsigned int) totals->wins[i] * 9 && seen > 0 ? j : high;
+        }
+
+        printf("%-32s %7d wins (%5.1f%%)  ", tournament->names[i], totals->wins[i],
+               totals->games > 0 ? 100.0 * totals->wins[i] / totals->games : 0.0);
+
+        if (totals->wins[i] > 0)
+            printf("%.1f shots per win, median %d, 90th percentile %d\n", (double) shots / totals->wins[i], median, high);
+        else
+            printf("no wins\n");
+    }
+}
+
+#endif
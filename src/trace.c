@@ -0,0 +1,306 @@
+/*
+
+File Name: trace.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the tracer, which keeps a timeline of what every thread of the program was doing (placing ships,
+    choosing the CPU's moves, drawing the game and waiting on input) and writes it as Chrome trace-event JSON
+    when the program exits, which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+
+    Spans are marked with TRACE_BEGIN and TRACE_END, and single points in time with TRACE_MARK. When tracing is
+    off, each of them costs a single test of _tracing. When it is on, every thread writes its events into a
+    ring buffer of its own, holding the last TRACE_RING_EVENTS events, so that no lock is taken but for the
+    first event of every thread, which claims the thread's ring. A long session keeps only its latest events,
+    and the end of a span whose beginning was overwritten is left out of the trace.
+
+    A thread gives its ring back when it exits, through the destructor of a thread-specific key, and the next
+    thread to claim a ring takes one given back before a new one is allocated. Matches, tuning and the expert
+    CPU start new threads for every batch, round or move, so rings are only ever allocated for as many threads
+    as run at once, and a ring holds the events of every thread that used it one after the other, each ring
+    being shown as a thread of its own in the trace.
+
+    Events are timed with monotonicMicroseconds, from when tracing started. Worker processes forked by a
+    tournament leave without exiting normally, so only the events of the process tracing was started in are
+    written.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. trace.h
+    2. thread.h
+    3. timing.h
+
+    GLOBAL VARIABLES
+    ----------------
+    1. bool _tracing
+    2. FILE *_traceFile
+    3. long long _traceStart
+    4. struct Mutex _traceMutex
+    5. struct TraceRing *_traceRings[TRACE_MAX_THREADS]
+    6. int _traceRingCount
+    7. struct TraceRing *_traceFreeRings
+    8. pthread_key_t _traceRingKey (DWORD on Windows)
+    9. struct TraceRing *_traceRing
+    10. bool _traceRingClaimed
+
+    STRUCTS
+    -------
+    1. TraceEvent
+    2. TraceRing
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool startTrace(char *path)
+    2. void traceEvent(char phase, const char *name)
+
+    FUNCTIONS (local)
+    -----------------
+    1. struct TraceRing *claimTraceRing(void)
+    2. void releaseTraceRing(void *ring)
+    3. void finishTrace(void)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <trace.h>
+#include <thread.h>
+#include <timing.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+/*
+    TraceEvent struct, contains a single event. Contains:
+    - const char *name: name of the span or point, a string literal.
+    - long long time: when it happened, in microseconds since tracing started.
+    - char phase: 'B' for the beginning of a span, 'E' for its end and 'i' for a point.
+*/
+struct TraceEvent {
+    const char *name;
+    long long time;
+    char phase;
+};
+
+/*
+    TraceRing struct, contains the events of a single thread. Contains:
+    - struct TraceEvent events[TRACE_RING_EVENTS]: the latest events, event n being at n % TRACE_RING_EVENTS.
+    - unsigned long long written: number of events the threads using the ring have written.
+    - struct TraceRing *nextFree: ring given back before this one, while the ring is free.
+*/
+struct TraceRing {
+    struct TraceEvent events[TRACE_RING_EVENTS];
+    unsigned long long written;
+    struct TraceRing *nextFree;
+};
+
+// stores whether events are being traced
+bool _tracing = false;
+// stores the file the trace is written to when the program exits
+FILE *_traceFile = NULL;
+// stores the time tracing started, as given by monotonicMicroseconds
+long long _traceStart = 0;
+// guards _traceRings, _traceRingCount and _traceFreeRings
+struct Mutex _traceMutex;
+// stores every ring allocated, the index of a ring being its thread's ID in the trace
+struct TraceRing *_traceRings[TRACE_MAX_THREADS];
+// stores the number of rings in _traceRings
+int _traceRingCount = 0;
+// stores the rings given back by threads which have exited, linked through nextFree
+struct TraceRing *_traceFreeRings = NULL;
+// stores the key whose destructor gives a thread's ring back when the thread exits
+#ifdef _WIN32
+    DWORD _traceRingKey;
+#else
+    pthread_key_t _traceRingKey;
+#endif
+// stores the ring of the calling thread, NULL until its first event (__thread being supported by every compiler the program is built with)
+__thread struct TraceRing *_traceRing = NULL;
+// stores whether the calling thread has tried to claim a ring, so that a thread left without one does not try again
+__thread bool _traceRingClaimed = false;
+
+struct TraceRing *claimTraceRing(void);
+#ifdef _WIN32
+    void WINAPI releaseTraceRing(void *ring);
+#else
+    void releaseTraceRing(void *ring);
+#endif
+void finishTrace(void);
+
+/*
+    Starts tracing the events of every thread, to be written to the given file when the program exits.
+
+    Parameter
+    ---------
+    `char *path`:
+        The file to write the trace to.
+
+    Returns
+    -------
+    Returns `true` if tracing was started, or `false` if the file could not be opened or tracing was already
+    started.
+*/
+bool startTrace(char *path)
+{
+    if (_tracing)
+        return false;
+
+    _traceFile = fopen(path, "w");
+
+    if (_traceFile == NULL)
+        return false;
+
+#ifdef _WIN32
+    if ((_traceRingKey = FlsAlloc(releaseTraceRing)) == FLS_OUT_OF_INDEXES)
+#else
+    if (pthread_key_create(&_traceRingKey, releaseTraceRing) != 0)
+#endif
+    {
+        fclose(_traceFile);
+        return false;
+    }
+
+    initMutex(&_traceMutex);
+    _traceStart = monotonicMicroseconds();
+    _tracing = true;
+    atexit(finishTrace);
+
+    return true;
+}
+
+/*
+    Writes an event into the calling thread's ring. Called through TRACE_BEGIN, TRACE_END and TRACE_MARK.
+
+    Parameters
+    ----------
+    `char phase`:
+        'B' for the beginning of a span, 'E' for its end and 'i' for a point.
+
+    `const char *name`:
+        Name of the span or point, a string literal, as only the pointer is kept.
+*/
+void traceEvent(char phase, const char *name)
+{
+    struct TraceRing *ring = _traceRing != NULL ? _traceRing : claimTraceRing();
+
+    if (ring == NULL)
+        return;
+
+    struct TraceEvent *event = &ring->events[ring->written & (TRACE_RING_EVENTS - 1)];
+
+    event->name = name;
+    event->time = monotonicMicroseconds() - _traceStart;
+    event->phase = phase;
+    ring->written++;
+}
+
+/*
+    Gives the calling thread a ring of its own, the first time it writes an event, taking one given back by a
+    thread that has exited if there is any.
+
+    Returns
+    -------
+    Returns the thread's ring, or `NULL` if TRACE_MAX_THREADS threads hold rings already or there is not enough
+    memory for another.
+*/
+struct TraceRing *claimTraceRing(void)
+{
+    if (_traceRingClaimed)
+        return NULL;
+
+    _traceRingClaimed = true;
+    lockMutex(&_traceMutex);
+
+    struct TraceRing *ring = _traceFreeRings;
+
+    if (ring != NULL)
+        _traceFreeRings = ring->nextFree;
+    else if (_traceRingCount < TRACE_MAX_THREADS && (ring = (struct TraceRing *) malloc(sizeof(struct TraceRing))) != NULL)
+    {
+        ring->written = 0;
+        _traceRings[_traceRingCount++] = ring;
+    }
+
+    unlockMutex(&_traceMutex);
+
+    // the key only calls its destructor on exit for threads which have set it
+#ifdef _WIN32
+    if (ring != NULL)
+        FlsSetValue(_traceRingKey, ring);
+#else
+    if (ring != NULL)
+        pthread_setspecific(_traceRingKey, ring);
+#endif
+
+    _traceRing = ring;
+
+    return ring;
+}
+
+/*
+    Gives the ring of a thread that is exiting back, for the next thread to claim. Called as the destructor of
+    _traceRingKey.
+
+    Parameter
+    ---------
+    `void *ring`:
+        The thread's ring.
+*/
+#ifdef _WIN32
+void WINAPI releaseTraceRing(void *ring)
+#else
+void releaseTraceRing(void *ring)
+#endif
+{
+    lockMutex(&_traceMutex);
+    ((struct TraceRing *) ring)->nextFree = _traceFreeRings;
+    _traceFreeRings = (struct TraceRing *) ring;
+    unlockMutex(&_traceMutex);
+}
+
+/*
+    Writes the events of every ring to the trace file as Chrome trace-event JSON, and stops tracing. Called
+    when the program exits. Rings are numbered in the order they were allocated, and shown as threads.
+*/
+void finishTrace(void)
+{
+    _tracing = false;
+    lockMutex(&_traceMutex);
+    fprintf(_traceFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    for (int i = 0; i < _traceRingCount; i++)
+    {
+        struct TraceRing *ring = _traceRings[i];
+        unsigned long long first = ring->written > TRACE_RING_EVENTS ? ring->written - TRACE_RING_EVENTS : 0;
+        int open = 0;
+
+        fprintf(_traceFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                i == 0 ? "" : ",\n", i, i);
+
+        for (unsigned long long n = first; n < ring->written; n++)
+        {
+            struct TraceEvent *event = &ring->events[n & (TRACE_RING_EVENTS - 1)];
+
+            // the end of a span begun before the oldest event kept would be shown as ending nothing
+            if (event->phase == 'E' && open == 0)
+                continue;
+
+            open += event->phase == 'B' ? 1 : event->phase == 'E' ? -1 : 0;
+            fprintf(_traceFile, ",\n{\"name\":\"%s\",\"cat\":\"battleship\",\"ph\":\"%c\",%s\"ts\":%lld,\"pid\":1,\"tid\":%d}",
+                    event->name, event->phase, event->phase == 'i' ? "\"s\":\"t\"," : "", event->time, i);
+        }
+    }
+
+    // the rings are left to the exit, as a thread still running may hold on to its own
+    fprintf(_traceFile, "\n]}\n");
+    unlockMutex(&_traceMutex);
+
+    if (fclose(_traceFile) != 0)
+        printf("Could not write the trace.\n");
+}
@@ -0,0 +1,575 @@
+/*
+
+File Name: train.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the trainer of the policy CPU (see policy.c), which learns the policy's tables by self-play and
+    writes them out as a C file that is compiled into the program.
+
+    The policy plays games against random fleets, and before every shot every unguessed cell is counted once
+    for its neighbourhood and once for where it is on the board, as a hit or a miss, which the simulation knows
+    since it sees the whole fleet. The tables are the log-odds of a hit for every neighbourhood and every cell,
+    counts for rotated and mirrored boards added together, and are rebuilt TRAIN_GENERATIONS times from all the
+    games played so far, so that the later games are played, and counted, as the policy will play them. The
+    first games are played by a policy with empty tables, which guesses at random. Games are shared between
+    threads, each counting into its own counts, which are added up after every generation.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. train.h
+    2. thread.h
+
+    STRUCTS
+    -------
+    1. TrainCounts
+    2. TrainTask
+
+    FUNCTIONS (global)
+    ------------------
+    bool runTraining(long long games, char *path, int threads)
+
+    FUNCTIONS (local)
+    -----------------
+    1. double playGames(
+            const short *patterns, const short *cells, long long games, int exploration,
+            struct TrainCounts *counts, int threads, struct Random *random
+        )
+    2. void *playShare(void *argument)
+    3. int playPolicyGame(struct TrainTask *task)
+    4. void buildTables(struct TrainCounts *counts, short *patterns, short *cells)
+    5. short toLogOdds(long long hits, long long seen, double base, double offset)
+    6. int transformPattern(int pattern, int symmetry)
+    7. int transformCell(int cell, int symmetry)
+    8. bool writeTables(char *path, short *patterns, short *cells, long long games, double shots)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <train.h>
+#include <thread.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+    TrainCounts struct, contains how often cells were seen and turned out to be hits. Contains:
+    - long long patternHits[POLICY_PATTERNS]: number of hits among the cells with each neighbourhood.
+    - long long patternSeen[POLICY_PATTERNS]: number of cells seen with each neighbourhood.
+    - long long cellHits[CELLS]: number of hits at each cell.
+    - long long cellSeen[CELLS]: number of times each cell was seen unguessed.
+    - long long shots: number of shots fired.
+*/
+struct TrainCounts {
+    long long patternHits[POLICY_PATTERNS];
+    long long patternSeen[POLICY_PATTERNS];
+    long long cellHits[CELLS];
+    long long cellSeen[CELLS];
+    long long shots;
+};
+
+/*
+    TrainTask struct, contains the games played by one thread. Contains:
+    - const short *patterns: neighbourhood table of the policy playing.
+    - const short *cells: cell table of the policy playing.
+    - long long games: number of games to play.
+    - int exploration: percentage of shots fired at random.
+    - struct TrainCounts *counts: counts of the thread, NULL if the games are only played to measure the
+      policy, in which case only shots is counted, into shots.
+    - long long shots: number of shots fired, when counts is NULL.
+    - struct Random random: generator of the thread.
+*/
+struct TrainTask {
+    const short *patterns;
+    const short *cells;
+    long long games;
+    int exploration;
+    struct TrainCounts *counts;
+    long long shots;
+    struct Random random;
+};
+
+double playGames(
+    const short *patterns, const short *cells, long long games, int exploration,
+    struct TrainCounts *counts, int threads, struct Random *random
+);
+void *playShare(void *argument);
+int playPolicyGame(struct TrainTask *task);
+void buildTables(struct TrainCounts *counts, short *patterns, short *cells);
+short toLogOdds(long long hits, long long seen, double base, double offset);
+int transformPattern(int pattern, int symmetry);
+int transformCell(int cell, int symmetry);
+bool writeTables(char *path, short *patterns, short *cells, long long games, double shots);
+
+/*
+    Trains the policy CPU and writes its tables out. See the top of this file for how.
+
+    Parameters
+    ----------
+    `long long games`:
+        Number of games to train on.
+
+    `char *path`:
+        C file to write the tables to.
+
+    `int threads`:
+        Number of threads to play the games on, at most TRAIN_MAX_THREADS are used.
+
+    Returns
+    -------
+    Returns `true` if the tables were written, else it returns `false`.
+*/
+bool runTraining(long long games, char *path, int threads)
+{
+    short *patterns = (short *) calloc(POLICY_PATTERNS, sizeof(short));
+    short *cells = (short *) calloc(CELLS, sizeof(short));
+    struct TrainCounts *counts = (struct TrainCounts *) calloc(1, sizeof(struct TrainCounts));
+    struct Random random;
+    long long played = 0;
+    bool written = false;
+
+    if (patterns == NULL || cells == NULL || counts == NULL)
+    {
+        printf("Could not allocate memory for training.\n");
+        free(patterns);
+        free(cells);
+        free(counts);
+        return false;
+    }
+
+    // the file is tried before training, which can take hours, rather than only once the tables are ready
+    FILE *file = fopen(path, "r");
+    bool existed = file != NULL;
+
+    if (file != NULL)
+        fclose(file);
+
+    if ((file = fopen(path, "a")) == NULL)
+    {
+        printf("Could not write the policy to %s.\n", path);
+        free(patterns);
+        free(cells);
+        free(counts);
+        return false;
+    }
+
+    fclose(file);
+    initPlacements();
+    seedRandom(&random, randomSeed());
+    threads = threads < 1 ? 1 : (threads > TRAIN_MAX_THREADS ? TRAIN_MAX_THREADS : threads);
+
+    for (int generation = 0; generation < TRAIN_GENERATIONS; generation++)
+    {
+        long long share = (games * (generation + 1)) / TRAIN_GENERATIONS - played;
+        long long shots = counts->shots;
+
+        if (playGames(patterns, cells, share, TRAIN_EXPLORATION, counts, threads, &random) < 0)
+            break;
+
+        played += share;
+        buildTables(counts, patterns, cells);
+        printf("Generation %d: %lld games played, %.2f shots per game\n", generation + 1, played,
+               share > 0 ? (double) (counts->shots - shots) / share : 0.0);
+    }
+
+    if (played == games)
+    {
+        double shots = playGames(patterns, cells, TRAIN_EVALUATION_GAMES, 0, NULL, threads, &random);
+
+        printf("The trained policy sinks a random fleet in %.2f shots on average.\n", shots);
+        written = shots >= 0 && writeTables(path, patterns, cells, games, shots);
+
+        if (written)
+            printf("Wrote the policy to %s, build the program again to play with it.\n", path);
+    }
+
+    // the empty file left from trying it is not left behind
+    if (!written && !existed)
+        remove(path);
+
+    free(patterns);
+    free(cells);
+    free(counts);
+
+    return written;
+}
+
+/*
+    Plays games with the policy, shared between threads.
+
+    Parameters
+    ----------
+    `const short *patterns`:
+        Neighbourhood table of the policy.
+
+    `const short *cells`:
+        Cell table of the policy.
+
+    `long long games`:
+        Number of games to play.
+
+    `int exploration`:
+        Percentage of shots fired at random.
+
+    `struct TrainCounts *counts`:
+        Counts the games are added to, NULL if they are only played to measure the policy.
+
+    `int threads`:
+        Number of threads to play on.
+
+    `struct Random *random`:
+        Generator used to seed the threads.
+
+    Returns
+    -------
+    Returns the mean number of shots taken to sink a fleet, -1 if memory for the counts could not be allocated.
+*/
+double playGames(
+    const short *patterns, const short *cells, long long games, int exploration,
+    struct TrainCounts *counts, int threads, struct Random *random
+)
+{
+    struct TrainTask tasks[TRAIN_MAX_THREADS];
+    long long shots = 0;
+
+    for (int i = 0; i < threads; i++)
+    {
+        tasks[i].patterns = patterns;
+        tasks[i].cells = cells;
+        tasks[i].games = (games * (i + 1)) / threads - (games * i) / threads;
+        tasks[i].exploration = exploration;
+        tasks[i].shots = 0;
+        tasks[i].counts = NULL;
+        seedRandom(&tasks[i].random, nextSeed(random));
+
+        if (counts != NULL && (tasks[i].counts = (struct TrainCounts *) calloc(1, sizeof(struct TrainCounts))) == NULL)
+        {
+            printf("Could not allocate memory for training.\n");
+
+            for (int j = 0; j < i; j++)
+                free(tasks[j].counts);
+
+            return -1;
+        }
+    }
+
+    runShares(playShare, tasks, sizeof(struct TrainTask), threads);
+
+    for (int i = 0; i < threads; i++)
+    {
+        if (tasks[i].counts == NULL)
+        {
+            shots += tasks[i].shots;
+            continue;
+        }
+
+        for (int j = 0; j < POLICY_PATTERNS; j++)
+        {
+            counts->patternHits[j] += tasks[i].counts->patternHits[j];
+            counts->patternSeen[j] += tasks[i].counts->patternSeen[j];
+        }
+
+        for (int j = 0; j < CELLS; j++)
+        {
+            counts->cellHits[j] += tasks[i].counts->cellHits[j];
+            counts->cellSeen[j] += tasks[i].counts->cellSeen[j];
+        }
+
+        shots += tasks[i].counts->shots;
+        counts->shots += tasks[i].counts->shots;
+        free(tasks[i].counts);
+    }
+
+    return games > 0 ? (double) shots / games : 0;
+}
+
+/*
+    Plays one thread's share of games. Runs on its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The TrainTask to run.
+*/
+void *playShare(void *argument)
+{
+    struct TrainTask *task = (struct TrainTask *) argument;
+
+    for (long long i = 0; i < task->games; i++)
+    {
+        int shots = playPolicyGame(task);
+
+        if (task->counts != NULL)
+            task->counts->shots += shots;
+        else
+            task->shots += shots;
+    }
+
+    return NULL;
+}
+
+/*
+    Plays one game of the policy against a random fleet, counting every unguessed cell before every shot.
+
+    Parameter
+    ---------
+    `struct TrainTask *task`:
+        The task the game is played for.
+
+    Returns
+    -------
+    Returns the number of shots the policy took to sink the fleet.
+*/
+int playPolicyGame(struct TrainTask *task)
+{
+    struct Player attacker, defender;
+    struct CellMask sunk = { { 0, 0 } };
+    unsigned char fleet[SHIPS], states[POLICY_GRID * POLICY_GRID];
+    int shots = 0;
+
+    resetPlayer(&attacker);
+    resetPlayer(&defender);
+    drawFleet(&task->random, fleet);
+    placeFleet(&defender, fleet);
+
+    while (!checkWin(&defender))
+    {
+        struct TrainCounts *counts = task->counts;
+        char sunkShip = '\0';
+        int row, col;
+
+        if (counts != NULL)
+            policyStates(attacker.actionBoard, sunk, states);
+
+        for (int parity = 0; parity < 2 && counts != NULL; parity++)
+        {
+            for (int i = 0; i < attacker.unguessed.counts[parity]; i++)
+            {
+                int cell = attacker.unguessed.cells[parity][i];
+                int pattern = policyPattern(states, cell);
+                bool hit = defender.board[cell / 10][cell % 10] != ' ';
+
+                counts->patternHits[pattern] += hit;
+                counts->patternSeen[pattern]++;
+                counts->cellHits[cell] += hit;
+                counts->cellSeen[cell]++;
+            }
+        }
+
+        if (task->exploration > 0 && (int) nextRandom(&task->random, 100) < task->exploration)
+        {
+            int left = countUnguessedCells(&attacker.unguessed, -1);
+            int cell = pickUnguessedCell(&attacker.unguessed, -1, nextRandom(&task->random, left));
+
+            row = cell / 10;
+            col = cell % 10;
+        }
+        else
+        {
+            choosePolicyShot(task->patterns, task->cells, attacker.actionBoard, sunk, &attacker.unguessed, &task->random, &row, &col);
+        }
+
+        resolveShot(&attacker, &defender, row, col, &sunkShip);
+        shots++;
+
+        if (sunkShip != '\0')
+            markPolicySunk(attacker.actionBoard, &sunk, row, col, getShipLength(getShipFromIcon(sunkShip)));
+    }
+
+    return shots;
+}
+
+/*
+    Rebuilds the policy's tables from the counts of the games played so far.
+
+    Parameters
+    ----------
+    `struct TrainCounts *counts`:
+        The counts.
+
+    `short *patterns`:
+        Stores the neighbourhood table.
+
+    `short *cells`:
+        Stores the cell table, relative to the overall hit rate, which the neighbourhood table already holds.
+*/
+void buildTables(struct TrainCounts *counts, short *patterns, short *cells)
+{
+    long long hits = 0, seen = 0;
+
+    for (int cell = 0; cell < CELLS; cell++)
+    {
+        hits += counts->cellHits[cell];
+        seen += counts->cellSeen[cell];
+    }
+
+    double base = seen > 0 ? (hits + 1.0) / (seen + 2.0) : 0.5;
+
+    // every board looks the same rotated or mirrored, so the counts of all eight of its images are added up
+    for (int pattern = 0; pattern < POLICY_PATTERNS; pattern++)
+    {
+        long long patternHits = 0, patternSeen = 0;
+
+        for (int symmetry = 0; symmetry < 8; symmetry++)
+        {
+            patternHits += counts->patternHits[transformPattern(pattern, symmetry)];
+            patternSeen += counts->patternSeen[transformPattern(pattern, symmetry)];
+        }
+
+        patterns[pattern] = toLogOdds(patternHits, patternSeen, base, 0);
+    }
+
+    for (int cell = 0; cell < CELLS; cell++)
+    {
+        long long cellHits = 0, cellSeen = 0;
+
+        for (int symmetry = 0; symmetry < 8; symmetry++)
+        {
+            cellHits += counts->cellHits[transformCell(cell, symmetry)];
+            cellSeen += counts->cellSeen[transformCell(cell, symmetry)];
+        }
+
+        cells[cell] = toLogOdds(cellHits, cellSeen, base, log(base / (1 - base)));
+    }
+}
+
+/*
+    Works out the table entry for a count of hits.
+
+    Parameters
+    ----------
+    `long long hits`:
+        Number of hits.
+
+    `long long seen`:
+        Number of cells seen.
+
+    `double base`:
+        Overall hit rate, which the count starts from TRAIN_PRIOR_WEIGHT observations of, so that a count of few
+        cells stays close to it.
+
+    `double offset`:
+        Log-odds subtracted from the entry.
+
+    Returns
+    -------
+    Returns the log-odds of a hit, less offset, times POLICY_SCALE.
+*/
+short toLogOdds(long long hits, long long seen, double base, double offset)
+{
+    double rate = (hits + TRAIN_PRIOR_WEIGHT * base) / (seen + TRAIN_PRIOR_WEIGHT);
+    double value = (log(rate / (1 - rate)) - offset) * POLICY_SCALE;
+
+    value = value > 32767 ? 32767 : (value < -32767 ? -32767 : value);
+
+    return (short) lround(value);
+}
+
+/*
+    Returns a neighbourhood as it looks on the board rotated by (symmetry % 4) quarter turns, after being
+    mirrored if symmetry is 4 or more.
+*/
+int transformPattern(int pattern, int symmetry)
+{
+    int digits[4 * POLICY_REACH], transformed = 0;
+
+    for (int digit = 0; digit < 4 * POLICY_REACH; digit++, pattern /= 3)
+        digits[digit] = pattern % 3;
+
+    for (int digit = 4 * POLICY_REACH - 1; digit >= 0; digit--)
+    {
+        // direction of the digit that ends up at this one, mirroring swapping left and right
+        int direction = digit / POLICY_REACH, from = (direction - symmetry % 4 + 4) % 4;
+
+        from = symmetry >= 4 ? (4 - from) % 4 : from;
+        transformed = (transformed * 3) + digits[(from * POLICY_REACH) + (digit % POLICY_REACH)];
+    }
+
+    return transformed;
+}
+
+/*
+    Returns a cell as it is on the board rotated by (symmetry % 4) quarter turns, after being mirrored if
+    symmetry is 4 or more.
+*/
+int transformCell(int cell, int symmetry)
+{
+    int row = cell / 10, col = symmetry >= 4 ? BOARD_SIZE - 1 - (cell % 10) : cell % 10;
+
+    for (int turn = 0; turn < symmetry % 4; turn++)
+    {
+        int temp = row;
+
+        row = col;
+        col = BOARD_SIZE - 1 - temp;
+    }
+
+    return (row * 10) + col;
+}
+
+/*
+    Writes the policy's tables out as a C file.
+
+    Parameters
+    ----------
+    `char *path`:
+        The file.
+
+    `short *patterns`:
+        The neighbourhood table.
+
+    `short *cells`:
+        The cell table.
+
+    `long long games`:
+        Number of games the policy was trained on.
+
+    `double shots`:
+        Mean number of shots the policy takes to sink a random fleet.
+
+    Returns
+    -------
+    Returns `true` if the file was written, else it returns `false`.
+*/
+bool writeTables(char *path, short *patterns, short *cells, long long games, double shots)
+{
+    FILE *file = fopen(path, "w");
+    char date[16];
+    time_t now = time(NULL);
+
+    if (file == NULL)
+    {
+        printf("Could not write the policy to %s.\n", path);
+        return false;
+    }
+
+    strftime(date, sizeof date, "%Y-%m-%d", localtime(&now));
+    fprintf(file, "/*\n\nFile Name: policy_table.c\nDate of Creation: %s\n", date);
+    fprintf(file, "____________________________________________________________________________________________________________________________________\n\n");
+    fprintf(file, "    Tables of the policy CPU (see policy.c), generated by running the program with --train-policy, which is\n");
+    fprintf(file, "    how they should be changed rather than by editing this file. Trained on %lld games, after which the\n", games);
+    fprintf(file, "    policy sank a random fleet in %.2f shots on average.\n\n", shots);
+    fprintf(file, "    INCLUDES (user-defined)\n    -----------------------\n    policy.h\n\n");
+    fprintf(file, "    GLOBAL VARIABLES\n    ----------------\n");
+    fprintf(file, "    1. const short _policyPatterns[POLICY_PATTERNS]\n    2. const short _policyCells[CELLS]\n\n");
+    fprintf(file, "*Compiled using C99 standards*\n\n*/\n\n#include <policy.h>\n\n");
+
+    fprintf(file, "// log-odds of a hit at a cell with each neighbourhood, times POLICY_SCALE\n");
+    fprintf(file, "const short _policyPatterns[POLICY_PATTERNS] = {");
+
+    for (int i = 0; i < POLICY_PATTERNS; i++)
+        fprintf(file, "%s%d%s", i % 16 == 0 ? "\n    " : " ", patterns[i], i + 1 < POLICY_PATTERNS ? "," : "\n");
+
+    fprintf(file, "};\n\n// log-odds of a hit at each cell, relative to the overall hit rate, times POLICY_SCALE\n");
+    fprintf(file, "const short _policyCells[CELLS] = {");
+
+    for (int i = 0; i < CELLS; i++)
+        fprintf(file, "%s%d%s", i % BOARD_SIZE == 0 ? "\n    " : " ", cells[i], i + 1 < CELLS ? "," : "\n");
+
+    fprintf(file, "};\n");
+
+    return fclose(file) == 0;
+}
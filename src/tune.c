@@ -0,0 +1,448 @@
+/*
+
+File Name: tune.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    Contains the tuner of the hard CPU, which searches for the choices the hard CPU plays by (see HardParameters
+    in cpu.h) that sink a random fleet in the fewest shots, and the file they are kept in, which is read when the
+    program starts.
+
+    The tuner runs a pattern search, which needs no more of the choices than how well they play. Every round
+    tries the current setting against its neighbours: hunting with parity or without, every other order of
+    exploring the cells next to a hit, a checkout stack larger or smaller by a step, and one flip more or fewer.
+    All of them sink the same fleets, each with the same seed, so that they differ only by their choices, and
+    the fleets are shared between threads. The setting sinking the fleets in the fewest shots replaces the
+    current one if it beats it by TUNE_SIGNIFICANCE standard errors; when none does, the step in the size of
+    the stack is halved, and the search ends once a round with a step of 1 finds nothing better, or after
+    TUNE_MAX_ROUNDS rounds.
+
+    The file holds one choice per line, as its name and a number, and lines starting with '#' are comments.
+
+    INCLUDES (user-defined)
+    -----------------------
+    1. tune.h
+    2. thread.h
+
+    STRUCTS
+    -------
+    TuneTask
+
+    FUNCTIONS (global)
+    ------------------
+    1. bool loadHardParameters(char *path, struct HardParameters *parameters)
+    2. bool writeHardParameters(char *path, struct HardParameters parameters, double shots)
+    3. bool runTuning(long long games, char *path, int threads)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *playFleets(void *argument)
+    2. int sinkFleetHard(struct HardParameters parameters, unsigned char fleet[SHIPS], unsigned long long seed)
+    3. int listNeighbours(int setting[TUNE_PARAMETERS], int step, int candidates[TUNE_MAX_CANDIDATES][TUNE_PARAMETERS])
+    4. struct HardParameters toParameters(int setting[TUNE_PARAMETERS])
+    5. void fromParameters(struct HardParameters parameters, int setting[TUNE_PARAMETERS])
+    6. void printSetting(int setting[TUNE_PARAMETERS])
+
+*Compiled using C99 standards*
+
+*/
+
+#include <tune.h>
+#include <thread.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// names of the choices in the file, and the smallest and largest value of each
+static const char *_parameterNames[TUNE_PARAMETERS] = { "hunt_parity", "neighbour_order", "checkout_size", "flips" };
+static const int _parameterMinimums[TUNE_PARAMETERS] = { 0, 0, 1, 0 };
+static const int _parameterMaximums[TUNE_PARAMETERS] = { 1, NEIGHBOUR_ORDERS, CHECKOUT_SIZE, 3 };
+
+/*
+    TuneTask struct, contains the fleets sunk by one thread in one round. Contains:
+    - int (*candidates)[TUNE_PARAMETERS]: the settings tried, the first being the current one.
+    - int count: number of settings tried.
+    - long long first: number of the first fleet to sink.
+    - long long last: number of the fleet after the last one to sink.
+    - unsigned long long seed: seed of the round, from which every fleet is drawn.
+    - long long shots[TUNE_MAX_CANDIDATES]: total shots each setting took.
+    - double differences[TUNE_MAX_CANDIDATES]: sum of how many more shots each setting took than the current one.
+    - double squares[TUNE_MAX_CANDIDATES]: sum of the squares of the same.
+*/
+struct TuneTask {
+    int (*candidates)[TUNE_PARAMETERS];
+    int count;
+    long long first;
+    long long last;
+    unsigned long long seed;
+    long long shots[TUNE_MAX_CANDIDATES];
+    double differences[TUNE_MAX_CANDIDATES];
+    double squares[TUNE_MAX_CANDIDATES];
+};
+
+void *playFleets(void *argument);
+int sinkFleetHard(struct HardParameters parameters, unsigned char fleet[SHIPS], unsigned long long seed);
+int listNeighbours(int setting[TUNE_PARAMETERS], int step, int candidates[TUNE_MAX_CANDIDATES][TUNE_PARAMETERS]);
+struct HardParameters toParameters(int setting[TUNE_PARAMETERS]);
+void fromParameters(struct HardParameters parameters, int setting[TUNE_PARAMETERS]);
+void printSetting(int setting[TUNE_PARAMETERS]);
+
+/*
+    Reads the choices of the hard CPU from a file written by writeHardParameters. Choices the file leaves out
+    keep the values they have in parameters.
+
+    Parameters
+    ----------
+    `char *path`:
+        The file.
+
+    `struct HardParameters *parameters`:
+        Stores the choices, left as they are if the file cannot be read or is not valid.
+
+    Returns
+    -------
+    Returns `true` if the file was read, `false` if it could not be opened or is not valid, in which case the
+    reason is printed for the latter.
+*/
+bool loadHardParameters(char *path, struct HardParameters *parameters)
+{
+    FILE *file = fopen(path, "r");
+    char line[MAX_SIZE];
+    int setting[TUNE_PARAMETERS], number = 0;
+    bool valid = true;
+
+    if (file == NULL)
+        return false;
+
+    fromParameters(*parameters, setting);
+
+    while (valid && fgets(line, sizeof line, file) != NULL)
+    {
+        char name[MAX_SIZE];
+        int value, i;
+
+        number++;
+
+        if (line[0] == '#' || sscanf(line, "%s", name) != 1)
+            continue;
+
+        for (i = 0; i < TUNE_PARAMETERS && strcmp(name, _parameterNames[i]) != 0; i++);
+
+        valid = i < TUNE_PARAMETERS && sscanf(line, "%*s %d", &value) == 1
+                && value >= _parameterMinimums[i] && value <= _parameterMaximums[i];
+
+        if (valid)
+            setting[i] = value;
+    }
+
+    fclose(file);
+
+    if (!valid)
+    {
+        printf("Line %d of %s is not a valid choice of the hard CPU, which plays as it would without the file.\n", number, path);
+        return false;
+    }
+
+    *parameters = toParameters(setting);
+
+    return true;
+}
+
+/*
+    Writes the choices of the hard CPU to a file, for loadHardParameters to read.
+
+    Parameters
+    ----------
+    `char *path`:
+        The file.
+
+    `struct HardParameters parameters`:
+        The choices.
+
+    `double shots`:
+        Mean number of shots the choices took to sink a random fleet.
+
+    Returns
+    -------
+    Returns `true` if the file was written, else it returns `false`.
+*/
+bool writeHardParameters(char *path, struct HardParameters parameters, double shots)
+{
+    FILE *file = fopen(path, "w");
+    int setting[TUNE_PARAMETERS];
+
+    if (file == NULL)
+    {
+        printf("Could not write the choices of the hard CPU to %s.\n", path);
+        return false;
+    }
+
+    fromParameters(parameters, setting);
+    fprintf(file, "# choices of the hard CPU, found by running the program with --tune-hard\n");
+    fprintf(file, "# they sank a random fleet in %.2f shots on average\n", shots);
+
+    for (int i = 0; i < TUNE_PARAMETERS; i++)
+        fprintf(file, "%s %d\n", _parameterNames[i], setting[i]);
+
+    return fclose(file) == 0;
+}
+
+/*
+    Tunes the choices of the hard CPU, starting from those it plays by now, and writes the best ones found to a
+    file. See the top of this file for how.
+
+    Parameters
+    ----------
+    `long long games`:
+        Number of fleets every setting sinks in every round.
+
+    `char *path`:
+        File to write the choices to.
+
+    `int threads`:
+        Number of threads to play the games on, at most TUNE_MAX_THREADS are used.
+
+    Returns
+    -------
+    Returns `true` if the choices were written, else it returns `false`.
+*/
+bool runTuning(long long games, char *path, int threads)
+{
+    int setting[TUNE_PARAMETERS], candidates[TUNE_MAX_CANDIDATES][TUNE_PARAMETERS], step = TUNE_CHECKOUT_STEP;
+    struct TuneTask tasks[TUNE_MAX_THREADS];
+    struct Random random;
+    double shots = 0;
+
+    initPlacements();
+    seedRandom(&random, randomSeed());
+    threads = threads < 1 ? 1 : (threads > TUNE_MAX_THREADS ? TUNE_MAX_THREADS : threads);
+    fromParameters(getHardParameters(), setting);
+
+    for (int round = 1; round <= TUNE_MAX_ROUNDS; round++)
+    {
+        unsigned long long seed = nextSeed(&random);
+        long long totals[TUNE_MAX_CANDIDATES] = { 0 };
+        double differences[TUNE_MAX_CANDIDATES] = { 0 }, squares[TUNE_MAX_CANDIDATES] = { 0 };
+        int count = listNeighbours(setting, step, candidates), best = 0;
+
+        for (int i = 0; i < threads; i++)
+        {
+            memset(&tasks[i], 0, sizeof tasks[i]);
+            tasks[i].candidates = candidates;
+            tasks[i].count = count;
+            tasks[i].first = (games * i) / threads;
+            tasks[i].last = (games * (i + 1)) / threads;
+            tasks[i].seed = seed;
+        }
+
+        runShares(playFleets, tasks, sizeof(struct TuneTask), threads);
+
+        for (int i = 0; i < threads; i++)
+        {
+            for (int j = 0; j < count; j++)
+            {
+                totals[j] += tasks[i].shots[j];
+                differences[j] += tasks[i].differences[j];
+                squares[j] += tasks[i].squares[j];
+            }
+        }
+
+        // the best setting has to beat the current one by more than the noise of the fleets drawn
+        for (int i = 1; i < count && games > 1; i++)
+        {
+            double mean = differences[i] / games;
+            double error = sqrt((squares[i] - differences[i] * mean) / (games - 1) / games);
+
+            if (mean < -TUNE_SIGNIFICANCE * error && totals[i] < totals[best])
+                best = i;
+        }
+
+        shots = (double) totals[best] / games;
+        printf("Round %d: %d settings on %lld fleets, %.2f shots with ", round, count, games, (double) totals[0] / games);
+        printSetting(setting);
+
+        if (best != 0)
+        {
+            memcpy(setting, candidates[best], sizeof setting);
+            printf(", %.2f shots with ", shots);
+            printSetting(setting);
+        }
+        else if (step > 1)
+        {
+            step /= 2;
+            printf(", none better, trying a step of %d in checkout_size", step);
+        }
+        else
+        {
+            printf(", none better\n");
+            break;
+        }
+
+        printf("\n");
+    }
+
+    printf("The hard CPU sinks a random fleet in %.2f shots on average with ", shots);
+    printSetting(setting);
+    printf(".\n");
+
+    if (!writeHardParameters(path, toParameters(setting), shots))
+        return false;
+
+    printf("Wrote the choices to %s, which the hard CPU plays by from the next time the program starts.\n", path);
+
+    return true;
+}
+
+/*
+    Sinks one thread's share of the fleets of a round with every setting tried. Runs on its own thread.
+
+    Parameter
+    ---------
+    `void *argument`:
+        The TuneTask to run.
+*/
+void *playFleets(void *argument)
+{
+    struct TuneTask *task = (struct TuneTask *) argument;
+
+    for (long long i = task->first; i < task->last; i++)
+    {
+        struct Random random;
+        unsigned char fleet[SHIPS];
+        unsigned long long seed;
+        int current = 0;
+
+        // every fleet is drawn from the seed of the round and its number, whichever thread sinks it
+        seedRandom(&random, task->seed ^ ((unsigned long long) (i + 1) * 0x9E3779B97F4A7C15ULL));
+        drawFleet(&random, fleet);
+        seed = nextSeed(&random);
+
+        for (int j = 0; j < task->count; j++)
+        {
+            int shots = sinkFleetHard(toParameters(task->candidates[j]), fleet, seed);
+
+            current = j == 0 ? shots : current;
+            task->shots[j] += shots;
+            task->differences[j] += shots - current;
+            task->squares[j] += (double) (shots - current) * (shots - current);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Lets the hard CPU sink a fleet on its own.
+
+    Parameters
+    ----------
+    `struct HardParameters parameters`:
+        The choices the CPU plays by.
+
+    `unsigned char fleet[SHIPS]`:
+        The fleet, as drawn by drawFleet.
+
+    `unsigned long long seed`:
+        Seed of the CPU's random number generator.
+
+    Returns
+    -------
+    Returns the number of shots the CPU took.
+*/
+int sinkFleetHard(struct HardParameters parameters, unsigned char fleet[SHIPS], unsigned long long seed)
+{
+    struct Player attacker, defender;
+    struct CPUState cpu;
+    char moveStatus;
+    int shots = 1;
+
+    resetPlayer(&attacker);
+    resetPlayer(&defender);
+    placeFleet(&defender, fleet);
+    initCPUState(&cpu, 0, HARD, seed);
+    cpu.hard = parameters;
+
+    while (!playCPUTurn(&cpu, &attacker, &defender, &moveStatus))
+        shots++;
+
+    resetCPUVariables(&cpu);
+
+    return shots;
+}
+
+/*
+    Lists the settings tried in a round, the current one first and then its neighbours.
+
+    Parameters
+    ----------
+    `int setting[TUNE_PARAMETERS]`:
+        The current setting.
+
+    `int step`:
+        Step taken in the size of the checkout stack.
+
+    `int candidates[TUNE_MAX_CANDIDATES][TUNE_PARAMETERS]`:
+        Stores the settings.
+
+    Returns
+    -------
+    Returns the number of settings listed.
+*/
+int listNeighbours(int setting[TUNE_PARAMETERS], int step, int candidates[TUNE_MAX_CANDIDATES][TUNE_PARAMETERS])
+{
+    int count = 1;
+
+    memcpy(candidates[0], setting, sizeof candidates[0]);
+
+    for (int i = 0; i < TUNE_PARAMETERS; i++)
+    {
+        // hunting with parity is a yes or no and the order of exploring a choice between orders rather than a
+        // number, so every other value of both is tried
+        bool categorical = i <= 1;
+        int stride = i == 2 ? step : 1;
+
+        for (int value = _parameterMinimums[i]; value <= _parameterMaximums[i]; value++)
+        {
+            bool neighbour = categorical ? value != setting[i] : (value == setting[i] - stride || value == setting[i] + stride);
+
+            if (!neighbour)
+                continue;
+
+            memcpy(candidates[count], setting, sizeof candidates[count]);
+            candidates[count++][i] = value;
+        }
+    }
+
+    return count;
+}
+
+/*
+    Returns the choices of the hard CPU given by a setting of the tuner.
+*/
+struct HardParameters toParameters(int setting[TUNE_PARAMETERS])
+{
+    struct HardParameters parameters = { setting[0] != 0, setting[1], setting[2], setting[3] };
+
+    return parameters;
+}
+
+/*
+    Stores the choices of the hard CPU as a setting of the tuner, in setting.
+*/
+void fromParameters(struct HardParameters parameters, int setting[TUNE_PARAMETERS])
+{
+    setting[0] = parameters.huntParity ? 1 : 0;
+    setting[1] = parameters.neighbourOrder;
+    setting[2] = parameters.checkoutSize;
+    setting[3] = parameters.flips;
+}
+
+/*
+    Prints a setting of the tuner, as the names and values of its choices.
+*/
+void printSetting(int setting[TUNE_PARAMETERS])
+{
+    for (int i = 0; i < TUNE_PARAMETERS; i++)
+        printf("%s%s %d", i > 0 ? ", " : "", _parameterNames[i], setting[i]);
+}
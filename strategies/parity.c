@@ -0,0 +1,176 @@
+/*
+
+File Name: parity.c
+Author: Ishaan Bose
+Date of Creation: 2026-10-19
+____________________________________________________________________________________________________________________________________
+
+    An example CPU strategy, built as a shared library and loaded with `--strategy parity`. It hunts on the
+    cells of one colour of the checkerboard, since every ship covers at least one of them, and once it has a
+    hit that does not belong to a sunk ship, targets the unguessed cells next to its hits. It only uses what
+    strategy.h provides, and can be used as a starting point for new strategies.
+
+    INCLUDES (user-defined)
+    -----------------------
+    strategy.h
+
+    STRUCTS
+    -------
+    ParityState
+
+    FUNCTIONS (global)
+    ------------------
+    const struct Strategy *battleshipStrategy(void)
+
+    FUNCTIONS (local)
+    -----------------
+    1. void *initParity(unsigned long long seed)
+    2. void chooseShotParity(void *state, const struct StrategyView *view, int *row, int *col)
+    3. void observeResultParity(void *state, int row, int col, char result, char sunk)
+    4. void freeParity(void *state)
+    5. unsigned int nextNumber(struct ParityState *parity, unsigned int bound)
+
+*Compiled using C99 standards*
+
+*/
+
+#include <strategy.h>
+#include <stdlib.h>
+
+/*
+    ParityState struct, contains everything the strategy remembers during a game. Contains:
+    - unsigned long long random: state of the strategy's random number generator, never 0.
+    - int openHits: hits that do not belong to a ship known to be sunk yet.
+    - int shipLengths[STRATEGY_SHIPS]: length of every ship, as last seen in a view.
+*/
+struct ParityState {
+    unsigned long long random;
+    int openHits;
+    int shipLengths[STRATEGY_SHIPS];
+};
+
+#ifdef _WIN32
+    #define EXPORT __declspec(dllexport)
+#else
+    #define EXPORT
+#endif
+
+void *initParity(unsigned long long seed);
+void chooseShotParity(void *state, const struct StrategyView *view, int *row, int *col);
+void observeResultParity(void *state, int row, int col, char result, char sunk);
+void freeParity(void *state);
+unsigned int nextNumber(struct ParityState *parity, unsigned int bound);
+
+/*
+    Returns the strategy, looked up by name when the library is loaded.
+*/
+EXPORT const struct Strategy *battleshipStrategy()
+{
+    static const struct Strategy strategy = {
+        STRATEGY_ABI_VERSION, "Parity (plugin)", initParity, chooseShotParity, observeResultParity, freeParity
+    };
+
+    return &strategy;
+}
+
+/*
+    Creates the state of the strategy for a new game.
+*/
+void *initParity(unsigned long long seed)
+{
+    struct ParityState *parity = (struct ParityState *) malloc(sizeof(struct ParityState));
+
+    if (parity != NULL)
+    {
+        parity->random = seed != 0 ? seed : 1;
+        parity->openHits = 0;
+    }
+
+    return parity;
+}
+
+/*
+    Chooses a random unguessed cell next to a hit while there are open hits, else a random unguessed cell of
+    the checkerboard colour. Falls back to any unguessed cell when the preferred ones have all been guessed.
+*/
+void chooseShotParity(void *state, const struct StrategyView *view, int *row, int *col)
+{
+    struct ParityState *parity = (struct ParityState *) state;
+    int preferred[STRATEGY_BOARD_SIZE * STRATEGY_BOARD_SIZE], others[STRATEGY_BOARD_SIZE * STRATEGY_BOARD_SIZE];
+    int preferredCount = 0, otherCount = 0;
+
+    for (int i = 0; i < STRATEGY_SHIPS; i++)
+        parity->shipLengths[i] = view->shipLengths[i];
+
+    for (int r = 0; r < STRATEGY_BOARD_SIZE; r++)
+    {
+        for (int c = 0; c < STRATEGY_BOARD_SIZE; c++)
+        {
+            int target;
+
+            if (view->actionBoard[r][c] != ' ')
+                continue;
+
+            if (parity->openHits > 0)
+            {
+                target = (r > 0 && view->actionBoard[r - 1][c] == 'X')
+                    || (r < STRATEGY_BOARD_SIZE - 1 && view->actionBoard[r + 1][c] == 'X')
+                    || (c > 0 && view->actionBoard[r][c - 1] == 'X')
+                    || (c < STRATEGY_BOARD_SIZE - 1 && view->actionBoard[r][c + 1] == 'X');
+            }
+            else
+            {
+                target = (r + c) % 2 == 0;
+            }
+
+            if (target)
+                preferred[preferredCount++] = (r * STRATEGY_BOARD_SIZE) + c;
+            else
+                others[otherCount++] = (r * STRATEGY_BOARD_SIZE) + c;
+        }
+    }
+
+    int cell = preferredCount > 0 ? preferred[nextNumber(parity, preferredCount)] : others[nextNumber(parity, otherCount)];
+
+    *row = cell / STRATEGY_BOARD_SIZE;
+    *col = cell % STRATEGY_BOARD_SIZE;
+}
+
+/*
+    Counts the hits of ships that have not been sunk yet.
+*/
+void observeResultParity(void *state, int row, int col, char result, char sunk)
+{
+    struct ParityState *parity = (struct ParityState *) state;
+    const char icons[] = "CBDSP";
+
+    if (result == 'H')
+        parity->openHits++;
+
+    for (int i = 0; sunk != '\0' && i < STRATEGY_SHIPS; i++)
+    {
+        if (icons[i] == sunk)
+            parity->openHits = parity->openHits > parity->shipLengths[i] ? parity->openHits - parity->shipLengths[i] : 0;
+    }
+}
+
+/*
+    Frees the state of the strategy.
+*/
+void freeParity(void *state)
+{
+    free(state);
+}
+
+/*
+    Returns a random number from 0 up to, but not including, bound, which is more than 0.
+*/
+unsigned int nextNumber(struct ParityState *parity, unsigned int bound)
+{
+    // xorshift64
+    parity->random ^= parity->random << 13;
+    parity->random ^= parity->random >> 7;
+    parity->random ^= parity->random << 17;
+
+    return (unsigned int) (parity->random % bound);
+}